@@ -28,6 +28,43 @@
 #include "Animation.h"
 #include "cbWidget.h"
 
+void AnimationTrack::SetKey(const float Time, const float Value, const eAnimationEasing Easing)
+{
+	const auto It = std::lower_bound(Times.begin(), Times.end(), Time);
+	const std::size_t Index = (std::size_t)(It - Times.begin());
+	if (It != Times.end() && *It == Time)
+	{
+		Values[Index] = Value;
+		Easings[Index] = Easing;
+		return;
+	}
+
+	Times.insert(It, Time);
+	Values.insert(Values.begin() + Index, Value);
+	Easings.insert(Easings.begin() + Index, Easing);
+}
+
+bool AnimationTrack::RemoveKey(const float Time)
+{
+	const auto It = std::lower_bound(Times.begin(), Times.end(), Time);
+	if (It == Times.end() || *It != Time)
+		return false;
+
+	const std::size_t Index = (std::size_t)(It - Times.begin());
+	Times.erase(It);
+	Values.erase(Values.begin() + Index);
+	Easings.erase(Easings.begin() + Index);
+	return true;
+}
+
+std::optional<float> AnimationTrack::GetKey(const float Time) const
+{
+	const auto It = std::lower_bound(Times.begin(), Times.end(), Time);
+	if (It == Times.end() || *It != Time)
+		return std::nullopt;
+	return Values[(std::size_t)(It - Times.begin())];
+}
+
 AnimationGraph::AnimationGraph(cbWidget* UI)
 {
 	AnimationTransform Transform;
@@ -37,12 +74,12 @@ AnimationGraph::AnimationGraph(cbWidget* UI)
 	Transform.Roll = Rotation;
 	Transform.Pitch = 0.0f;
 	Transform.Yaw = 0.0f;
-	Graph.insert({ 0.0f, Transform });
+	SetKeyFrame(0.0f, Transform);
 }
 
 AnimationGraph::AnimationGraph(const AnimationTransform& Transform)
 {
-	Graph.insert({ 0.0f, Transform });
+	SetKeyFrame(0.0f, Transform);
 }
 
 AnimationGraph::AnimationGraph(const cbTransform& inTransform)
@@ -54,7 +91,7 @@ AnimationGraph::AnimationGraph(const cbTransform& inTransform)
 	Transform.Roll = Roll;
 	Transform.Pitch = 0.0f;
 	Transform.Yaw = 0.0f;
-	Graph.insert({ 0.0f, Transform });
+	SetKeyFrame(0.0f, Transform);
 }
 
 AnimationGraph::AnimationGraph(const cbVector& Location, const cbVector3& RPY)
@@ -66,7 +103,79 @@ AnimationGraph::AnimationGraph(const cbVector& Location, const cbVector3& RPY)
 	Transform.Roll = RollPitchYaw.X;
 	Transform.Pitch = RollPitchYaw.Y;
 	Transform.Yaw = RollPitchYaw.Z;
-	Graph.insert({ 0.0f, Transform });
+	SetKeyFrame(0.0f, Transform);
+}
+
+void AnimationGraph::SetKeyFrame(const float KeyFrame, const AnimationTransform& Transform, const eAnimationEasing Easing)
+{
+	SetKey(eAnimationChannel::X, KeyFrame, Transform.X, Easing);
+	SetKey(eAnimationChannel::Y, KeyFrame, Transform.Y, Easing);
+	SetKey(eAnimationChannel::Roll, KeyFrame, Transform.Roll, Easing);
+	SetKey(eAnimationChannel::Yaw, KeyFrame, Transform.Yaw, Easing);
+	SetKey(eAnimationChannel::Pitch, KeyFrame, Transform.Pitch, Easing);
+}
+
+void AnimationGraph::SetLocationKeyFrame(const float KeyFrame, const float X, const float Y, const eAnimationEasing Easing)
+{
+	SetKey(eAnimationChannel::X, KeyFrame, X, Easing);
+	SetKey(eAnimationChannel::Y, KeyFrame, Y, Easing);
+}
+
+void AnimationGraph::SetRotationKeyFrame(const float KeyFrame, const float Roll, const float Yaw, const float Pitch, const eAnimationEasing Easing)
+{
+	SetKey(eAnimationChannel::Roll, KeyFrame, Roll, Easing);
+	SetKey(eAnimationChannel::Yaw, KeyFrame, Yaw, Easing);
+	SetKey(eAnimationChannel::Pitch, KeyFrame, Pitch, Easing);
+}
+
+void AnimationGraph::SetKey(const eAnimationChannel Channel, const float KeyFrame, const float Value, const eAnimationEasing Easing)
+{
+	Tracks[(std::size_t)Channel].SetKey(KeyFrame, Value, Easing);
+}
+
+std::size_t AnimationBatchEvaluator::Add(const IAnimationGraph* Graph, const float Time, AnimationCursor* Cursor)
+{
+	Times.push_back(Time);
+	Cursors.push_back(Cursor);
+	for (std::size_t Channel = 0; Channel < AnimationChannelCount; Channel++)
+		Tracks[Channel].push_back(&Graph->GetTrack((eAnimationChannel)Channel));
+	return Times.size() - 1;
+}
+
+void AnimationBatchEvaluator::Evaluate()
+{
+	const std::size_t Count = Times.size();
+	for (std::size_t Channel = 0; Channel < AnimationChannelCount; Channel++)
+	{
+		const auto& ChannelTracks = Tracks[Channel];
+		auto& ChannelResults = Results[Channel];
+		ChannelResults.resize(Count);
+
+		for (std::size_t i = 0; i < Count; i++)
+			ChannelResults[i] = ChannelTracks[i]->Evaluate(Times[i], Cursors[i]->Segments[Channel]);
+	}
+}
+
+void AnimationBatchEvaluator::Clear()
+{
+	Times.clear();
+	Cursors.clear();
+	for (std::size_t Channel = 0; Channel < AnimationChannelCount; Channel++)
+	{
+		Tracks[Channel].clear();
+		Results[Channel].clear();
+	}
+}
+
+AnimationTransform AnimationBatchEvaluator::GetTransform(const std::size_t Index) const
+{
+	AnimationTransform Transform;
+	Transform.X = Get(eAnimationChannel::X, Index);
+	Transform.Y = Get(eAnimationChannel::Y, Index);
+	Transform.Roll = Get(eAnimationChannel::Roll, Index);
+	Transform.Yaw = Get(eAnimationChannel::Yaw, Index);
+	Transform.Pitch = Get(eAnimationChannel::Pitch, Index);
+	return Transform;
 }
 
 cbAnimation::cbAnimation()
@@ -90,7 +199,22 @@ void cbAnimation::BeginPlay()
 void cbAnimation::Tick(const float DeltaTime)
 {
 	for (const auto& Timeline : Timelines)
-		Timeline->Run(DeltaTime);
+	{
+		if (Timeline->Advance(DeltaTime))
+		{
+			BatchEvaluator.Add(Timeline->GetGraph(), Timeline->GetElapsedTime(), Timeline->GetCursor());
+			ActiveTimelines.push_back(Timeline);
+		}
+	}
+
+	BatchEvaluator.Evaluate();
+
+	for (std::size_t i = 0; i < ActiveTimelines.size(); i++)
+		ActiveTimelines[i]->Apply(BatchEvaluator.GetTransform(i));
+
+	/* The capacity is kept for the next tick. */
+	BatchEvaluator.Clear();
+	ActiveTimelines.clear();
 }
 
 IAnimationTimeline* cbAnimation::GetTimeline(std::string Name) const
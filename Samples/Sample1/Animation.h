@@ -30,6 +30,10 @@
 #include <iostream>
 #include <functional>
 #include <map>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cstdint>
 #include <cbImage.h>
 #include <cbWidget.h>
 
@@ -49,13 +53,145 @@ struct AnimationTransform
 	{}
 };
 
+enum class eAnimationChannel : std::uint8_t
+{
+	X,
+	Y,
+	Roll,
+	Yaw,
+	Pitch,
+	Count,
+};
+
+static constexpr std::size_t AnimationChannelCount = (std::size_t)eAnimationChannel::Count;
+
+/* What the timeline writes the evaluated transform to. */
+enum class eAnimationTarget : std::uint8_t
+{
+	/* Location and rotation of the widget, the hierarchy is laid out again. */
+	Layout,
+	/*
+	* Translation and rotation of the render transform, the layout is not touched.
+	* X and Y are the offset from the laid out location.
+	*/
+	RenderTransform,
+};
+
+/* Easing of the segment that ends at the key. */
+enum class eAnimationEasing : std::uint8_t
+{
+	Linear,
+	EaseIn,
+	EaseOut,
+	EaseInOut,
+	Step,
+};
+
+cbFORCEINLINE float ApplyEasing(const eAnimationEasing Easing, const float Percent)
+{
+	switch (Easing)
+	{
+	case eAnimationEasing::EaseIn:
+		return Percent * Percent;
+	case eAnimationEasing::EaseOut:
+		return Percent * (2.0f - Percent);
+	case eAnimationEasing::EaseInOut:
+		return Percent < 0.5f ? 2.0f * Percent * Percent : -1.0f + (4.0f - 2.0f * Percent) * Percent;
+	case eAnimationEasing::Step:
+		return Percent >= 1.0f ? 1.0f : 0.0f;
+	default:
+		return Percent;
+	}
+}
+
+/* Last segment of each channel, evaluations that move forward in time find the segment without searching. */
+struct AnimationCursor
+{
+	std::size_t Segments[AnimationChannelCount];
+
+	AnimationCursor()
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		for (std::size_t i = 0; i < AnimationChannelCount; i++)
+			Segments[i] = 0;
+	}
+};
+
+/* Keys of a single channel, sorted by time. */
+class AnimationTrack
+{
+public:
+	AnimationTrack() = default;
+	~AnimationTrack() = default;
+
+	/* Replaces the key if a key already exists at the time. */
+	void SetKey(const float Time, const float Value, const eAnimationEasing Easing = eAnimationEasing::Linear);
+	bool RemoveKey(const float Time);
+	std::optional<float> GetKey(const float Time) const;
+
+	/* Uses the segment of the cursor if it still contains the time, the next segment or a binary search otherwise. */
+	cbFORCEINLINE float Evaluate(const float Time, std::size_t& Segment) const
+	{
+		if (Times.empty())
+			return 0.0f;
+
+		const std::size_t Last = Times.size() - 1;
+		if (Time >= Times[Last])
+		{
+			Segment = Last;
+			return Values[Last];
+		}
+		if (Time < Times[0])
+		{
+			Segment = 0;
+			return Values[0];
+		}
+
+		if (Segment >= Last || Time < Times[Segment] || Time >= Times[Segment + 1])
+		{
+			if (Segment + 1 < Last && Time >= Times[Segment + 1] && Time < Times[Segment + 2])
+				Segment++;
+			else
+				Segment = (std::size_t)(std::upper_bound(Times.begin(), Times.end(), Time) - Times.begin()) - 1;
+		}
+
+		const float KeyFrameTime = Times[Segment + 1] - Times[Segment];
+		float Percent = (Time - Times[Segment]) / KeyFrameTime;
+
+		if (Percent + 0.001f >= 1.0f)
+			Percent = 1.0f;
+
+		return cbgui::Lerp(Values[Segment], Values[Segment + 1], ApplyEasing(Easings[Segment + 1], Percent));
+	}
+	float Evaluate(const float Time) const
+	{
+		std::size_t Segment = 0;
+		return Evaluate(Time, Segment);
+	}
+
+	inline bool IsEmpty() const { return Times.empty(); }
+	inline std::size_t GetKeyCount() const { return Times.size(); }
+	inline float GetLastKeyTime() const { return Times.empty() ? 0.0f : Times.back(); }
+
+private:
+	std::vector<float> Times;
+	std::vector<float> Values;
+	std::vector<eAnimationEasing> Easings;
+};
+
 class IAnimationGraph
 {
 	cbBaseClassBody(cbClassDefaultProtectedConstructor, IAnimationGraph)
 public:
 	virtual AnimationTransform Get(const float ElapsedTime) const = 0;
+	virtual AnimationTransform Get(const float ElapsedTime, AnimationCursor& Cursor) const = 0;
 	virtual AnimationTransform GetKeyFrame(const float KeyFrame) const = 0;
 	virtual float GetLastKeyFrameTime() const = 0;
+	virtual const AnimationTrack& GetTrack(const eAnimationChannel Channel) const = 0;
 };
 
 class AnimationGraph : public IAnimationGraph
@@ -68,100 +204,71 @@ public:
 	AnimationGraph(const AnimationTransform & Transform);
 	AnimationGraph(const cbVector& Location, const cbVector3& RPY);
 
-	virtual ~AnimationGraph()
-	{
-		Graph.clear();
-	}
+	virtual ~AnimationGraph() = default;
 
 public:
 	virtual AnimationTransform Get(const float ElapsedTime) const override
 	{
-		float PastKeyFrame = 0.0f;
-		AnimationTransform PastTransform;
-		for (const auto& KeyFrame : Graph)
-		{
-			if (ElapsedTime < KeyFrame.first)
-			{
-				AnimationTransform Transform = KeyFrame.second;
-				const float Time = ElapsedTime - PastKeyFrame;
-				const float KeyFrameTime = KeyFrame.first - PastKeyFrame;
-				float Percent = Time / KeyFrameTime;
-
-				if (Percent + 0.001f >= 1.0f)
-					Percent = 1.0f;
-
-				//Transform.X *= Percent;
-				//Transform.Y *= Percent;
-				//Transform.Roll *= Percent;
-				//Transform.Yaw *= Percent;
-				//Transform.Pitch *= Percent;
-				Transform.Roll = cbgui::Lerp(PastTransform.Roll, Transform.Roll, Percent);
-				Transform.Yaw = cbgui::Lerp(PastTransform.Yaw, Transform.Yaw, Percent);
-				Transform.Pitch = cbgui::Lerp(PastTransform.Pitch, Transform.Pitch, Percent);
-				Transform.X = cbgui::Lerp(PastTransform.X, Transform.X, Percent);
-				Transform.Y = cbgui::Lerp(PastTransform.Y, Transform.Y, Percent);
-				//Transform.ScaleX *= Percent;
-				//Transform.ScaleY *= Percent;
-				return Transform;
-			}
-			PastKeyFrame = KeyFrame.first;
-			PastTransform = KeyFrame.second;
-		}
-		return PastTransform;
-	}
-	virtual AnimationTransform GetKeyFrame(const float KeyFrame) const override
-	{
-		if (Graph.find(KeyFrame) != Graph.end())
-			return Graph.at(KeyFrame);
-		return AnimationTransform();
+		AnimationCursor Cursor;
+		return Get(ElapsedTime, Cursor);
 	}
-	virtual void SetKeyFrame(const float KeyFrame, const AnimationTransform& Transform)
+	virtual AnimationTransform Get(const float ElapsedTime, AnimationCursor& Cursor) const override
 	{
-		if (Graph.find(KeyFrame) != Graph.end())
-			Graph.insert({ KeyFrame, Transform });
-		else
-			Graph[KeyFrame] = Transform;
+		AnimationTransform Transform;
+		Transform.X = Tracks[(std::size_t)eAnimationChannel::X].Evaluate(ElapsedTime, Cursor.Segments[(std::size_t)eAnimationChannel::X]);
+		Transform.Y = Tracks[(std::size_t)eAnimationChannel::Y].Evaluate(ElapsedTime, Cursor.Segments[(std::size_t)eAnimationChannel::Y]);
+		Transform.Roll = Tracks[(std::size_t)eAnimationChannel::Roll].Evaluate(ElapsedTime, Cursor.Segments[(std::size_t)eAnimationChannel::Roll]);
+		Transform.Yaw = Tracks[(std::size_t)eAnimationChannel::Yaw].Evaluate(ElapsedTime, Cursor.Segments[(std::size_t)eAnimationChannel::Yaw]);
+		Transform.Pitch = Tracks[(std::size_t)eAnimationChannel::Pitch].Evaluate(ElapsedTime, Cursor.Segments[(std::size_t)eAnimationChannel::Pitch]);
+		return Transform;
 	}
-
-	virtual void SetLocationKeyFrame(const float KeyFrame, const float X, const float Y)
-	{
-		if (Graph.find(KeyFrame) != Graph.end())
-		{
-			Graph[KeyFrame].X = X;
-			Graph[KeyFrame].Y = Y;
-		}
-		else
-		{
-			AnimationTransform Transform;
-			Transform.X = X;
-			Transform.Y = Y;
-			Graph.insert({ KeyFrame, Transform });
-		}
-	}
-	virtual void SetRotationKeyFrame(const float KeyFrame, const float Roll, const float Yaw, const float Pitch)
+	/* Channels without a key at the time are evaluated. */
+	virtual AnimationTransform GetKeyFrame(const float KeyFrame) const override
 	{
-		if (Graph.find(KeyFrame) != Graph.end())
-		{
-			Graph[KeyFrame].Roll = Roll;
-			Graph[KeyFrame].Yaw = Yaw;
-			Graph[KeyFrame].Pitch = Pitch;
-		}
-		else
-		{
-			AnimationTransform Transform;
-			Transform.Roll = Roll;
-			Transform.Yaw = Yaw;
-			Transform.Pitch = Pitch;
-			Graph.insert({ KeyFrame, Transform });
-		}
+		return Get(KeyFrame);
 	}
+	virtual void SetKeyFrame(const float KeyFrame, const AnimationTransform& Transform, const eAnimationEasing Easing = eAnimationEasing::Linear);
+	virtual void SetLocationKeyFrame(const float KeyFrame, const float X, const float Y, const eAnimationEasing Easing = eAnimationEasing::Linear);
+	virtual void SetRotationKeyFrame(const float KeyFrame, const float Roll, const float Yaw, const float Pitch, const eAnimationEasing Easing = eAnimationEasing::Linear);
+	void SetKey(const eAnimationChannel Channel, const float KeyFrame, const float Value, const eAnimationEasing Easing = eAnimationEasing::Linear);
 
 	virtual float GetLastKeyFrameTime() const override
 	{
-		return std::prev(Graph.end())->first;
+		float Time = 0.0f;
+		for (const auto& Track : Tracks)
+			Time = std::max(Time, Track.GetLastKeyTime());
+		return Time;
 	}
 
-	std::map<float, AnimationTransform> Graph;
+	virtual const AnimationTrack& GetTrack(const eAnimationChannel Channel) const override { return Tracks[(std::size_t)Channel]; }
+
+private:
+	AnimationTrack Tracks[AnimationChannelCount];
+};
+
+/*
+* Evaluates the graphs of many timelines at once.
+* Inputs and results are stored per channel, each channel of all entries is evaluated in one pass.
+*/
+class AnimationBatchEvaluator
+{
+public:
+	AnimationBatchEvaluator() = default;
+	~AnimationBatchEvaluator() = default;
+
+	std::size_t Add(const IAnimationGraph* Graph, const float Time, AnimationCursor* Cursor);
+	void Evaluate();
+	void Clear();
+
+	inline std::size_t size() const { return Times.size(); }
+	inline float Get(const eAnimationChannel Channel, const std::size_t Index) const { return Results[(std::size_t)Channel][Index]; }
+	AnimationTransform GetTransform(const std::size_t Index) const;
+
+private:
+	std::vector<float> Times;
+	std::vector<AnimationCursor*> Cursors;
+	std::vector<const AnimationTrack*> Tracks[AnimationChannelCount];
+	std::vector<float> Results[AnimationChannelCount];
 };
 
 class IAnimationTimeline
@@ -170,7 +277,12 @@ class IAnimationTimeline
 public:
 	virtual AnimationTransform GetCurrentTransform() const = 0;
 	virtual void SetGraph(IAnimationGraph* AnimationGraph) = 0;
+	virtual const IAnimationGraph* GetGraph() const = 0;
 	virtual void Run(const float DeltaTime) = 0;
+	/* Advances the elapsed time, returns true if the graph must be evaluated. Used by the batch evaluator with Apply. */
+	virtual bool Advance(const float DeltaTime) = 0;
+	virtual void Apply(const AnimationTransform& Transform) = 0;
+	virtual AnimationCursor* GetCursor() = 0;
 	virtual void Play() = 0;
 	virtual void Pause() = 0;
 	virtual void Reset() = 0;
@@ -188,9 +300,10 @@ class AnimationTimeline : public IAnimationTimeline
 {
 	cbClassBody(cbClassConstructor, AnimationTimeline, IAnimationTimeline)
 public:
-	AnimationTimeline(const std::string pName, T* pWidget)
+	AnimationTimeline(const std::string pName, T* pWidget, const eAnimationTarget InTarget = eAnimationTarget::Layout)
 		: Name(pName)
 		, Widget(pWidget)
+		, Target(InTarget)
 		, ElapsedTime(0.0f)
 		, Graph(nullptr)
 		, bIsAnimationActive(false)
@@ -216,11 +329,20 @@ public:
 	virtual void SetGraph(IAnimationGraph* AnimationGraph) override
 	{
 		Graph = AnimationGraph;
+		Cursor.Reset();
 	}
+	virtual const IAnimationGraph* GetGraph() const override { return Graph; }
+	virtual AnimationCursor* GetCursor() override { return &Cursor; }
+
 	virtual void Run(const float DeltaTime) override
+	{
+		if (Advance(DeltaTime))
+			Apply(Graph->Get(ElapsedTime, Cursor));
+	}
+	virtual bool Advance(const float DeltaTime) override
 	{
 		if (!bIsAnimationActive)
-			return;
+			return false;
 
 		const bool bIsAnimationEnded = IsAnimationEnded();
 
@@ -237,11 +359,27 @@ public:
 		if (Graph && !bIsAnimationEnded)
 		{
 			ElapsedTime += DeltaTime;
-			AnimationTransform Transform = Graph->Get(ElapsedTime);
-			Widget->SetLocation(cbVector(Transform.X, Transform.Y));
-			Widget->SetRotation(Transform.Roll);
+			return true;
 		}
+		return false;
 	}
+	virtual void Apply(const AnimationTransform& Transform) override
+	{
+		if (Target == eAnimationTarget::RenderTransform)
+		{
+			/* Scale, opacity and pivot of the widget are kept. */
+			cbRenderTransform RenderTransform = Widget->GetRenderTransform();
+			RenderTransform.Translation = cbVector(Transform.X, Transform.Y);
+			RenderTransform.Rotation = Transform.Roll;
+			Widget->SetRenderTransform(RenderTransform);
+			return;
+		}
+
+		Widget->SetLocation(cbVector(Transform.X, Transform.Y));
+		Widget->SetRotation(Transform.Roll);
+	}
+	void SetTarget(const eAnimationTarget InTarget) { Target = InTarget; }
+	eAnimationTarget GetTarget() const { return Target; }
 	virtual void Play() override
 	{
 		bIsAnimationActive = true;
@@ -253,6 +391,7 @@ public:
 	virtual void Reset() override
 	{
 		ElapsedTime = 0.0f;
+		Cursor.Reset();
 	}
 	virtual bool IsAnimationEnded() const override
 	{
@@ -273,9 +412,7 @@ public:
 		bIsAnimationActive = false;
 		ElapsedTime = Graph->GetLastKeyFrameTime();
 
-		AnimationTransform Transform = Graph->Get(ElapsedTime);
-		Widget->SetLocation(cbVector(Transform.X, Transform.Y));
-		Widget->SetRotation(Transform.Roll);
+		Apply(Graph->Get(ElapsedTime, Cursor));
 	}
 	virtual void SetLoop(bool value)
 	{
@@ -291,7 +428,9 @@ protected:
 	bool bIsAnimationActive;
 	float ElapsedTime;
 	IAnimationGraph* Graph;
+	AnimationCursor Cursor;
 	T* Widget;
+	eAnimationTarget Target;
 	std::string Name;
 };
 
@@ -316,4 +455,9 @@ public:
 
 protected:
 	std::vector<IAnimationTimeline*> Timelines;
+
+private:
+	/* Timelines evaluated in the current tick. */
+	std::vector<IAnimationTimeline*> ActiveTimelines;
+	AnimationBatchEvaluator BatchEvaluator;
 };
@@ -81,6 +81,8 @@ public:
 		, bStartScreenFadeOut(false)
 		, Time(0.0f)
 	{
+		SetTickEnabled(true);
+
 		{
 			cbgui::cbSizeBox::SharedPtr Empty = cbSizeBox::Create();
 			Empty->SetHorizontalAlignment(eHorizontalAlignment::Align_Fill);
@@ -216,6 +218,8 @@ public:
 		, bIsLeftButtonHovered(false)
 		, bIsRightButtonHovered(false)
 	{
+		SetTickEnabled(true);
+
 		cbOverlay::SharedPtr Overlay = cbOverlay::Create();
 		Overlay->SetVerticalAlignment(eVerticalAlignment::Align_Fill);
 		Overlay->SetHorizontalAlignment(eHorizontalAlignment::Align_Fill);
@@ -1390,6 +1394,8 @@ public:
 		, bAnimationRunning(false)
 		, Time(0.0f)
 	{
+		SetTickEnabled(true);
+
 		cbOverlay::SharedPtr pOverlay = cbOverlay::Create();
 		pOverlay->SetVerticalAlignment(eVerticalAlignment::Align_Fill);
 		pOverlay->SetHorizontalAlignment(eHorizontalAlignment::Align_Fill);
@@ -3061,6 +3067,8 @@ private:
 				, modifier(4)
 				, fCallBack(pfCallBack)
 			{
+				SetTickEnabled(true);
+
 				SetVerticalAlignment(eVerticalAlignment::Align_Fill);
 				SetHorizontalAlignment(eHorizontalAlignment::Align_Fill);
 
@@ -5506,8 +5514,11 @@ DemoCanvas::DemoCanvas(WindowsPlatform* WPlatformOwner)
 	: DemoCanvasBase(WPlatformOwner, cbgui::cbDimension((float)WPlatformOwner->GetWindowWidth(), (float)WPlatformOwner->GetWindowHeight()))
 	, PopupMenu(nullptr)
 {
+	/* The screens are allocated together and released together with the canvas. */
+	cbArenaScope ArenaScope(GetArena());
+
 	{
-		cbgui::cbImage::SharedPtr Image = std::make_shared<cbgui::cbImage>();
+		cbgui::cbImage::SharedPtr Image = cbgui::cbImage::Create();
 		Image->SetName("Start Screen Image");
 		Image->AddToCanvas(this);
 
@@ -5517,7 +5528,7 @@ DemoCanvas::DemoCanvas(WindowsPlatform* WPlatformOwner)
 	}
 
 	{
-		StartScreen = std::make_shared<cbStartScreen>(cbDimension((float)WPlatformOwner->GetWindowWidth(), (float)WPlatformOwner->GetWindowHeight()));
+		StartScreen = cbMakeShared<cbStartScreen>(cbDimension((float)WPlatformOwner->GetWindowWidth(), (float)WPlatformOwner->GetWindowHeight()));
 		StartScreen->AddToCanvas(this);
 		StartScreen->Wrap();
 
@@ -5527,7 +5538,7 @@ DemoCanvas::DemoCanvas(WindowsPlatform* WPlatformOwner)
 	}
 
 	{
-		MainMenu = std::make_shared<cbMainMenu>(cbDimension((float)WPlatformOwner->GetWindowWidth(), (float)WPlatformOwner->GetWindowHeight()));
+		MainMenu = cbMainMenu::Create(cbDimension((float)WPlatformOwner->GetWindowWidth(), (float)WPlatformOwner->GetWindowHeight()));
 		MainMenu->AddToCanvas(this);
 		MainMenu->Wrap();
 
@@ -5598,99 +5609,85 @@ void DemoCanvas::Tick(const float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
-void DemoCanvas::InputProcess(HWND hWnd, std::uint32_t uMsg, WPARAM wParam, LPARAM lParam)
+void DemoCanvas::ProcessInput(const cbInputEvent& Event)
 {
-	auto GetMouseLocation = [&]() -> cbVector
+	switch (Event.Type)
 	{
-		POINT point;
-		GetCursorPos(&point);
-		ScreenToClient(hWnd, &point);
-
-		return cbVector(static_cast<float>(point.x), static_cast<float>(point.y));
-	};
-
-	if (uMsg)
+	case eInputEventType::KeyDown:
 	{
-		switch (uMsg)
+		if (StartScreen)
 		{
-		case WM_SYSKEYUP:
-			break;
-		case WM_SYSKEYDOWN:
-			break;
-		case WM_KEYDOWN:
-		{
-			int iKeyPressed = static_cast<int>(wParam);
-
-			if (StartScreen)
-			{
-				if (!StartScreen->IsStartScreenFadeOut())
-					StartScreen->FadeOut();
-			}
-
-			break;
+			if (!StartScreen->IsStartScreenFadeOut())
+				StartScreen->FadeOut();
 		}
-		case WM_MOUSEWHEEL:
+
+		Super::ProcessInput(Event);
+		break;
+	}
+	case eInputEventType::Char:
+	case eInputEventType::KeyUp:
+		Super::ProcessInput(Event);
+		break;
+	case eInputEventType::MouseWheel:
+	{
+		if (Focus)
 		{
-			if (Focus)
+			if (Focus->IsEnabled())
 			{
-				if (Focus->IsEnabled())
-				{
-					cbMouseInput MouseInput;
-					const float SpinFactor = 1.0f / 120.0f;
-					const SHORT WheelDelta = GET_WHEEL_DELTA_WPARAM(wParam);
+				const cbMouseInput MouseInput(Event);
+				const float SpinFactor = 1.0f / 120.0f;
 
-					MouseInput.MouseLocation = GetMouseLocation();
-
-					if (Focus->IsInside(MouseInput.MouseLocation))
-					{
-						Focus->OnMouseWheel(static_cast<float>(WheelDelta) * SpinFactor, MouseInput);
-					}
+				if (Focus->IsInside(MouseInput.MouseLocation))
+				{
+					Focus->OnMouseWheel(Event.WheelDelta * SpinFactor, MouseInput);
 				}
-
-				return;
 			}
-			break;
-		}
-		case WM_MOUSEMOVE:
-		{
-			cbMouseInput MouseInput;
-			MouseInput.State = cbMouseState::Moving;
-			MouseInput.MouseLocation = GetMouseLocation();
 
-			if (Focus)
-			{
-				if (!Focus->IsFocused())
-					Focus->OnMouseEnter(MouseInput);
-				else
-					Focus->OnMouseMove(MouseInput);
-			}
+			return;
 		}
 		break;
+	}
+	case eInputEventType::MouseMove:
+	{
+		const cbMouseInput MouseInput(Event);
 
-		case WM_LBUTTONDOWN:
+		if (Focus)
 		{
-			cbMouseInput MouseInput;
-			MouseInput.Buttons["Left"] = cbMouseButtonState::Pressed;
-			MouseInput.MouseLocation = GetMouseLocation();
-			if (Focus->IsFocused())
-			{
-				Focus->OnMouseButtonDown(MouseInput);
-			}
-			break;
+			if (!Focus->IsFocused())
+				Focus->OnMouseEnter(MouseInput);
+			else
+				Focus->OnMouseMove(MouseInput);
 		}
-		case WM_LBUTTONUP:
-		{
-			cbMouseInput MouseInput;
-			MouseInput.Buttons["Left"] = cbMouseButtonState::Released;
-			MouseInput.MouseLocation = GetMouseLocation();
+	}
+	break;
 
-			if (Focus->IsFocused())
-			{
-				Focus->OnMouseButtonUp(MouseInput);
-			}
+	case eInputEventType::MouseButtonDown:
+	{
+		if (Event.Button != eMouseButton::Left)
 			break;
+
+		const cbMouseInput MouseInput(Event);
+		if (Focus->IsFocused())
+		{
+			Focus->OnMouseButtonDown(MouseInput);
 		}
+		break;
+	}
+	case eInputEventType::MouseButtonUp:
+	{
+		if (Event.Button != eMouseButton::Left)
+			break;
+
+		const cbMouseInput MouseInput(Event);
+
+		if (Focus->IsFocused())
+		{
+			Focus->OnMouseButtonUp(MouseInput);
 		}
+		break;
+	}
+	default:
+		break;
 	}
 }
 
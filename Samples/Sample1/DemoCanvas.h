@@ -37,7 +37,7 @@ public:
 	virtual void SetMaterial(WidgetHierarchy* pWP) override final;
 	virtual void Tick(const float DeltaTime);
 
-	virtual void InputProcess(HWND hWnd, std::uint32_t uMsg, WPARAM wParam, LPARAM lParam) override final;
+	virtual void ProcessInput(const cbInputEvent& Event) override final;
 
 	virtual void ResizeWindow(std::size_t Width, std::size_t Height) override final;
 
@@ -26,6 +26,7 @@
 
 #include "pch.h"
 #include "DemoCanvasBase.h"
+#include "cbString.h"
 
 #define CanvasConsole(x) std::cout << x << std::endl;
 
@@ -35,6 +36,7 @@ DemoCanvasBase::DemoCanvasBase(WindowsPlatform* WPlatformOwner)
 	, PrevVertexOffset(0)
 	, PrevIndexOffset(0)
 	, Animation(cbAnimation::Create())
+	, Arena(cbArena::Create())
 {
 	Transform.SetLocation(cbVector((float)WPlatformOwner->GetWindowWidth() / 2.0f, (float)WPlatformOwner->GetWindowHeight() / 2.0f));
 
@@ -58,6 +60,7 @@ DemoCanvasBase::DemoCanvasBase(WindowsPlatform* WPlatformOwner, const cbDimensio
 	, PrevVertexOffset(0)
 	, PrevIndexOffset(0)
 	, Animation(cbAnimation::Create())
+	, Arena(cbArena::Create())
 {
 	Transform.SetLocation(cbVector(WPlatformOwner->GetWindowWidth() / 2.0f, WPlatformOwner->GetWindowHeight() / 2.0f));
 
@@ -91,6 +94,7 @@ DemoCanvasBase::~DemoCanvasBase()
 	Hierarchy.clear();
 
 	WidgetsList.clear();
+	TickList.Clear();
 
 	VertexBuffer = nullptr;
 	IndexBuffer = nullptr;
@@ -108,8 +112,11 @@ void DemoCanvasBase::BeginPlay()
 
 void DemoCanvasBase::Tick(const float DeltaTime)
 {
-	for (auto& Obj : Widgets)
-		Obj->Tick(DeltaTime);
+	cbFontResources::Get().BeginFrame();
+
+	InputQueue.Dispatch([&](const cbInputEvent& Event) { ProcessInput(Event); });
+
+	TickList.Tick(DeltaTime);
 
 	Animation->Tick(DeltaTime);
 }
@@ -125,20 +132,66 @@ void DemoCanvasBase::ResizeWindow(std::size_t Width, std::size_t Height)
 
 void DemoCanvasBase::InputProcess(HWND hWnd, std::uint32_t uMsg, WPARAM wParam, LPARAM lParam)
 {
-	auto GetMouseLocation = [&]() -> cbVector
+	/* Client space location of the mouse messages, the wheel message has the screen location. */
+	auto GetMouseLocation = [&](const bool bScreenSpace) -> cbVector
 	{
 		POINT point;
-		GetCursorPos(&point);
-		ScreenToClient(hWnd, &point);
+		point.x = static_cast<short>(LOWORD(lParam));
+		point.y = static_cast<short>(HIWORD(lParam));
+		if (bScreenSpace)
+			ScreenToClient(hWnd, &point);
 
 		return cbVector(static_cast<float>(point.x), static_cast<float>(point.y));
 	};
 
-	cbMouseInput MouseInput;
+	auto GetMouseButtons = [&]() -> std::uint8_t
+	{
+		const WPARAM Keys = GET_KEYSTATE_WPARAM(wParam);
+		std::uint8_t Buttons = 0;
+		if (Keys & MK_LBUTTON)
+			Buttons |= (std::uint8_t)eMouseButton::Left;
+		if (Keys & MK_RBUTTON)
+			Buttons |= (std::uint8_t)eMouseButton::Right;
+		if (Keys & MK_MBUTTON)
+			Buttons |= (std::uint8_t)eMouseButton::Middle;
+		if (Keys & MK_XBUTTON1)
+			Buttons |= (std::uint8_t)eMouseButton::XB1;
+		if (Keys & MK_XBUTTON2)
+			Buttons |= (std::uint8_t)eMouseButton::XB2;
+		return Buttons;
+	};
+
+	auto GetModifiers = [&]() -> std::uint8_t
+	{
+		std::uint8_t Modifiers = 0;
+		if ((GetKeyState(VK_SHIFT) & 0x8000) != 0)
+			Modifiers |= (std::uint8_t)eInputModifier::Shift;
+		if ((GetKeyState(VK_CONTROL) & 0x8000) != 0)
+			Modifiers |= (std::uint8_t)eInputModifier::Control;
+		if ((GetKeyState(VK_MENU) & 0x8000) != 0)
+			Modifiers |= (std::uint8_t)eInputModifier::Alt;
+		return Modifiers;
+	};
 
-	std::int32_t WheelDelta = 0;
+	auto PushMouseEvent = [&](const eInputEventType Type, const eMouseButton Button)
+	{
+		cbInputEvent Event(Type);
+		Event.Button = Button;
+		Event.Buttons = GetMouseButtons();
+		Event.Modifiers = GetModifiers();
+		Event.SetLocation(GetMouseLocation(false));
+		Event.Timestamp = static_cast<std::uint64_t>(GetMessageTime());
+		InputQueue.Push(Event);
+	};
 
-	//std::cout << GetMouseLocation().ToString() << std::endl;
+	auto PushKeyEvent = [&](const eInputEventType Type, const std::uint64_t KeyCode)
+	{
+		cbInputEvent Event(Type);
+		Event.KeyCode = KeyCode;
+		Event.Modifiers = GetModifiers();
+		Event.Timestamp = static_cast<std::uint64_t>(GetMessageTime());
+		InputQueue.Push(Event);
+	};
 
 	if (uMsg)
 	{
@@ -149,213 +202,200 @@ void DemoCanvasBase::InputProcess(HWND hWnd, std::uint32_t uMsg, WPARAM wParam,
 		case WM_SYSKEYDOWN:
 			break;
 		case WM_KEYDOWN:
-		{
-
-		}
-		break;
+			PushKeyEvent(eInputEventType::KeyDown, static_cast<std::uint64_t>(wParam));
+			break;
 		case WM_CHAR:
 		{
-			if (!KeyboardBTNEvent.bIsPressed)
-				return;
-
 			int iKeyPressed = static_cast<int>(wParam);
 
-			if (iKeyPressed < 32)
-			{
-				KeyboardBTNEvent.KeyCode = iKeyPressed;
-				for (auto& Obj : Widgets)
-					Obj->OnKeyDown(KeyboardBTNEvent.KeyCode);
-				return;
-			}
-
-			if ((GetAsyncKeyState(VK_CAPITAL) & 0x0001) == 0)
+			if (iKeyPressed >= 32)
 			{
-				iKeyPressed = towlower(iKeyPressed);
+				if ((GetAsyncKeyState(VK_CAPITAL) & 0x0001) == 0)
+				{
+					iKeyPressed = towlower(iKeyPressed);
 
-				if ((GetAsyncKeyState(VK_SHIFT) & 0x8000) != 0)
-					iKeyPressed = towupper(iKeyPressed);
+					if ((GetAsyncKeyState(VK_SHIFT) & 0x8000) != 0)
+						iKeyPressed = towupper(iKeyPressed);
+				}
+				else if ((GetAsyncKeyState(VK_SHIFT) & 0x8000) != 0)
+					iKeyPressed = towlower(iKeyPressed);
 			}
-			else if ((GetAsyncKeyState(VK_SHIFT) & 0x8000) != 0)
-				iKeyPressed = towlower(iKeyPressed);
-
-			KeyboardBTNEvent.KeyCode = iKeyPressed;
 
-			for (auto& Obj : Widgets)
-				Obj->OnKeyDown(KeyboardBTNEvent.KeyCode);
+			PushKeyEvent(eInputEventType::Char, static_cast<std::uint64_t>(iKeyPressed));
 		}
 		break;
 		case WM_KEYUP:
-			KeyboardBTNEvent.bIsPressed = false;
-
-			for (auto& Obj : Widgets)
-				Obj->OnKeyUp(KeyboardBTNEvent.KeyCode);
-
+			PushKeyEvent(eInputEventType::KeyUp, static_cast<std::uint64_t>(wParam));
 			break;
 		case WM_LBUTTONDOWN:
-			MouseInput.Buttons["Left"] = cbMouseButtonState::Pressed;
-			MouseInput.MouseLocation = GetMouseLocation();
-			if (FocusedObj)
-			{
-				if (!FocusedObj->OnMouseButtonDown(MouseInput))
-					FocusedObj = nullptr;
-			}
-			else
-			{
-				return;
-			}
+			PushMouseEvent(eInputEventType::MouseButtonDown, eMouseButton::Left);
 			break;
 		case WM_LBUTTONUP:
-			MouseInput.Buttons["Left"] = cbMouseButtonState::Released;
-			MouseInput.MouseLocation = GetMouseLocation();
-			if (FocusedObj)
-			{
-				if (FocusedObj->OnMouseButtonUp(MouseInput))
-				{
-					if (FocusedObj->IsFocused())
-					{
-						if (!FocusedObj->IsInside(MouseInput.MouseLocation))
-						{
-							if (FocusedObj->OnMouseLeave(MouseInput))
-								FocusedObj = nullptr;
-						}
-						else
-						{
-							return;
-						}
-					}
-					else
-					{
-						FocusedObj = nullptr;
-					}
-				}
-			}
-			break;
-		case WM_RBUTTONDOWN:
-			MouseInput.Buttons["Right"] = cbMouseButtonState::Pressed;
-			MouseInput.MouseLocation = GetMouseLocation();
+			PushMouseEvent(eInputEventType::MouseButtonUp, eMouseButton::Left);
 			break;
 		case WM_LBUTTONDBLCLK:
+			PushMouseEvent(eInputEventType::MouseButtonDoubleClick, eMouseButton::Left);
+			break;
+		case WM_RBUTTONDOWN:
+			PushMouseEvent(eInputEventType::MouseButtonDown, eMouseButton::Right);
 			break;
 		case WM_RBUTTONUP:
-			MouseInput.Buttons["Right"] = cbMouseButtonState::Released;
-			MouseInput.MouseLocation = GetMouseLocation();
+			PushMouseEvent(eInputEventType::MouseButtonUp, eMouseButton::Right);
 			break;
 		case WM_MBUTTONDOWN:
-			MouseInput.Buttons["Middle"] = cbMouseButtonState::Pressed;
-			MouseInput.MouseLocation = GetMouseLocation();
+			PushMouseEvent(eInputEventType::MouseButtonDown, eMouseButton::Middle);
 			break;
 		case WM_MBUTTONUP:
-			MouseInput.Buttons["Middle"] = cbMouseButtonState::Released;
-			MouseInput.MouseLocation = GetMouseLocation();
+			PushMouseEvent(eInputEventType::MouseButtonUp, eMouseButton::Middle);
 			break;
 		case WM_XBUTTONDOWN:
-			switch (GET_XBUTTON_WPARAM(wParam))
-			{
-			case XBUTTON1:
-				MouseInput.Buttons["XB1"] = cbMouseButtonState::Pressed;
-				break;
-
-			case XBUTTON2:
-				MouseInput.Buttons["XB2"] = cbMouseButtonState::Pressed;
-				break;
-			}
+			PushMouseEvent(eInputEventType::MouseButtonDown, GET_XBUTTON_WPARAM(wParam) == XBUTTON1 ? eMouseButton::XB1 : eMouseButton::XB2);
 			break;
-
 		case WM_XBUTTONUP:
-			switch (GET_XBUTTON_WPARAM(wParam))
-			{
-			case XBUTTON1:
-				MouseInput.Buttons["XB1"] = cbMouseButtonState::Released;
-				break;
-
-			case XBUTTON2:
-				MouseInput.Buttons["XB2"] = cbMouseButtonState::Released;
-				break;
-			}
+			PushMouseEvent(eInputEventType::MouseButtonUp, GET_XBUTTON_WPARAM(wParam) == XBUTTON1 ? eMouseButton::XB1 : eMouseButton::XB2);
 			break;
 		case WM_MOUSEWHEEL:
 		{
-			if (FocusedObj)
-			{
-				MouseInput.MouseLocation = GetMouseLocation();
-
-				if (FocusedObj->IsInside(MouseInput.MouseLocation))
-					FocusedObj->OnMouseWheel(GET_WHEEL_DELTA_WPARAM(wParam), MouseInput);
-				return;
-			}
+			cbInputEvent Event(eInputEventType::MouseWheel);
+			Event.Buttons = GetMouseButtons();
+			Event.Modifiers = GetModifiers();
+			Event.SetLocation(GetMouseLocation(true));
+			Event.WheelDelta = static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam));
+			Event.Timestamp = static_cast<std::uint64_t>(GetMessageTime());
+			InputQueue.Push(Event);
 			break;
 		}
 		case WM_MOUSEMOVE:
-		{
-			MouseInput.State = cbMouseState::Moving;
-			MouseInput.MouseLocation = GetMouseLocation();
+			PushMouseEvent(eInputEventType::MouseMove, eMouseButton::None);
+			break;
+		}
+	}
+}
 
-			/*{
-				cbBounds Bounds = cbBounds(cbDimension(5.0f, 5.0f), MouseInput.MouseLocation);
-				auto OverlappingObjects = GetRawOverlappingObjects(Bounds);
+void DemoCanvasBase::ProcessInput(const cbInputEvent& Event)
+{
+	const cbMouseInput MouseInput(Event);
 
-				for (auto& Obj : OverlappingObjects)
-				{
-					CanvasConsole(Obj->GetClassID());
-				}
-			}*/
+	switch (Event.Type)
+	{
+	case eInputEventType::KeyDown:
+		/* The character of the key is dispatched with the Char event, unless a shortcut handles the key. */
+		KeyboardBTNEvent.bIsPressed = !KeyDispatcher.ExecuteShortcut(Event.KeyCode, Event.Modifiers);
+		break;
+	case eInputEventType::Char:
+	{
+		if (!KeyboardBTNEvent.bIsPressed)
+			return;
+
+		KeyboardBTNEvent.KeyCode = Event.KeyCode;
+		KeyDispatcher.KeyDown(KeyboardBTNEvent.KeyCode);
+	}
+	break;
+	case eInputEventType::KeyUp:
+		if (!KeyboardBTNEvent.bIsPressed)
+			return;
+
+		KeyboardBTNEvent.bIsPressed = false;
+		KeyDispatcher.KeyUp(KeyboardBTNEvent.KeyCode);
+		break;
+	case eInputEventType::MouseButtonDown:
+		if (Event.Button != eMouseButton::Left)
+			break;
 
-			if (FocusedObj)
+		if (FocusedObj)
+		{
+			if (!FocusedObj->OnMouseButtonDown(MouseInput))
+				FocusedObj = nullptr;
+		}
+		break;
+	case eInputEventType::MouseButtonUp:
+		if (Event.Button != eMouseButton::Left)
+			break;
+
+		if (FocusedObj)
+		{
+			if (FocusedObj->OnMouseButtonUp(MouseInput))
 			{
-				if (FocusedObj->IsInside(MouseInput.MouseLocation))
+				if (FocusedObj->IsFocused())
 				{
-					FocusedObj->OnMouseMove(MouseInput);
-					//CanvasConsole("OnMouseMove");
-					return;
+					if (!FocusedObj->IsInside(MouseInput.MouseLocation))
+					{
+						if (FocusedObj->OnMouseLeave(MouseInput))
+							FocusedObj = nullptr;
+					}
 				}
 				else
 				{
-					if (FocusedObj->OnMouseLeave(MouseInput))
-					{
-						//CanvasConsole("OnMouseMove/OnMouseLeave");
-						FocusedObj = nullptr;
-					}
-					else
-					{
-						FocusedObj->OnMouseMove(MouseInput);
-						//CanvasConsole("OnMouseMove");
-						return;
-					}
+					FocusedObj = nullptr;
 				}
 			}
-
-			cbWidget* Focus = nullptr;
-
-			for (auto& Obj : Widgets)
+		}
+		break;
+	case eInputEventType::MouseButtonDoubleClick:
+		break;
+	case eInputEventType::MouseWheel:
+	{
+		if (FocusedObj)
+		{
+			if (FocusedObj->IsInside(MouseInput.MouseLocation))
+				FocusedObj->OnMouseWheel(Event.WheelDelta, MouseInput);
+		}
+		break;
+	}
+	case eInputEventType::MouseMove:
+	{
+		if (FocusedObj)
+		{
+			if (FocusedObj->IsInside(MouseInput.MouseLocation))
 			{
-				if (Obj->IsInside(MouseInput.MouseLocation))
-				{
-					if (Obj->IsFocusable())
-						Focus = Obj.get();
-				}
-				else if (Obj->IsFocused())
-				{
-					Obj->OnMouseLeave(MouseInput);
-				}
+				FocusedObj->OnMouseMove(MouseInput);
+				return;
 			}
-
-			if (Focus)
+			else
 			{
-				if (FocusedObj && FocusedObj != Focus)
+				if (FocusedObj->OnMouseLeave(MouseInput))
 				{
-					FocusedObj->OnMouseLeave(MouseInput);
 					FocusedObj = nullptr;
 				}
+				else
+				{
+					FocusedObj->OnMouseMove(MouseInput);
+					return;
+				}
+			}
+		}
 
-				if (!Focus->OnMouseEnter(MouseInput))
-					Focus = nullptr;
+		cbWidget* Focus = nullptr;
 
-				FocusedObj = Focus;
+		for (auto& Obj : Widgets)
+		{
+			if (Obj->IsInside(MouseInput.MouseLocation))
+			{
+				if (Obj->IsFocusable())
+					Focus = Obj.get();
+			}
+			else if (Obj->IsFocused())
+			{
+				Obj->OnMouseLeave(MouseInput);
 			}
 		}
-		break;
+
+		if (Focus)
+		{
+			if (FocusedObj && FocusedObj != Focus)
+			{
+				FocusedObj->OnMouseLeave(MouseInput);
+				FocusedObj = nullptr;
+			}
+
+			if (!Focus->OnMouseEnter(MouseInput))
+				Focus = nullptr;
+
+			FocusedObj = Focus;
 		}
 	}
+	break;
+	}
 }
 
 void DemoCanvasBase::ReuploadGeometry()
@@ -384,7 +424,11 @@ void DemoCanvasBase::SetScreenDimension(const cbDimension& pScreenDimension)
 	for (const auto& Obj : Widgets)
 	{
 		if (Obj->IsAlignedToCanvas())
+		{
+			/* The culled bounds depend on the screen bounds even if the alignment is unchanged. */
+			Obj->InvalidateWorldCache();
 			Obj->UpdateAlignments();
+		}
 	}
 }
 
@@ -491,12 +535,8 @@ void DemoCanvasBase::Add(const std::shared_ptr<cbWidget>& Widget)
 	{
 		if (pWidget->HasAnyChildren())
 		{
-			const auto& Children = pWidget->GetAllChildren();
-			for (const auto& Child : Children)
+			pWidget->ForEachChild([&](cbWidgetObj* Child)
 			{
-				if (!Child)
-					continue;
-
 				WidgetHierarchy* pHierarchy = new WidgetHierarchy;
 				pHierarchy->Widget = Child;
 				SetVertexOffset(pHierarchy);
@@ -507,7 +547,7 @@ void DemoCanvasBase::Add(const std::shared_ptr<cbWidget>& Widget)
 				WidgetsList.insert({ Child, pHierarchy });
 				SetHierarchy(pHierarchy, Child);
 				pWidgetHierarchy->Nodes.push_back(pHierarchy);
-			}
+			});
 		}
 	};
 
@@ -522,6 +562,7 @@ void DemoCanvasBase::Add(const std::shared_ptr<cbWidget>& Widget)
 	SetHierarchy(mWidgetHierarchy, Widget.get());
 
 	Hierarchy.push_back(mWidgetHierarchy);
+	TickList.UpdateHierarchy(Widget.get());
 
 	SortWidgetsByZOrder();
 }
@@ -543,6 +584,32 @@ void DemoCanvasBase::WidgetUpdated(cbWidgetObj* Object)
 		It->second->bVertexDirty = true;
 }
 
+void DemoCanvasBase::WidgetColorUpdated(cbWidgetObj* Object)
+{
+	const auto& It = WidgetsList.find(Object);
+	if (It != WidgetsList.end())
+		It->second->bColorDirty = true;
+}
+
+void DemoCanvasBase::WidgetVerticesUpdated(cbWidgetObj* Object, const std::size_t FirstVertex, const std::size_t VertexCount)
+{
+	const auto& It = WidgetsList.find(Object);
+	if (It == WidgetsList.end())
+		return;
+
+	WidgetHierarchy* Node = It->second;
+	if (Node->DirtyVertexEnd > Node->DirtyVertexBegin)
+	{
+		Node->DirtyVertexBegin = std::min(Node->DirtyVertexBegin, FirstVertex);
+		Node->DirtyVertexEnd = std::max(Node->DirtyVertexEnd, FirstVertex + VertexCount);
+	}
+	else
+	{
+		Node->DirtyVertexBegin = FirstVertex;
+		Node->DirtyVertexEnd = FirstVertex + VertexCount;
+	}
+}
+
 void DemoCanvasBase::RemoveFromCanvas(cbWidget* Object)
 {
 	cbWidget::SharedPtr Widget = nullptr;
@@ -581,6 +648,7 @@ void DemoCanvasBase::RemoveFromCanvas(cbWidget* Object)
 
 		if (pHierarchy)
 		{
+			HierarchyRemoved(pHierarchy);
 			delete pHierarchy;
 			pHierarchy = nullptr;
 		}
@@ -592,15 +660,11 @@ void DemoCanvasBase::RemoveFromCanvas(cbWidget* Object)
 		{
 			if (pWidget->HasAnyChildren())
 			{
-				const auto& Children = pWidget->GetAllChildren();
-				for (const auto& Child : Children)
+				pWidget->ForEachChild([&](cbWidgetObj* Child)
 				{
-					if (!Child)
-						continue;
-
 					WidgetsList.erase(Child);
 					Remove(Child);
-				}
+				});
 			}
 		};
 		Remove(Widget.get());
@@ -619,12 +683,8 @@ void DemoCanvasBase::NewSlotAdded(cbSlottedBox* Parent, cbSlot* Slot)
 	{
 		if (pWidget->HasAnyChildren())
 		{
-			const auto& Children = pWidget->GetAllChildren();
-			for (const auto& Child : Children)
+			pWidget->ForEachChild([&](cbWidgetObj* Child)
 			{
-				if (!Child)
-					continue;
-
 				WidgetHierarchy* pHierarchy = new WidgetHierarchy;
 				pHierarchy->Widget = Child;
 				SetVertexOffset(pHierarchy);
@@ -635,7 +695,7 @@ void DemoCanvasBase::NewSlotAdded(cbSlottedBox* Parent, cbSlot* Slot)
 				SetHierarchy(pHierarchy, Child);
 				WidgetsList.insert({ Child, pHierarchy });
 				pWidgetHierarchy->Nodes.push_back(pHierarchy);
-			}
+			});
 		}
 	};
 
@@ -684,6 +744,7 @@ void DemoCanvasBase::NewSlotAdded(cbSlottedBox* Parent, cbSlot* Slot)
 
 		pWH->Nodes.push_back(mWidgetHierarchy);
 		WidgetsList.insert({ Slot, mWidgetHierarchy });
+		TickList.UpdateHierarchy(Slot);
 	}
 }
 
@@ -694,12 +755,8 @@ void DemoCanvasBase::NewSlotContentAdded(cbSlot* Parent, cbWidget* Content)
 	{
 		if (pWidget->HasAnyChildren())
 		{
-			const auto& Children = pWidget->GetAllChildren();
-			for (const auto& Child : Children)
+			pWidget->ForEachChild([&](cbWidgetObj* Child)
 			{
-				if (!Child)
-					continue;
-
 				WidgetHierarchy* pHierarchy = new WidgetHierarchy;
 				pHierarchy->Widget = Child;
 				SetVertexOffset(pHierarchy);
@@ -710,7 +767,7 @@ void DemoCanvasBase::NewSlotContentAdded(cbSlot* Parent, cbWidget* Content)
 				SetHierarchy(pHierarchy, Child);
 				WidgetsList.insert({ Child, pHierarchy });
 				pWidgetHierarchy->Nodes.push_back(pHierarchy);
-			}
+			});
 		}
 	};
 
@@ -759,6 +816,7 @@ void DemoCanvasBase::NewSlotContentAdded(cbSlot* Parent, cbWidget* Content)
 
 		pWH->Nodes.push_back(mWidgetHierarchy);
 		WidgetsList.insert({ Content, mWidgetHierarchy });
+		TickList.UpdateHierarchy(Content);
 	}
 }
 
@@ -820,15 +878,11 @@ void DemoCanvasBase::SlotRemoved(cbSlottedBox* Parent, cbSlot* Slot)
 				{
 					if (pWidget->HasAnyChildren())
 					{
-						const auto& Children = pWidget->GetAllChildren();
-						for (const auto& Child : Children)
+						pWidget->ForEachChild([&](cbWidgetObj* Child)
 						{
-							if (!Child)
-								continue;
-
 							WidgetsList.erase(Child);
 							Remove(Child);
-						}
+						});
 					}
 				};
 				Remove(pHierarchy->Widget);
@@ -836,6 +890,7 @@ void DemoCanvasBase::SlotRemoved(cbSlottedBox* Parent, cbSlot* Slot)
 			}
 			if (pHierarchy)
 			{
+				HierarchyRemoved(pHierarchy);
 				delete pHierarchy;
 				pHierarchy = nullptr;
 			}
@@ -887,12 +942,8 @@ void DemoCanvasBase::SlotContentReplaced(cbSlot* Parent, cbWidget* Old, cbWidget
 			{
 				if (pWidget->HasAnyChildren())
 				{
-					const auto& Children = pWidget->GetAllChildren();
-					for (const auto& Child : Children)
+					pWidget->ForEachChild([&](cbWidgetObj* Child)
 					{
-						if (!Child)
-							continue;
-
 						WidgetHierarchy* pHierarchy = new WidgetHierarchy;
 						pHierarchy->Widget = Child;
 						SetVertexOffset(pHierarchy);
@@ -903,7 +954,7 @@ void DemoCanvasBase::SlotContentReplaced(cbSlot* Parent, cbWidget* Old, cbWidget
 						SetHierarchy(pHierarchy, Child);
 						pWidgetHierarchy->Nodes.push_back(pHierarchy);
 						WidgetsList.insert({ Child, pHierarchy });
-					}
+					});
 				}
 			};
 
@@ -927,6 +978,7 @@ void DemoCanvasBase::SlotContentReplaced(cbSlot* Parent, cbWidget* Old, cbWidget
 
 			if (pHierarchy)
 			{
+				HierarchyRemoved(pHierarchy);
 				delete pHierarchy;
 				pHierarchy = nullptr;
 			}
@@ -942,6 +994,7 @@ void DemoCanvasBase::SlotContentReplaced(cbSlot* Parent, cbWidget* Old, cbWidget
 
 			pWH->Nodes.push_back(mWidgetHierarchy);
 			WidgetsList.insert({ New, mWidgetHierarchy });
+			TickList.UpdateHierarchy(New);
 		}
 	}
 
@@ -953,6 +1006,38 @@ void DemoCanvasBase::VerticesSizeChanged(cbWidgetObj* Object, const std::size_t
 	ReorderWidgets();
 }
 
+void DemoCanvasBase::RenderTransformUpdated(cbWidgetObj* Object)
+{
+	const auto& It = WidgetsList.find(Object);
+	if (It == WidgetsList.end())
+		return;
+
+	std::function<void(WidgetHierarchy*)> fUpdateCulling;
+	fUpdateCulling = [&](WidgetHierarchy* Node)
+	{
+		if (Node->Widget->IsItCulled() != Node->bIsCulled)
+			Node->bVertexDirty = true;
+
+		for (const auto& Child : Node->Nodes)
+			fUpdateCulling(Child);
+	};
+	fUpdateCulling(It->second);
+}
+
+void DemoCanvasBase::TickUpdated(cbWidgetObj* Object)
+{
+	if (WidgetsList.find(Object) != WidgetsList.end())
+		TickList.Update(Object);
+}
+
+void DemoCanvasBase::HierarchyRemoved(WidgetHierarchy* pWH)
+{
+	TickList.Unregister(pWH->Widget);
+	KeyDispatcher.WidgetRemoved(pWH->Widget);
+	for (const auto& Node : pWH->Nodes)
+		HierarchyRemoved(Node);
+}
+
 std::vector<cbWidget*> DemoCanvasBase::GetOverlappingWidgets(const cbBounds& Bounds) const
 {
 	std::vector<cbWidget*> UIObjects;
@@ -45,11 +45,16 @@ public:
 
 	virtual void ResizeWindow(std::size_t Width, std::size_t Height) override;
 
-	virtual void InputProcess(HWND hWnd, std::uint32_t uMsg, WPARAM wParam, LPARAM lParam);
+	/* Translates the window messages into input events, the events are dispatched on the next tick. */
+	virtual void InputProcess(HWND hWnd, std::uint32_t uMsg, WPARAM wParam, LPARAM lParam) override final;
+	virtual void ProcessInput(const cbInputEvent& Event);
 
 	virtual std::string GetName() const override { return Name; }
 	void SetName(const std::string& name) { Name = name; }
 
+	/* Memory of the screens built by the canvas, bind it with cbArenaScope. */
+	const cbArena::SharedPtr& GetArena() const { return Arena; }
+
 	virtual cbVector GetCenter() const override { return Transform.GetCenter(); }
 	virtual cbBounds GetScreenBounds() const override { return Transform.GetBounds(); }
 	virtual float GetScreenRotation() const override { return Transform.GetRotation(); }
@@ -65,14 +70,20 @@ public:
 	virtual void RemoveFromCanvas(cbWidget* Object) override;
 
 	virtual void WidgetUpdated(cbWidgetObj* Object) override;
+	virtual void WidgetColorUpdated(cbWidgetObj* Object) override;
+	virtual void WidgetVerticesUpdated(cbWidgetObj* Object, const std::size_t FirstVertex, const std::size_t VertexCount) override;
 
 	virtual void NewSlotAdded(cbSlottedBox* Parent, cbSlot* Slot) override;
 	virtual void SlotRemoved(cbSlottedBox* Parent, cbSlot* Slot) override;
 	virtual void SlotContentReplaced(cbSlot* Parent, cbWidget* Old, cbWidget* New) override;
 
 	virtual void VisibilityChanged(cbWidgetObj* Object) override {}
+	virtual void FocusChanged(cbWidget* Object) override { KeyDispatcher.FocusChanged(Object); }
 
 	virtual void VerticesSizeChanged(cbWidgetObj* Object, const std::size_t NewSize) override;
+	/* The renderer reads the render matrix every frame, only the widgets that enter or leave the culled area are rebuilt. */
+	virtual void RenderTransformUpdated(cbWidgetObj* Object) override;
+	virtual void TickUpdated(cbWidgetObj* Object) override;
 
 	virtual void NewSlotContentAdded(cbSlot* Parent, cbWidget* Content);
 
@@ -85,6 +96,8 @@ public:
 	virtual AIndexBuffer* GetIndexBuffer() const override { return IndexBuffer.get(); }
 
 	cbAnimation* GetAnimation() const { return Animation.get(); }
+	/* Keyboard focus and the global shortcuts. */
+	cbKeyDispatcher* GetKeyDispatcher() { return &KeyDispatcher; }
 
 	/*
 	* Set material by class ID, geometry component name, or geometry type.
@@ -99,6 +112,9 @@ private:
 	void SetVertexOffset(WidgetHierarchy* pWP);
 	void SetIndexOffset(WidgetHierarchy* pWP);
 
+	/* Removes the widgets of the hierarchy from the tick list and the keyboard focus. */
+	void HierarchyRemoved(WidgetHierarchy* pWH);
+
 private:
 	cbgui::cbTransform Transform;
 
@@ -107,11 +123,14 @@ private:
 	std::string Name;
 
 	std::shared_ptr<cbAnimation> Animation;
+	cbArena::SharedPtr Arena;
 
 	std::vector<cbWidget::SharedPtr> Widgets;
 	std::vector<WidgetHierarchy*> Hierarchy;
 
 	std::map<cbWidgetObj*, WidgetHierarchy*> WidgetsList;
+	/* Only the widgets that enabled ticking, the hierarchy is not traversed every frame. */
+	cbTickList TickList;
 
 	std::size_t PrevVertexOffset;
 	std::size_t PrevIndexOffset;
@@ -120,4 +139,6 @@ private:
 	std::unique_ptr<AIndexBuffer> IndexBuffer;
 
 	cbKeyboardChar KeyboardBTNEvent;
+	cbInputQueue InputQueue;
+	cbKeyDispatcher KeyDispatcher;
 };
@@ -66,6 +66,18 @@ public:
 		cbgui::cbWidgetObj* Widget;
 		bool bVertexDirty = true;
 		bool bIndexDirty = true;
+		/* Only the vertex colors are patched, see cbWidgetObj::GetVertexColor. */
+		bool bColorDirty = false;
+		/* Culled state of the uploaded vertices, a render transform that changes it rebuilds them. */
+		bool bIsCulled = false;
+		/* Vertex range patched in place, see cbWidgetObj::GetVertexRangeData. Empty when Begin == End. */
+		std::size_t DirtyVertexBegin = 0;
+		std::size_t DirtyVertexEnd = 0;
+		/*
+		* Copy of the uploaded vertices, kept only for single colored geometry.
+		* A color change patches it and uploads the range of the widget once.
+		*/
+		std::vector<cbgui::cbGeometryVertexData> Vertices;
 		std::optional<std::string> MaterialName;
 		GeometryDrawParams DrawParams;
 
@@ -74,6 +86,10 @@ public:
 			, MaterialName(std::nullopt)
 			, bVertexDirty(true)
 			, bIndexDirty(true)
+			, bColorDirty(false)
+			, bIsCulled(false)
+			, DirtyVertexBegin(0)
+			, DirtyVertexEnd(0)
 		{}
 
 		~WidgetHierarchy()
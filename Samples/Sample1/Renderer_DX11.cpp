@@ -63,10 +63,16 @@ __declspec(align(64)) struct CBGradientIdxDx11
 struct OnScreenWidgetMatrixDX11
 {
 	DirectX::XMMATRIX Matrix;
+	/* Render transform opacity. */
+	float Opacity;
+	float Padding[3];
 
-	OnScreenWidgetMatrixDX11() = default;
+	OnScreenWidgetMatrixDX11()
+		: Opacity(1.0f)
+	{}
 	OnScreenWidgetMatrixDX11(DirectX::XMMATRIX InMatrix)
 		: Matrix(InMatrix)
+		, Opacity(1.0f)
 	{}
 };
 
@@ -76,6 +82,8 @@ Renderer_DX11::Renderer_DX11(WindowsPlatform* pOwner)
 	, GradientIndex(14)
 	, bShowLines(false)
 	, bEnableStencilClipping(false)
+	, LastRenderMatrix(cbgui::cbMatrix2x3::Identity())
+	, LastRenderOpacity(1.0f)
 {
 	std::string DepthTestVSShader = "														\
 							cbuffer UICBuffer : register(b0)						\
@@ -103,6 +111,7 @@ Renderer_DX11::Renderer_DX11(WindowsPlatform* pOwner)
 							cbuffer UICBuffer : register(b0)						\
 							{														\
 								matrix WidgetMatrix;								\
+								float Opacity;									\
 							};														\
 																					\
 							struct GeometryVSIn										\
@@ -131,7 +140,7 @@ Renderer_DX11::Renderer_DX11(WindowsPlatform* pOwner)
 																					\
 								output.position = pos;								\
 																					\
-								output.Color = input.Color;							\
+								output.Color = float4(input.Color.rgb, input.Color.a * Opacity);	\
 								output.texCoord = input.texCoord;					\
 																					\
 								return output;										\
@@ -237,8 +246,9 @@ Renderer_DX11::Renderer_DX11(WindowsPlatform* pOwner)
 	DepthFBO = std::make_unique<D3D11FrameBuffer>("DepthFBO", Infos, Desc);
 
 	{
+		ViewportTransform = GetViewportTransform(Owner->GetWindowWidth(), Owner->GetWindowHeight());
 		OnScreenWidgetMatrixDX11 WidgetMatrix;
-		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)GetViewportTransform(Owner->GetWindowWidth(), Owner->GetWindowHeight());
+		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)ViewportTransform;
 		sBufferDesc BufferDesc;
 		BufferDesc.Size = sizeof(OnScreenWidgetMatrixDX11);
 		WidgetConstantBuffer = std::make_unique<D3D11ConstantBuffer>("DepthTest", BufferDesc, 0, std::vector<eShaderType>{ eShaderType::Vertex });
@@ -586,10 +596,13 @@ void Renderer_DX11::ResizeWindow(std::size_t Width, std::size_t Height)
 	DepthFBO = std::make_unique<D3D11FrameBuffer>("DepthFBO", Infos, Desc);
 
 	{
+		ViewportTransform = GetViewportTransform((int)Width, (int)Height);
 		OnScreenWidgetMatrixDX11 WidgetMatrix;
-		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)GetViewportTransform((int)Width, (int)Height);
+		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)ViewportTransform;
 
-		WidgetConstantBuffer->Map(&WidgetMatrix.Matrix);
+		WidgetConstantBuffer->Map(&WidgetMatrix);
+		LastRenderMatrix = cbgui::cbMatrix2x3::Identity();
+		LastRenderOpacity = 1.0f;
 	}
 }
 
@@ -671,6 +684,9 @@ bool Renderer_DX11::DepthPass(cbgui::cbWidgetObj* Widget)
 
 	LastMaterial = nullptr;
 
+	/* The stencil is drawn in layout space. */
+	ApplyRenderTransform(cbgui::cbMatrix2x3::Identity(), 1.0f);
+
 	DepthFBO->ApplyFrameBuffer(CMD.get());
 
 	{
@@ -717,15 +733,28 @@ void Renderer_DX11::Render()
 	std::vector<ICanvas::WidgetHierarchy*> DrawLatest;
 	std::vector<ICanvas::WidgetHierarchy*> LastInTheHierarchy;
 
-	std::function<void(ICanvas::WidgetHierarchy*, std::optional<cbgui::cbIntBounds>, const eZOrderMode&, AVertexBuffer*, AIndexBuffer*)> fDraw;
-	fDraw = [&](ICanvas::WidgetHierarchy* Node, std::optional<cbgui::cbIntBounds> ScissorsRect, const eZOrderMode& Mode, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer) -> void
+	std::function<void(ICanvas::WidgetHierarchy*, std::optional<cbgui::cbIntBounds>, const eZOrderMode&, std::optional<float>, AVertexBuffer*, AIndexBuffer*)> fDraw;
+	fDraw = [&](ICanvas::WidgetHierarchy* Node, std::optional<cbgui::cbIntBounds> ScissorsRect, const eZOrderMode& Mode, std::optional<float> InheritedOpacity, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer) -> void
 	{
 		if (!Node->Widget->IsVisible())
 			return;
 
+		/* The opacity is multiplied down the hierarchy. The nodes that are drawn out of order start from their owners. */
+		const float Opacity = InheritedOpacity.has_value() ? *InheritedOpacity * Node->Widget->GetLocalRenderOpacity() : Node->Widget->GetRenderOpacity();
+
 		//const cbgui::cbIntBounds& Bounds(ScissorsRect.has_value() ? *ScissorsRect : Node->Widget->GetBounds());
 
-		Draw(Node, Node->Widget->GetCulledBounds(),/*Bounds,*/ VertexBuffer, IndexBuffer);
+		if (Node->Widget->HasRenderTransform())
+		{
+			const cbgui::cbMatrix2x3 RenderMatrix = Node->Widget->GetRenderMatrix();
+			ApplyRenderTransform(RenderMatrix, Opacity);
+			Draw(Node, Node->Widget->GetRenderBounds(), VertexBuffer, IndexBuffer);
+		}
+		else
+		{
+			ApplyRenderTransform(cbgui::cbMatrix2x3::Identity(), 1.0f);
+			Draw(Node, Node->Widget->GetRenderBounds(),/*Bounds,*/ VertexBuffer, IndexBuffer);
+		}
 
 		for (const auto& pChild : Node->Nodes)
 		{
@@ -743,7 +772,7 @@ void Renderer_DX11::Render()
 				LastInTheHierarchy.push_back(pChild);
 				continue;
 			}
-			fDraw(pChild, std::nullopt,/*cbIntBounds(pChild->Widget->GetBounds()).Crop(Bounds),*/ Mode, VertexBuffer, IndexBuffer);
+			fDraw(pChild, std::nullopt,/*cbIntBounds(pChild->Widget->GetBounds()).Crop(Bounds),*/ Mode, Opacity, VertexBuffer, IndexBuffer);
 		}
 	};
 
@@ -777,13 +806,13 @@ void Renderer_DX11::Render()
 						DrawLatest.push_back(Widget);
 						continue;
 					}
-					fDraw(Widget, std::nullopt, eZOrderMode::InOrder, VertexBuffer, IndexBuffer);
+					fDraw(Widget, std::nullopt, eZOrderMode::InOrder, std::nullopt, VertexBuffer, IndexBuffer);
 
 					if (LastInTheHierarchy.size() > 0)
 					{
 						for (auto& pWidget : LastInTheHierarchy)
 						{
-							fDraw(pWidget, std::nullopt /*pWidget->Widget->GetCulledBounds()*/, eZOrderMode::LastInTheHierarchy, VertexBuffer, IndexBuffer);
+							fDraw(pWidget, std::nullopt /*pWidget->Widget->GetCulledBounds()*/, eZOrderMode::LastInTheHierarchy, std::nullopt, VertexBuffer, IndexBuffer);
 						}
 						LastInTheHierarchy.clear();
 					}
@@ -800,7 +829,7 @@ void Renderer_DX11::Render()
 			{
 				for (auto& Widget : DrawLatest)
 				{
-					fDraw(Widget, std::nullopt /*pWidget->Widget->GetCulledBounds()*/, eZOrderMode::Latest, VertexBuffer, IndexBuffer);
+					fDraw(Widget, std::nullopt /*pWidget->Widget->GetCulledBounds()*/, eZOrderMode::Latest, std::nullopt, VertexBuffer, IndexBuffer);
 				}
 				DrawLatest.clear();
 			}
@@ -812,6 +841,22 @@ void Renderer_DX11::Render()
 	LastMaterial = nullptr;
 }
 
+void Renderer_DX11::ApplyRenderTransform(const cbgui::cbMatrix2x3& RenderMatrix, const float Opacity)
+{
+	if (RenderMatrix == LastRenderMatrix && Opacity == LastRenderOpacity)
+		return;
+
+	LastRenderMatrix = RenderMatrix;
+	LastRenderOpacity = Opacity;
+
+	const std::array<cbVector4, 4> Matrix = RenderMatrix.GetMatrix4x4();
+	OnScreenWidgetMatrixDX11 WidgetMatrix;
+	WidgetMatrix.Matrix = DirectX::XMMatrixMultiply((const DirectX::XMMATRIX&)Matrix, (const DirectX::XMMATRIX&)ViewportTransform);
+	WidgetMatrix.Opacity = Opacity;
+	/* Mapped on the deferred context, the draws recorded before keep the previous transform. */
+	WidgetConstantBuffer->Map(&WidgetMatrix, D3D11_MAP::D3D11_MAP_WRITE_DISCARD, CMD->GetDeferredCTX());
+}
+
 void Renderer_DX11::Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBounds& ScissorsRect, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer)
 {
 	if (Node->Widget->HasGeometry())
@@ -841,14 +886,56 @@ void Renderer_DX11::Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBound
 		}
 		pMaterialInstace->ApplyMaterialInstance(CMD.get());
 
+		if (Node->DirtyVertexEnd > Node->DirtyVertexBegin)
+		{
+			/* Only a range of the vertices is replaced, the vertex count is unchanged. */
+			if (!Node->bVertexDirty && Node->DirtyVertexEnd <= GeometryDrawData.VertexCount)
+			{
+				auto Data = Node->Widget->GetVertexRangeData(Node->DirtyVertexBegin, Node->DirtyVertexEnd - Node->DirtyVertexBegin);
+				if (Data.size() > 0)
+					CMD->UpdateBufferSubresource(VertexBuffer, (Node->DrawParams.VertexOffset + Node->DirtyVertexBegin) * sizeof(cbGeometryVertexData), Data.size() * sizeof(cbGeometryVertexData), Data.data());
+				if (Node->DirtyVertexBegin + Data.size() <= Node->Vertices.size())
+					std::copy(Data.begin(), Data.end(), Node->Vertices.begin() + Node->DirtyVertexBegin);
+			}
+			else
+			{
+				Node->bVertexDirty = true;
+			}
+			Node->DirtyVertexBegin = 0;
+			Node->DirtyVertexEnd = 0;
+		}
+
+		if (Node->bColorDirty && !Node->bVertexDirty)
+		{
+			/* Only the color of the vertices is patched, the positions and texture coordinates are unchanged. */
+			const auto Color = Node->Widget->GetVertexColor();
+			if (Color && Node->Vertices.size() == GeometryDrawData.VertexCount)
+			{
+				for (auto& Vertex : Node->Vertices)
+					Vertex.Color = *Color;
+				CMD->UpdateBufferSubresource(VertexBuffer, Node->DrawParams.VertexOffset * sizeof(cbGeometryVertexData), Node->Vertices.size() * sizeof(cbGeometryVertexData), Node->Vertices.data());
+			}
+			else
+			{
+				Node->bVertexDirty = true;
+			}
+			Node->bColorDirty = false;
+		}
+
 		if (Node->bVertexDirty || Node->bIndexDirty)
 		{
 			if (Node->bVertexDirty)
 			{
-				const auto& Data = Node->Widget->GetVertexData();
+				auto Data = Node->Widget->GetVertexData();
 				if (Data.size() > 0)
 					CMD->UpdateBufferSubresource(VertexBuffer, Node->DrawParams.VertexOffset * sizeof(cbGeometryVertexData), Data.size() * sizeof(cbGeometryVertexData), Data.data());
+				if (Node->Widget->GetVertexColor().has_value())
+					Node->Vertices = std::move(Data);
+				else
+					Node->Vertices.clear();
 				Node->bVertexDirty = false;
+				Node->bColorDirty = false;
+				Node->bIsCulled = Node->Widget->IsItCulled();
 			}
 			if (Node->bIndexDirty)
 			{
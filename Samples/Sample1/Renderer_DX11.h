@@ -53,6 +53,8 @@ public:
 	* Stencil Clipping
 	*/
 	bool DepthPass(cbgui::cbWidgetObj* Widget);
+	/* Updates the widget matrix if the render transform differs from the last draw. */
+	void ApplyRenderTransform(const cbgui::cbMatrix2x3& RenderMatrix, const float Opacity);
 
 	IUIMaterialStyle* GetMaterialStyle(std::string Name) const;
 
@@ -85,4 +87,8 @@ private:
 
 	bool bEnableStencilClipping;
 	bool bShowLines;
+
+	std::array<cbgui::cbVector4, 4> ViewportTransform;
+	cbgui::cbMatrix2x3 LastRenderMatrix;
+	float LastRenderOpacity;
 };
@@ -64,7 +64,13 @@ static_assert((sizeof(CBGradientIdx) % 256) == 0, "Constant Buffer size must be
 struct OnScreenWidgetMatrixDX12
 {
 	DirectX::XMMATRIX Matrix;
-	DirectX::XMMATRIX Offset[3];
+	/* Render transform opacity. */
+	float Opacity;
+	float Padding[47];
+
+	OnScreenWidgetMatrixDX12()
+		: Opacity(1.0f)
+	{}
 };
 static_assert((sizeof(OnScreenWidgetMatrixDX12) % 256) == 0, "Constant Buffer size must be 256-byte aligned");
 
@@ -74,6 +80,10 @@ Renderer_DX12::Renderer_DX12(WindowsPlatform* pOwner)
 	, GradientIndex(14)
 	, bShowLines(false)
 	, bEnableStencilClipping(false)
+	, RenderTransformBufferCount(0)
+	, CurrentWidgetBuffer(nullptr)
+	, LastRenderMatrix(cbgui::cbMatrix2x3::Identity())
+	, LastRenderOpacity(1.0f)
 {
 	std::string DepthTestVSShader = "														\
 							cbuffer UICBuffer : register(b0)						\
@@ -101,6 +111,7 @@ Renderer_DX12::Renderer_DX12(WindowsPlatform* pOwner)
 							cbuffer UICBuffer : register(b0)						\
 							{														\
 								matrix WidgetMatrix;								\
+								float Opacity;									\
 							};														\
 																					\
 							struct GeometryVSIn										\
@@ -129,7 +140,7 @@ Renderer_DX12::Renderer_DX12(WindowsPlatform* pOwner)
 																					\
 								output.position = pos;								\
 																					\
-								output.Color = input.Color;							\
+								output.Color = float4(input.Color.rgb, input.Color.a * Opacity);	\
 								output.texCoord = input.texCoord;					\
 																					\
 								return output;										\
@@ -239,9 +250,11 @@ Renderer_DX12::Renderer_DX12(WindowsPlatform* pOwner)
 		BufferDesc.Size = sizeof(OnScreenWidgetMatrixDX12);
 		WidgetConstantBuffer = std::make_unique<D3D12ConstantBuffer>("DepthTest", BufferDesc);
 
+		ViewportTransform = GetViewportTransform(Owner->GetWindowWidth(), Owner->GetWindowHeight());
 		OnScreenWidgetMatrixDX12 WidgetMatrix;
-		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)GetViewportTransform(Owner->GetWindowWidth(), Owner->GetWindowHeight());
+		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)ViewportTransform;
 		WidgetConstantBuffer->Map(&WidgetMatrix);
+		CurrentWidgetBuffer = WidgetConstantBuffer.get();
 	}
 
 	{
@@ -552,6 +565,8 @@ Renderer_DX12::~Renderer_DX12()
 	DepthFullScreenVertexBuffer = nullptr;
 	DepthFBO = nullptr;
 	WidgetConstantBuffer = nullptr;
+	CurrentWidgetBuffer = nullptr;
+	RenderTransformBuffers.clear();
 
 	LastMaterial = nullptr;
 	DefaultUIFontMaterial = nullptr;
@@ -595,8 +610,9 @@ void Renderer_DX12::ResizeWindow(std::size_t Width, std::size_t Height)
 	DepthFBO = std::make_unique<D3D12FrameBuffer>("DepthFBO", Infos, Desc);
 	CMD->WaitForGPU();
 	{
+		ViewportTransform = GetViewportTransform((int)Width, (int)Height);
 		OnScreenWidgetMatrixDX12 WidgetMatrix;
-		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)GetViewportTransform((int)Width, (int)Height);
+		WidgetMatrix.Matrix = (DirectX::XMMATRIX&)ViewportTransform;
 		WidgetConstantBuffer->Map(&WidgetMatrix);
 	}
 }
@@ -746,15 +762,28 @@ void Renderer_DX12::Render()
 	std::vector<ICanvas::WidgetHierarchy*> DrawLatest;
 	std::vector<ICanvas::WidgetHierarchy*> LastInTheHierarchy;
 
-	std::function<void(ICanvas::WidgetHierarchy*, std::optional<cbgui::cbIntBounds>, const eZOrderMode&, AVertexBuffer*, AIndexBuffer*)> fDraw;
-	fDraw = [&](ICanvas::WidgetHierarchy* Node, std::optional<cbgui::cbIntBounds> ScissorsRect, const eZOrderMode& Mode, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer) -> void
+	std::function<void(ICanvas::WidgetHierarchy*, std::optional<cbgui::cbIntBounds>, const eZOrderMode&, std::optional<float>, AVertexBuffer*, AIndexBuffer*)> fDraw;
+	fDraw = [&](ICanvas::WidgetHierarchy* Node, std::optional<cbgui::cbIntBounds> ScissorsRect, const eZOrderMode& Mode, std::optional<float> InheritedOpacity, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer) -> void
 	{
 		if (!Node->Widget->IsVisible())
 			return;
 
+		/* The opacity is multiplied down the hierarchy. The nodes that are drawn out of order start from their owners. */
+		const float Opacity = InheritedOpacity.has_value() ? *InheritedOpacity * Node->Widget->GetLocalRenderOpacity() : Node->Widget->GetRenderOpacity();
+
 		//const cbgui::cbIntBounds& Bounds(ScissorsRect.has_value() ? *ScissorsRect : Node->Widget->GetBounds());
 
-		Draw(Node, Node->Widget->GetCulledBounds(),/*Bounds,*/ VertexBuffer, IndexBuffer);
+		if (Node->Widget->HasRenderTransform())
+		{
+			const cbgui::cbMatrix2x3 RenderMatrix = Node->Widget->GetRenderMatrix();
+			ApplyRenderTransform(RenderMatrix, Opacity);
+			Draw(Node, Node->Widget->GetRenderBounds(), VertexBuffer, IndexBuffer);
+		}
+		else
+		{
+			ApplyRenderTransform(cbgui::cbMatrix2x3::Identity(), 1.0f);
+			Draw(Node, Node->Widget->GetRenderBounds(),/*Bounds,*/ VertexBuffer, IndexBuffer);
+		}
 
 		for (const auto& pChild : Node->Nodes)
 		{
@@ -772,10 +801,16 @@ void Renderer_DX12::Render()
 				LastInTheHierarchy.push_back(pChild);
 				continue;
 			}
-			fDraw(pChild, std::nullopt,/*cbIntBounds(pChild->Widget->GetBounds()).Crop(Bounds),*/ Mode, VertexBuffer, IndexBuffer);
+			fDraw(pChild, std::nullopt,/*cbIntBounds(pChild->Widget->GetBounds()).Crop(Bounds),*/ Mode, Opacity, VertexBuffer, IndexBuffer);
 		}
 	};
 
+	/* The render transform buffers of the last frame are reused. */
+	RenderTransformBufferCount = 0;
+	CurrentWidgetBuffer = WidgetConstantBuffer.get();
+	LastRenderMatrix = cbgui::cbMatrix2x3::Identity();
+	LastRenderOpacity = 1.0f;
+
 	{
 		CMD->BeginRecordCommandList();
 
@@ -815,13 +850,13 @@ void Renderer_DX12::Render()
 						DrawLatest.push_back(Widget);
 						continue;
 					}
-					fDraw(Widget, std::nullopt, eZOrderMode::InOrder, VertexBuffer, IndexBuffer);
+					fDraw(Widget, std::nullopt, eZOrderMode::InOrder, std::nullopt, VertexBuffer, IndexBuffer);
 
 					if (LastInTheHierarchy.size() > 0)
 					{
 						for (auto& pWidget : LastInTheHierarchy)
 						{
-							fDraw(pWidget, std::nullopt /*pWidget->Widget->GetCulledBounds()*/, eZOrderMode::LastInTheHierarchy, VertexBuffer, IndexBuffer);
+							fDraw(pWidget, std::nullopt /*pWidget->Widget->GetCulledBounds()*/, eZOrderMode::LastInTheHierarchy, std::nullopt, VertexBuffer, IndexBuffer);
 						}
 						LastInTheHierarchy.clear();
 					}
@@ -839,7 +874,7 @@ void Renderer_DX12::Render()
 			{
 				for (auto& Widget : DrawLatest)
 				{
-					fDraw(Widget, std::nullopt /*Widget->Widget->GetCulledBounds()*/, eZOrderMode::Latest, VertexBuffer, IndexBuffer);
+					fDraw(Widget, std::nullopt /*Widget->Widget->GetCulledBounds()*/, eZOrderMode::Latest, std::nullopt, VertexBuffer, IndexBuffer);
 				}
 				DrawLatest.clear();
 			}
@@ -851,6 +886,41 @@ void Renderer_DX12::Render()
 	LastMaterial = nullptr;
 }
 
+void Renderer_DX12::ApplyRenderTransform(const cbgui::cbMatrix2x3& RenderMatrix, const float Opacity)
+{
+	if (RenderMatrix == LastRenderMatrix && Opacity == LastRenderOpacity)
+		return;
+
+	LastRenderMatrix = RenderMatrix;
+	LastRenderOpacity = Opacity;
+
+	if (RenderMatrix.IsIdentity() && Opacity == 1.0f)
+	{
+		CurrentWidgetBuffer = WidgetConstantBuffer.get();
+	}
+	else
+	{
+		/* Each transform of the frame has its own buffer, the command list reads them after recording. */
+		if (RenderTransformBufferCount == RenderTransformBuffers.size())
+		{
+			sBufferDesc BufferDesc;
+			BufferDesc.Size = sizeof(OnScreenWidgetMatrixDX12);
+			RenderTransformBuffers.push_back(std::make_unique<D3D12ConstantBuffer>("RenderTransform", BufferDesc));
+		}
+
+		const std::array<cbVector4, 4> Matrix = RenderMatrix.GetMatrix4x4();
+		OnScreenWidgetMatrixDX12 WidgetMatrix;
+		WidgetMatrix.Matrix = DirectX::XMMatrixMultiply((const DirectX::XMMATRIX&)Matrix, (const DirectX::XMMATRIX&)ViewportTransform);
+		WidgetMatrix.Opacity = Opacity;
+
+		CurrentWidgetBuffer = RenderTransformBuffers[RenderTransformBufferCount++].get();
+		CurrentWidgetBuffer->Map(&WidgetMatrix);
+	}
+
+	if (LastMaterial)
+		CurrentWidgetBuffer->ApplyBuffer(0, CMD->Get());
+}
+
 void Renderer_DX12::Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBounds& ScissorsRect, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer)
 {
 	if (Node->Widget->HasGeometry())
@@ -874,12 +944,59 @@ void Renderer_DX12::Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBound
 		{
 			LastMaterial = pMaterial;
 			LastMaterial->ApplyMaterial(CMD.get());
-			WidgetConstantBuffer->ApplyBuffer(0, CMD->Get());
+			CurrentWidgetBuffer->ApplyBuffer(0, CMD->Get());
 			if (Node->MaterialName == StartScreenWave->GetName())
 				GradientConstantBuffer->ApplyBuffer(1, CMD->Get());
 		}
 		pMaterialInstace->ApplyMaterialInstance(CMD.get());
 
+		if (Node->DirtyVertexEnd > Node->DirtyVertexBegin)
+		{
+			/* Only a range of the vertices is replaced, the vertex count is unchanged. */
+			if (!Node->bVertexDirty && Node->DirtyVertexEnd <= GeometryDrawData.VertexCount)
+			{
+				auto Data = Node->Widget->GetVertexRangeData(Node->DirtyVertexBegin, Node->DirtyVertexEnd - Node->DirtyVertexBegin);
+				if (Data.size() > 0)
+				{
+					sBufferSubresource Subresource;
+					Subresource.pSysMem = Data.data();
+					Subresource.Size = Data.size() * sizeof(cbGeometryVertexData);
+					Subresource.Location = (Node->DrawParams.VertexOffset + Node->DirtyVertexBegin) * sizeof(cbGeometryVertexData);
+					CMD->UpdateBufferSubresource(VertexBuffer, &Subresource);
+				}
+				if (Node->DirtyVertexBegin + Data.size() <= Node->Vertices.size())
+					std::copy(Data.begin(), Data.end(), Node->Vertices.begin() + Node->DirtyVertexBegin);
+			}
+			else
+			{
+				Node->bVertexDirty = true;
+			}
+			Node->DirtyVertexBegin = 0;
+			Node->DirtyVertexEnd = 0;
+		}
+
+		if (Node->bColorDirty && !Node->bVertexDirty)
+		{
+			/* Only the color of the vertices is patched, the positions and texture coordinates are unchanged. */
+			const auto Color = Node->Widget->GetVertexColor();
+			if (Color && Node->Vertices.size() == GeometryDrawData.VertexCount)
+			{
+				for (auto& Vertex : Node->Vertices)
+					Vertex.Color = *Color;
+
+				sBufferSubresource Subresource;
+				Subresource.pSysMem = Node->Vertices.data();
+				Subresource.Size = Node->Vertices.size() * sizeof(cbGeometryVertexData);
+				Subresource.Location = Node->DrawParams.VertexOffset * sizeof(cbGeometryVertexData);
+				CMD->UpdateBufferSubresource(VertexBuffer, &Subresource);
+			}
+			else
+			{
+				Node->bVertexDirty = true;
+			}
+			Node->bColorDirty = false;
+		}
+
 		if (Node->bVertexDirty || Node->bIndexDirty)
 		{
 			if (Node->bVertexDirty)
@@ -893,7 +1010,13 @@ void Renderer_DX12::Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBound
 					Subresource.Location = Node->DrawParams.VertexOffset * sizeof(cbGeometryVertexData);
 					CMD->UpdateBufferSubresource(VertexBuffer, &Subresource);
 				}
+				if (Node->Widget->GetVertexColor().has_value())
+					Node->Vertices = std::move(Data);
+				else
+					Node->Vertices.clear();
 				Node->bVertexDirty = false;
+				Node->bColorDirty = false;
+				Node->bIsCulled = Node->Widget->IsItCulled();
 			}
 			if (Node->bIndexDirty)
 			{
@@ -956,7 +1079,7 @@ void Renderer_DX12::Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBound
 		{
 			LastMaterial = pMaterial;
 			LastMaterial->ApplyMaterial(CMD.get());
-			WidgetConstantBuffer->ApplyBuffer(0, CMD->Get());
+			CurrentWidgetBuffer->ApplyBuffer(0, CMD->Get());
 			if (Node->MaterialName == StartScreenWave->GetName())
 				GradientConstantBuffer->ApplyBuffer(1, CMD->Get());
 		}
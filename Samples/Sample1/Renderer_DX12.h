@@ -50,6 +50,8 @@ public:
 	virtual void Render() override final;
 	virtual void Draw(ICanvas::WidgetHierarchy* Node, const cbgui::cbIntBounds& ScissorsRect, AVertexBuffer* VertexBuffer, AIndexBuffer* IndexBuffer);
 	bool DepthPass(cbgui::cbWidgetObj* Widget);
+	/* Selects the widget matrix buffer of the render transform. */
+	void ApplyRenderTransform(const cbgui::cbMatrix2x3& RenderMatrix, const float Opacity);
 
 	IUIMaterialStyle* GetMaterialStyle(std::string Name) const;
 
@@ -84,4 +86,12 @@ private:
 
 	std::unique_ptr<D3D12ConstantBuffer> GradientConstantBuffer;
 	unsigned int GradientIndex;
+
+	std::array<cbgui::cbVector4, 4> ViewportTransform;
+	/* Widget matrix buffers of the render transforms, reused every frame. */
+	std::vector<std::unique_ptr<D3D12ConstantBuffer>> RenderTransformBuffers;
+	std::size_t RenderTransformBufferCount;
+	D3D12ConstantBuffer* CurrentWidgetBuffer;
+	cbgui::cbMatrix2x3 LastRenderMatrix;
+	float LastRenderOpacity;
 };
@@ -513,7 +513,6 @@ public:
 	virtual bool IsInserted() const override final { return HasOwner() && bIsInserted; }
 
 	void BeginPlay() { if (HasContent()) GetContent()->BeginPlay(); }
-	void Tick(float DeltaTime) { if (HasContent()) GetContent()->Tick(DeltaTime); }
 
 	virtual void ReplaceContent(const cbWidget::SharedPtr& Content) {}
 
@@ -529,6 +528,8 @@ public:
 
 	virtual bool HasAnyChildren() const { return Content != nullptr; }
 	virtual std::vector<cbWidgetObj*> GetAllChildren() const { return std::vector<cbWidgetObj*>{ Content.get() }; }
+	virtual std::size_t GetChildrenCount() const { return Content ? 1 : 0; }
+	virtual cbWidgetObj* GetChildAt(const std::size_t Index) const { return Index == 0 ? Content.get() : nullptr; }
 
 	bool IsInsideSlots(const cbVector& Location) const { return ComboBoxList->IsInsideSlots(Location); }
 
@@ -583,6 +584,7 @@ public:
 			Location.Y = pOwner->GetContentVerticalAlignmentLocation();
 		break;
 		}
+		InvalidateWorldCache();
 
 		Content->UpdateVerticalAlignment();
 	}
@@ -602,6 +604,7 @@ public:
 			Location.X = pOwner->GetNextSlotLocation(eHorizontalAlignment::Align_Right, this->GetIndex()) + this->GetWidth() / 2.0f;
 		break;
 		}
+		InvalidateWorldCache();
 
 		Content->UpdateHorizontalAlignment();
 	}
@@ -1067,7 +1070,7 @@ void cbComboBox::Insert(std::u32string Text, cbTextDesc Desc, cbVertexColorStyle
 
 void cbComboBox::Insert(std::string Text, cbTextDesc Desc, cbVertexColorStyle Style, const std::optional<std::size_t> Index)
 {
-	Insert(std::u32string(Text.begin(), Text.end()), Desc, Style, Index);
+	Insert(DecodeUtf8(Text), Desc, Style, Index);
 }
 
 void cbComboBox::Insert(const cbWidget::SharedPtr& Obj, const std::optional<std::size_t> Index)
@@ -1573,8 +1576,6 @@ bool cbComboBox::OnMouseLeave(const cbMouseInput& Mouse)
 
 	bool bIsSlotStillFocused = false;
 
-	const auto& Slots = GetSlots();
-
 	if (MenuSlot->IsFocused())
 		if (!MenuSlot->OnMouseLeave(Mouse))
 			bIsSlotStillFocused = true;
@@ -264,6 +264,8 @@ public:
 
 		virtual bool HasAnyChildren() const { return Content != nullptr; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const { return std::vector<cbWidgetObj*>{ Content.get() }; }
+		virtual std::size_t GetChildrenCount() const { return Content ? 1 : 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const { return Index == 0 ? Content.get() : nullptr; }
 
 		virtual cbBounds GetBounds() const override { return cbBounds(GetDimension(), GetLocation()); }
 		virtual cbVector GetLocation() const override { return GetOwner<cbComboBox>()->GetLocation(); }
@@ -401,10 +403,14 @@ public:
 	virtual std::size_t GetSlotSize(const bool ExcludeHidden = false) const override final { return 2; }
 
 	virtual std::vector<cbWidgetObj*> GetAllChildren() const override;
+	virtual std::size_t GetChildrenCount() const override { return 2; }
+	virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override { return GetSlot(Index); }
 	virtual bool HasAnyChildren() const { return true; }
 
 	virtual bool HasAnyComponents() const override final { return false; }
 	virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+	virtual std::size_t GetComponentsCount() const override final { return 0; }
+	virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 	virtual bool HasGeometry() const override final { return false; }
 	virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final { return std::vector<cbGeometryVertexData>(); };
@@ -240,6 +240,7 @@ namespace cbgui
 	void cbScaleBox::SetScale(const cbMargin& scale)
 	{
 		Scaler = scale;
+		InvalidateWorldCache();
 
 		UpdateSlotAlignments();
 	}
@@ -247,6 +248,7 @@ namespace cbgui
 	void cbScaleBox::SetScale(const std::int32_t& scale)
 	{
 		Scaler = cbMargin(scale);
+		InvalidateWorldCache();
 
 		UpdateSlotAlignments();
 	}
@@ -261,6 +263,8 @@ namespace cbgui
 		{
 			bIsActive = !bIsActive;
 		}
+		/* The culled bounds of the content are extended by the scaler. */
+		InvalidateWorldCache();
 		UpdateSlotAlignments();
 
 		if (bIsActive)
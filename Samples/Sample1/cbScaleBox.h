@@ -97,6 +97,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual cbBounds GetBounds() const override { return cbBounds(GetOwner<cbScaleBox>()->GetSlotDimension(), GetOwner<cbScaleBox>()->GetLocation()); }
 			virtual cbVector GetLocation() const override { return GetOwner<cbScaleBox>()->GetLocation(); }
@@ -190,10 +192,14 @@ namespace cbgui
 		void RemoveContent();
 
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override;
+		virtual std::size_t GetChildrenCount() const override { return Slot ? 1 : 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override { return Index == 0 ? Slot.get() : nullptr; }
 		virtual bool HasAnyChildren() const { return Slot != nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasGeometry() const override final { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
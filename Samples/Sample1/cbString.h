@@ -28,6 +28,7 @@
 #include <cbSlottedBox.h>
 #include <cbText.h>
 #include <cbFont.h>
+#include <cbUtf8.h>
 #include <optional>
 
 class cbFontResources
@@ -90,6 +91,13 @@ public:
 		return false;
 	}
 
+	/* Advances the frame index of the font families, used for glyph eviction. */
+	void BeginFrame()
+	{
+		for (auto& pFont : Fonts)
+			pFont->BeginFrame();
+	}
+
 	std::optional<std::vector<unsigned char>> GetFontFamilyTextureAtlas(const std::string& FontFamilyName) const
 	{
 		if (auto Font = GetFontFamily(FontFamilyName))
@@ -127,7 +135,7 @@ class cbString : public cbgui::cbText
 	cbClassBody(cbClassConstructor, cbString, cbgui::cbText);
 public:
 	cbString(const std::string& Text, const cbgui::cbTextDesc& TextDesc = cbgui::cbTextDesc())
-		: cbgui::cbText(std::u32string(Text.begin(), Text.end()), TextDesc, cbFontResources::Get().GetFontFamily(0))
+		: cbgui::cbText(cbgui::DecodeUtf8(Text), TextDesc, cbFontResources::Get().GetFontFamily(0))
 	{}
 	cbString(const std::u32string& Text = U"", const cbgui::cbTextDesc& TextDesc = cbgui::cbTextDesc())
 		: cbgui::cbText(Text, TextDesc, cbFontResources::Get().GetFontFamily(0))
@@ -144,6 +152,10 @@ public:
 
 	void SetString(const std::string& Text, const std::optional<cbgui::cbTextDesc> TextDesc = std::nullopt) 
 	{
-		SetText(std::u32string(Text.begin(), Text.end()), TextDesc);
+		SetTextUtf8(Text, TextDesc);
 	}
+
+	/* SetText looks up and stores the layout in the shared cbTextLayoutCache. Default : true */
+	void SetLayoutCacheEnabled(const bool Value) { GetFontGeometry()->SetLayoutCacheEnabled(Value); }
+	bool IsLayoutCacheEnabled() const { return GetFontGeometry()->IsLayoutCacheEnabled(); }
 };
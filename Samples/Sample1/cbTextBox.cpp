@@ -81,6 +81,15 @@ cbTextBox::cbTextBox()
 	, bEditMode(false)
 	, TextBoxType(eTextBoxType::All)
 	, Limit(std::nullopt)
+	, Document(nullptr)
+	, FirstVisibleLine(0)
+	, VisibleLineCount(0)
+	, DocumentLineHeight(0.0f)
+	, WindowOffset(0)
+	, WindowLength(0)
+	, CursorDocumentPosition(std::nullopt)
+	, SelectionAnchor(std::nullopt)
+	, bWasLayoutCacheEnabled(true)
 {
 	TextSlot->Inserted();
 }
@@ -96,6 +105,15 @@ cbTextBox::cbTextBox(const std::u32string& Text, const cbTextDesc& TextDesc)
 	, bEditMode(false)
 	, TextBoxType(eTextBoxType::All)
 	, Limit(std::nullopt)
+	, Document(nullptr)
+	, FirstVisibleLine(0)
+	, VisibleLineCount(0)
+	, DocumentLineHeight(0.0f)
+	, WindowOffset(0)
+	, WindowLength(0)
+	, CursorDocumentPosition(std::nullopt)
+	, SelectionAnchor(std::nullopt)
+	, bWasLayoutCacheEnabled(true)
 {
 	TextSlot->Inserted();
 }
@@ -111,6 +129,15 @@ cbTextBox::cbTextBox(const cbTextBox& TextBox)
 	, bEditMode(TextBox.bEditMode)
 	, TextBoxType(TextBox.TextBoxType)
 	, Limit(TextBox.Limit)
+	, Document(TextBox.Document ? cbTextDocument::Create(TextBox.Document->GetUtf8Text()) : nullptr)
+	, FirstVisibleLine(TextBox.FirstVisibleLine)
+	, VisibleLineCount(TextBox.VisibleLineCount)
+	, DocumentLineHeight(TextBox.DocumentLineHeight)
+	, WindowOffset(TextBox.WindowOffset)
+	, WindowLength(TextBox.WindowLength)
+	, CursorDocumentPosition(TextBox.CursorDocumentPosition)
+	, SelectionAnchor(TextBox.SelectionAnchor)
+	, bWasLayoutCacheEnabled(TextBox.bWasLayoutCacheEnabled)
 {
 	TextSlot = TextBox.TextSlot->Clone<cbTextSlot>(this);
 	TextSlot->Inserted();
@@ -121,6 +148,7 @@ cbTextBox::~cbTextBox()
 	TextSlot = nullptr;
 	Cursor = nullptr;
 	Highlight = nullptr;
+	Document = nullptr;
 }
 
 cbWidget::SharedPtr cbTextBox::CloneWidget()
@@ -298,6 +326,26 @@ std::vector<cbWidgetObj*> cbTextBox::GetAllChildren() const
 	return std::vector<cbWidgetObj*>{ };
 }
 
+cbWidgetObj* cbTextBox::GetChildAt(const std::size_t Index) const
+{
+	switch (Index)
+	{
+	case 0: return Highlight.get();
+	case 1: return TextSlot.get();
+	case 2: return Cursor.get();
+	}
+	return nullptr;
+}
+
+cbComponent* cbTextBox::GetComponentAt(const std::size_t Index) const
+{
+	if (Index == 0)
+		return Cursor.get();
+	else if (Index == 1)
+		return Highlight.get();
+	return nullptr;
+}
+
 void cbTextBox::OnSlotVisibilityChanged(cbSlot* Slot)
 {
 }
@@ -336,12 +384,22 @@ cbSlot* cbTextBox::GetOverlappingSlot(const cbBounds& Bounds) const
 
 const std::u32string cbTextBox::GetText() const
 {
+	if (Document)
+		return Document->GetText();
+
 	const auto& pText = TextSlot->GetText();
 	return pText->GetText();
 }
 
 void cbTextBox::SetText(const std::u32string& inText, const std::optional<cbTextDesc> Desc)
 {
+	if (Document)
+	{
+		Document->SetText(inText);
+		OpenDocument(Document);
+		return;
+	}
+
 	const auto& pText = TextSlot->GetText();
 	pText->SetText(inText, Desc);
 
@@ -356,6 +414,13 @@ void cbTextBox::SetText(const std::u32string& inText, const std::optional<cbText
 
 void cbTextBox::SetText(const std::string& Text, const std::optional<cbTextDesc> Desc)
 {
+	if (Document)
+	{
+		Document->SetText(Text);
+		OpenDocument(Document);
+		return;
+	}
+
 	const auto& pText = TextSlot->GetText();
 	if (Desc.has_value())
 		pText->SetString((Text), Desc.value());
@@ -392,6 +457,14 @@ void cbTextBox::SetVertexColorStyle(const cbVertexColorStyle& style)
 
 void cbTextBox::AppendText(const std::u32string& Text)
 {
+	if (Document)
+	{
+		Document->Insert(Document->GetLength(), Text);
+		UpdateDocumentWindow();
+		WrapOrUpdateAlignments();
+		return;
+	}
+
 	const auto& pText = TextSlot->GetText();
 	pText->AppendText(Text);
 
@@ -464,6 +537,9 @@ void cbTextBox::SetTextJustify(eTextJustify Justify)
 }
 std::size_t cbTextBox::GetTextSize(bool Filtered) const
 {
+	if (Document)
+		return Document->GetLength();
+
 	const auto& pText = TextSlot->GetText();
 	return pText->GetTextSize(Filtered);
 }
@@ -499,6 +575,13 @@ bool cbTextBox::RemoveChars(const std::vector<std::size_t>& Indices)
 }
 void cbTextBox::ClearText()
 {
+	if (Document)
+	{
+		Document->Clear();
+		OpenDocument(Document);
+		return;
+	}
+
 	const auto& pText = TextSlot->GetText();
 	pText->Clear();
 
@@ -694,6 +777,255 @@ bool cbTextBox::IsCharacterBlocked(char32_t Char) const
 	return std::find(BlockChars.begin(), BlockChars.end(), Char) != BlockChars.end();
 }
 
+void cbTextBox::OpenDocument(const cbTextDocument::SharedPtr& pDocument)
+{
+	if (!pDocument)
+	{
+		CloseDocument();
+		return;
+	}
+
+	const auto& pText = TextSlot->GetText();
+	/* The window text changes on every scroll and edit, caching it would evict the shared layouts of the repeated labels. */
+	if (!Document)
+		bWasLayoutCacheEnabled = pText->IsLayoutCacheEnabled();
+	pText->SetLayoutCacheEnabled(false);
+
+	Document = pDocument;
+	FirstVisibleLine = 0;
+	CursorDocumentPosition = std::nullopt;
+	SelectionAnchor = std::nullopt;
+	SelectedIndex = std::nullopt;
+	PastSelectedIndex = std::nullopt;
+	Highlight->ClearHighlights();
+
+	pText->SetAutoWrap(false);
+	pText->SetTextStylingEnabled(false);
+
+	UpdateDocumentWindow();
+	WrapOrUpdateAlignments();
+}
+
+void cbTextBox::CloseDocument()
+{
+	if (!Document)
+		return;
+
+	Document = nullptr;
+	FirstVisibleLine = 0;
+	VisibleLineCount = 0;
+	WindowOffset = 0;
+	WindowLength = 0;
+	CursorDocumentPosition = std::nullopt;
+	SelectionAnchor = std::nullopt;
+	TextSlot->GetText()->SetLayoutCacheEnabled(bWasLayoutCacheEnabled);
+
+	ClearText();
+}
+
+void cbTextBox::ScrollToLine(std::size_t Line)
+{
+	if (!Document)
+		return;
+
+	const std::size_t LineCount = Document->GetLineCount();
+	const std::size_t LastLine = LineCount - std::min(LineCount, GetDocumentVisibleLineCount(false));
+	Line = std::min(Line, LastLine);
+	if (Line == FirstVisibleLine)
+		return;
+
+	FirstVisibleLine = Line;
+	UpdateDocumentWindow();
+	WrapOrUpdateAlignments();
+}
+
+void cbTextBox::SetCursorPosition(const cbTextPosition& Position)
+{
+	if (!Document)
+		return;
+
+	CursorDocumentPosition = Document->GetPosition(Document->GetOffset(Position));
+	SelectionAnchor = std::nullopt;
+
+	ScrollToCursor();
+	UpdateDocumentWindow();
+	WrapOrUpdateAlignments();
+}
+
+void cbTextBox::SetSelection(const cbTextPosition& Start, const cbTextPosition& End)
+{
+	if (!Document)
+		return;
+
+	SelectionAnchor = Document->GetPosition(Document->GetOffset(Start));
+	CursorDocumentPosition = Document->GetPosition(Document->GetOffset(End));
+
+	ScrollToCursor();
+	UpdateDocumentWindow();
+	WrapOrUpdateAlignments();
+}
+
+std::size_t cbTextBox::GetDocumentVisibleLineCount(const bool IncludePartialLine) const
+{
+	const float LineHeight = DocumentLineHeight > 0.0f ? DocumentLineHeight : static_cast<float>(TextSlot->GetText()->GetCharSize());
+	const float Lines = GetHeight() / std::max(LineHeight, 1.0f);
+	return std::max<std::size_t>(1, static_cast<std::size_t>(IncludePartialLine ? std::ceil(Lines) : std::floor(Lines)));
+}
+
+void cbTextBox::UpdateDocumentWindow()
+{
+	if (!Document)
+		return;
+
+	const auto& pText = TextSlot->GetText();
+	FirstVisibleLine = std::min(FirstVisibleLine, Document->GetLineCount() - 1);
+	WindowOffset = Document->GetLineStart(FirstVisibleLine);
+
+	auto SetWindowText = [&]()
+	{
+		VisibleLineCount = GetDocumentVisibleLineCount();
+		const std::u32string Lines = Document->GetLines(FirstVisibleLine, VisibleLineCount);
+		WindowLength = Lines.size();
+		pText->SetText(Lines);
+	};
+
+	SetWindowText();
+
+	/* The line height is known after the first shaping, the window is rebuilt once if the estimate was wrong. */
+	std::optional<cbBounds> Line = pText->GetLineBounds(0, false);
+	if (Line.has_value() && Line.value().GetHeight() > 0.0f && Line.value().GetHeight() != DocumentLineHeight)
+	{
+		DocumentLineHeight = Line.value().GetHeight();
+		if (GetDocumentVisibleLineCount() != VisibleLineCount)
+			SetWindowText();
+	}
+
+	SelectedIndex = std::nullopt;
+	if (CursorDocumentPosition.has_value())
+	{
+		const std::size_t Offset = Document->GetOffset(CursorDocumentPosition.value());
+		if (Offset >= WindowOffset && Offset <= WindowOffset + WindowLength)
+		{
+			const std::size_t Index = Offset - WindowOffset;
+			if (Index == WindowLength && WindowLength > 0)
+			{
+				SelectedIndex = static_cast<std::uint32_t>(Index - 1);
+				Cursor->CursorPosition = eCursorPosition::Right;
+			}
+			else
+			{
+				SelectedIndex = static_cast<std::uint32_t>(Index);
+				Cursor->CursorPosition = eCursorPosition::Left;
+			}
+
+			if (!Cursor->IsEnabled())
+				Cursor->Enable();
+			return;
+		}
+	}
+
+	if (Cursor->IsEnabled())
+		Cursor->Disable();
+}
+
+void cbTextBox::UpdateDocumentHighlight()
+{
+	Highlight->ClearHighlights();
+
+	if (!Document || !CursorDocumentPosition.has_value() || !SelectionAnchor.has_value())
+		return;
+	if (CursorDocumentPosition.value() == SelectionAnchor.value())
+		return;
+
+	const cbTextPosition Start = std::min(CursorDocumentPosition.value(), SelectionAnchor.value());
+	const cbTextPosition End = std::max(CursorDocumentPosition.value(), SelectionAnchor.value());
+	Highlight->HighlightStartPosition = Start;
+	Highlight->HighlightEndPosition = End;
+
+	/* Only the part of the selection inside the visible lines is drawn. */
+	const std::size_t StartOffset = std::max(Document->GetOffset(Start), WindowOffset);
+	const std::size_t EndOffset = std::min(Document->GetOffset(End), WindowOffset + WindowLength);
+	if (StartOffset >= EndOffset)
+		return;
+
+	const auto& pText = TextSlot->GetText();
+	std::optional<cbCharacterData> FirstChar = pText->GetCharacterData(StartOffset - WindowOffset);
+	std::optional<cbCharacterData> LastChar = pText->GetCharacterData(EndOffset - WindowOffset - 1);
+	if (!FirstChar.has_value() || !LastChar.has_value())
+		return;
+
+	for (std::size_t i = FirstChar.value().LineOrder; i <= LastChar.value().LineOrder; i++)
+	{
+		std::optional<cbBounds> Line = pText->GetLineBounds(i, false);
+		if (!Line.has_value())
+			continue;
+
+		const float Left = i == FirstChar.value().LineOrder ? FirstChar.value().Bounds.Min.X : Line.value().Min.X;
+		const float Right = i == LastChar.value().LineOrder ? LastChar.value().Bounds.Max.X : Line.value().Max.X;
+		Highlight->SetHighlight(Left, Right, Line.value().Min.Y, Line.value().Max.Y);
+	}
+
+	Highlight->HighlightStartIndex = FirstChar.value().CharacterOrder;
+	Highlight->HighlightEndIndex = LastChar.value().CharacterOrder;
+}
+
+void cbTextBox::ScrollToCursor()
+{
+	if (!Document || !CursorDocumentPosition.has_value())
+		return;
+
+	const std::size_t Line = CursorDocumentPosition.value().Line;
+	const std::size_t Lines = GetDocumentVisibleLineCount(false);
+	if (Line < FirstVisibleLine)
+		FirstVisibleLine = Line;
+	else if (Line >= FirstVisibleLine + Lines)
+		FirstVisibleLine = Line - Lines + 1;
+}
+
+bool cbTextBox::OnDocumentKeyDown(const char32_t Char)
+{
+	if (!CursorDocumentPosition.has_value())
+		return false;
+
+	if (Char != 8 && IsCharacterBlocked(Char))
+		return false;
+
+	std::size_t Offset = Document->GetOffset(CursorDocumentPosition.value());
+	bool bErased = false;
+
+	if (SelectionAnchor.has_value() && SelectionAnchor.value() != CursorDocumentPosition.value())
+	{
+		const std::size_t AnchorOffset = Document->GetOffset(SelectionAnchor.value());
+		const std::size_t Start = std::min(Offset, AnchorOffset);
+		Document->Erase(Start, std::max(Offset, AnchorOffset) - Start);
+		Offset = Start;
+		bErased = true;
+	}
+	SelectionAnchor = std::nullopt;
+
+	if (Char == 8)
+	{
+		if (!bErased && Offset > 0)
+		{
+			Offset--;
+			Document->Erase(Offset, 1);
+		}
+	}
+	else if (!Limit.has_value() || Limit.value() > Document->GetLength())
+	{
+		Document->Insert(Offset, std::u32string(1, Char == 13 ? U'\n' : Char));
+		Offset++;
+	}
+
+	CursorDocumentPosition = Document->GetPosition(Offset);
+
+	ScrollToCursor();
+	UpdateDocumentWindow();
+	WrapOrUpdateAlignments();
+
+	return true;
+}
+
 double u16stod(std::u32string const& u16s)
 {
 	char buf[std::numeric_limits<double>::max_digits10 + 1];
@@ -738,6 +1070,9 @@ bool cbTextBox::OnKeyDown(std::uint64_t KeyCode)
 
 	const char32_t C16((char32_t)KeyCode);
 
+	if (Document)
+		return OnDocumentKeyDown(C16);
+
 	if (C16 == 8)
 	{
 		if (SelectedIndex.has_value())
@@ -988,6 +1323,14 @@ bool cbTextBox::OnMouseButtonDown(const cbMouseInput& Mouse)
 				SetFocus(false);
 		}
 
+		if (Document)
+		{
+			CursorDocumentPosition = std::nullopt;
+			SelectionAnchor = std::nullopt;
+			Highlight->ClearHighlights();
+			return false;
+		}
+
 		if (TextBoxType == eTextBoxType::Integer)
 		{
 			if (GetTextSize() == 0)
@@ -1103,11 +1446,37 @@ bool cbTextBox::OnMouseButtonDown(const cbMouseInput& Mouse)
 		Cursor->UpdateVerticalAlignment();
 	}
 
+	if (Document)
+	{
+		if (SelectedIndex.has_value())
+		{
+			if ((GetAsyncKeyState(VK_SHIFT) & 0x8000) == 0 || !CursorDocumentPosition.has_value())
+				SelectionAnchor = std::nullopt;
+			else if (!SelectionAnchor.has_value())
+				SelectionAnchor = CursorDocumentPosition;
+
+			CursorDocumentPosition = Document->GetPosition(WindowOffset + SelectedIndex.value());
+		}
+		UpdateDocumentHighlight();
+		return true;
+	}
+
 	UpdateHighlight();
 
 	return true;
 }
 
+bool cbTextBox::OnMouseWheel(float WheelDelta, const cbMouseInput& Mouse)
+{
+	if (!Document || !IsFocused() || !IsEnabled())
+		return false;
+
+	const std::int64_t Line = static_cast<std::int64_t>(FirstVisibleLine) - static_cast<std::int64_t>(WheelDelta * 3.0f);
+	ScrollToLine(Line > 0 ? static_cast<std::size_t>(Line) : 0);
+
+	return true;
+}
+
 void cbTextBox::UpdateHighlight()
 {
 	if (PastSelectedIndex.has_value() && SelectedIndex.has_value())
@@ -1242,10 +1611,17 @@ void cbTextBox::WrapOrUpdateAlignments()
 void cbTextBox::UpdateSlotVerticalAlignment()
 {
 	if (TextSlot)
+	{
+		if (Document && GetDocumentVisibleLineCount() != VisibleLineCount)
+			UpdateDocumentWindow();
 		TextSlot->UpdateVerticalAlignment();
+	}
 
 	Cursor->UpdateVerticalAlignment();
-	Highlight->ClearHighlights();
+	if (Document)
+		UpdateDocumentHighlight();
+	else
+		Highlight->ClearHighlights();
 }
 
 void cbTextBox::UpdateSlotHorizontalAlignment()
@@ -1254,7 +1630,10 @@ void cbTextBox::UpdateSlotHorizontalAlignment()
 		TextSlot->UpdateHorizontalAlignment();
 
 	Cursor->UpdateHorizontalAlignment();
-	Highlight->ClearHighlights();
+	if (Document)
+		UpdateDocumentHighlight();
+	else
+		Highlight->ClearHighlights();
 }
 
 std::optional<cbBounds> cbTextBox::GetCursorSelectedCharBounds() const
@@ -27,6 +27,7 @@
 
 #include "cbSlottedBox.h"
 #include "cbString.h"
+#include "cbTextDocument.h"
 #include "cbImage.h"
 #include "cbComponent.h"
 #include "UIAnimation.h"
@@ -99,6 +100,8 @@ protected:
 
 		virtual bool HasAnyChildren() const { return Content != nullptr; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const { return std::vector<cbWidgetObj*>{ Content.get() }; }
+		virtual std::size_t GetChildrenCount() const { return Content ? 1 : 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const { return Index == 0 ? Content.get() : nullptr; }
 
 		virtual void Hidden(bool value) { Content->SetVisibilityState(value ? eVisibility::Hidden : eVisibility::Visible); }
 
@@ -126,6 +129,7 @@ protected:
 				return;
 
 			Location.Y = GetOwner<cbTextBox>()->GetLocation().Y;
+			InvalidateWorldCache();
 
 			Content->UpdateVerticalAlignment();
 		}
@@ -136,6 +140,7 @@ protected:
 				return;
 
 			Location.X = GetOwner<cbTextBox>()->GetLocation().X;
+			InvalidateWorldCache();
 
 			Content->UpdateHorizontalAlignment();
 		}
@@ -184,6 +189,7 @@ protected:
 			, CursorPosition(Other.CursorPosition)
 		{
 			SetName(Other.GetName());
+			SetTickEnabled(bIsEnabled);
 		}
 
 		virtual ~cbCursor()
@@ -228,8 +234,9 @@ protected:
 			}
 		}
 		virtual bool IsEnabled() const override final { return bIsEnabled; }
-		void Enable() { bIsEnabled = true; Hidden(false); }
-		void Disable() { bIsEnabled = false; Hidden(true); }
+		/* The cursor blinks only while it is enabled, it is ticked by the canvas until it is disabled. */
+		void Enable() { bIsEnabled = true; ElapsedTime = 0.0f; Hidden(false); SetTickEnabled(true); }
+		void Disable() { bIsEnabled = false; Hidden(true); SetTickEnabled(false); }
 
 		virtual cbBounds GetBounds() const { return cbBounds(GetDimension(), GetLocation()); }
 		virtual cbVector GetLocation() const { return CursorLocation; }
@@ -341,6 +348,9 @@ protected:
 		std::vector<cbBounds> Highlights;
 		std::optional<std::size_t> HighlightStartIndex;
 		std::optional<std::size_t> HighlightEndIndex;
+		/* Highlighted document range in large document mode. */
+		std::optional<cbTextPosition> HighlightStartPosition;
+		std::optional<cbTextPosition> HighlightEndPosition;
 
 	public:
 		TextHighlight(cbTextBox* Owner)
@@ -349,6 +359,8 @@ protected:
 			, bIsEnabled(true)
 			, HighlightStartIndex(std::nullopt)
 			, HighlightEndIndex(std::nullopt)
+			, HighlightStartPosition(std::nullopt)
+			, HighlightEndPosition(std::nullopt)
 		{}
 
 		TextHighlight(const TextHighlight& Other, cbTextBox* Owner)
@@ -357,6 +369,8 @@ protected:
 			, bIsEnabled(Other.bIsEnabled)
 			, HighlightStartIndex(Other.HighlightStartIndex)
 			, HighlightEndIndex(Other.HighlightEndIndex)
+			, HighlightStartPosition(Other.HighlightStartPosition)
+			, HighlightEndPosition(Other.HighlightEndPosition)
 		{
 			SetName(Other.GetName());
 		}
@@ -398,6 +412,8 @@ protected:
 		{
 			HighlightStartIndex = std::nullopt;
 			HighlightEndIndex = std::nullopt;
+			HighlightStartPosition = std::nullopt;
+			HighlightEndPosition = std::nullopt;
 			Highlights.clear();
 
 			if (cbICanvas* Canvas = GetCanvas())
@@ -522,13 +538,17 @@ public:
 
 	virtual cbSlot* GetSlot(const std::size_t Index = 0) const override final { return Index == 0 ? TextSlot.get() : nullptr; }
 	virtual std::vector<cbSlot*> GetSlots() const override { return std::vector<cbSlot*>{ TextSlot.get() }; }
-	virtual std::size_t GetSlotSize(const bool ExcludeHidden = false) const override final { if (TextSlot && (ExcludeHidden && !TextSlot->IsHidden())) return 1; return 0; }
+	virtual std::size_t GetSlotSize(const bool ExcludeHidden = false) const override final { if (!TextSlot || (ExcludeHidden && TextSlot->IsHidden())) return 0; return 1; }
 
 	virtual std::vector<cbWidgetObj*> GetAllChildren() const override;
+	virtual std::size_t GetChildrenCount() const override { return TextSlot ? 3 : 0; }
+	virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override;
 	virtual bool HasAnyChildren() const override { return TextSlot != nullptr; }
 
 	virtual bool HasAnyComponents() const override final { return true; }
 	virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>{ Cursor.get(), Highlight.get() }; }
+	virtual std::size_t GetComponentsCount() const override final { return 2; }
+	virtual cbComponent* GetComponentAt(const std::size_t Index) const override final;
 
 	virtual bool HasGeometry() const override final { return false; }
 	virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final { return std::vector<cbGeometryVertexData>(); };
@@ -544,6 +564,7 @@ public:
 	virtual bool OnMouseMove(const cbMouseInput& Mouse);
 	virtual bool OnMouseButtonUp(const cbMouseInput& Mouse);
 	virtual bool OnMouseButtonDown(const cbMouseInput& Mouse);
+	virtual bool OnMouseWheel(float WheelDelta, const cbMouseInput& Mouse);
 
 	virtual void UpdateVerticalAlignment(const bool ForceAlign = false) override final;
 	virtual void UpdateHorizontalAlignment(const bool ForceAlign = false) override final;
@@ -589,6 +610,24 @@ public:
 	void UnblockChars() { BlockChars.clear(); }
 	bool IsCharacterBlocked(char32_t Char) const;
 
+	/*
+	* Large document mode. The text box shows the document through a window of lines,
+	* only the lines inside the text box are shaped and drawn.
+	* Cursor and selection are kept in document line/column coordinates.
+	* A document created from the UTF-8 file content is not decoded, only the visible lines are.
+	* Auto wrap and text styling are disabled while a document is open.
+	*/
+	void OpenDocument(const cbTextDocument::SharedPtr& pDocument);
+	void CloseDocument();
+	bool IsLargeDocumentModeEnabled() const { return Document != nullptr; }
+	cbTextDocument::SharedPtr GetDocument() const { return Document; }
+	void ScrollToLine(std::size_t Line);
+	std::size_t GetFirstVisibleLine() const { return FirstVisibleLine; }
+	std::size_t GetVisibleLineCount() const { return VisibleLineCount; }
+	std::optional<cbTextPosition> GetCursorPosition() const { return CursorDocumentPosition; }
+	void SetCursorPosition(const cbTextPosition& Position);
+	void SetSelection(const cbTextPosition& Start, const cbTextPosition& End);
+
 protected:
 	void WrapOrUpdateAlignments();
 
@@ -601,6 +640,14 @@ protected:
 
 	void UpdateHighlight();
 
+	/* If IncludePartialLine is false, only the lines fully inside the text box are counted. */
+	std::size_t GetDocumentVisibleLineCount(const bool IncludePartialLine = true) const;
+	/* Shapes the visible lines of the document and maps the document cursor into them. */
+	void UpdateDocumentWindow();
+	void UpdateDocumentHighlight();
+	void ScrollToCursor();
+	bool OnDocumentKeyDown(const char32_t Char);
+
 private:
 	virtual std::size_t GetSlotIndex(const cbSlot* Slot) const { return 0; }
 
@@ -642,4 +689,16 @@ private:
 	eTextBoxType TextBoxType;
 	std::optional<std::size_t> Limit;
 	std::vector<char32_t> BlockChars;
+
+	cbTextDocument::SharedPtr Document;
+	std::size_t FirstVisibleLine;
+	std::size_t VisibleLineCount;
+	float DocumentLineHeight;
+	/* Document offset and length of the visible lines. */
+	std::size_t WindowOffset;
+	std::size_t WindowLength;
+	std::optional<cbTextPosition> CursorDocumentPosition;
+	std::optional<cbTextPosition> SelectionAnchor;
+	/* Layout cache setting of the text before the document was opened. */
+	bool bWasLayoutCacheEnabled;
 };
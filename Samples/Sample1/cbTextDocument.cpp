@@ -0,0 +1,497 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbTextDocument.h"
+#include <cbUtf8.h>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	inline bool IsContinuationByte(const char Byte)
+	{
+		return (static_cast<unsigned char>(Byte) & 0xC0) == 0x80;
+	}
+
+	/* Only valid UTF-8 is stored, every byte that is not a continuation byte starts a character. */
+	std::size_t CountChars(const char* Data, const std::size_t Size)
+	{
+		std::size_t Count = 0;
+		for (std::size_t i = 0; i < Size; i++)
+		{
+			if (!IsContinuationByte(Data[i]))
+				Count++;
+		}
+		return Count;
+	}
+
+	/* Returns the end of the range moved back to the start of a character. */
+	std::size_t AlignToChar(const std::string& Text, const std::size_t Start, std::size_t End)
+	{
+		while (End < Text.size() && End > Start + 1 && IsContinuationByte(Text[End]))
+			End--;
+		return End;
+	}
+
+	/* Replaces the invalid sequences with U+FFFD. A valid text is not copied. */
+	void ReplaceInvalidUtf8(std::string& Text)
+	{
+		constexpr std::size_t ChunkSize = 1024 * 1024;
+
+		std::u32string Decoded;
+		std::string Valid;
+		bool bIsValid = true;
+		for (std::size_t Start = 0; Start < Text.size();)
+		{
+			const std::size_t End = AlignToChar(Text, Start, std::min(Start + ChunkSize, Text.size()));
+			Decoded.clear();
+			if (!cbgui::DecodeUtf8(std::string_view(Text.data() + Start, End - Start), Decoded) && bIsValid)
+			{
+				bIsValid = false;
+				Valid.reserve(Text.size());
+				Valid.append(Text, 0, Start);
+			}
+
+			if (!bIsValid)
+				cbgui::EncodeUtf8(Decoded, Valid);
+			Start = End;
+		}
+
+		if (!bIsValid)
+			Text = std::move(Valid);
+	}
+
+	void AddLineBreaks(const std::string& Buffer, const std::size_t Start, std::vector<std::size_t>& LineBreaks)
+	{
+		const char* Data = Buffer.data();
+		const char* End = Data + Buffer.size();
+		for (const char* It = Data + Start; It < End; It++)
+		{
+			It = static_cast<const char*>(std::memchr(It, '\n', End - It));
+			if (!It)
+				break;
+			LineBreaks.push_back(static_cast<std::size_t>(It - Data));
+		}
+	}
+}
+
+cbTextDocument::cbTextDocument(const std::string& Text)
+	: Root(nullptr)
+	, Seed(0x9E3779B9u)
+{
+	SetText(std::string(Text));
+}
+
+cbTextDocument::cbTextDocument(std::string&& Text)
+	: Root(nullptr)
+	, Seed(0x9E3779B9u)
+{
+	SetText(std::move(Text));
+}
+
+cbTextDocument::cbTextDocument(const std::u32string& Text)
+	: Root(nullptr)
+	, Seed(0x9E3779B9u)
+{
+	SetText(Text);
+}
+
+cbTextDocument::~cbTextDocument()
+{
+	Root = nullptr;
+	Original.clear();
+	Added.clear();
+	OriginalLineBreaks.clear();
+	AddedLineBreaks.clear();
+}
+
+void cbTextDocument::SetText(std::string&& Text)
+{
+	Root = nullptr;
+	Added.clear();
+	AddedLineBreaks.clear();
+
+	Original = std::move(Text);
+	ReplaceInvalidUtf8(Original);
+
+	OriginalLineBreaks.clear();
+	AddLineBreaks(Original, 0, OriginalLineBreaks);
+	AppendPieces(ePieceBuffer::Original, 0, Original.size(), Root);
+}
+
+void cbTextDocument::SetText(const std::u32string& Text)
+{
+	SetText(cbgui::EncodeUtf8(Text));
+}
+
+void cbTextDocument::Clear()
+{
+	SetText(std::string());
+}
+
+std::size_t cbTextDocument::GetLineStart(const std::size_t Line) const
+{
+	if (Line == 0)
+		return 0;
+
+	/* The line starts after the line break with the index Line - 1. */
+	std::size_t LineBreak = Line - 1;
+	std::size_t Offset = 0;
+	const cbPiece* Node = Root.get();
+	while (Node)
+	{
+		const std::size_t LeftLineBreaks = Node->Left ? Node->Left->SubtreeLineBreakCount : 0;
+		if (LineBreak < LeftLineBreaks)
+		{
+			Node = Node->Left.get();
+			continue;
+		}
+
+		LineBreak -= LeftLineBreaks;
+		Offset += Node->Left ? Node->Left->SubtreeCharCount : 0;
+		if (LineBreak < Node->LineBreakCount)
+		{
+			const auto& LineBreaks = GetLineBreaks(Node->Buffer);
+			const auto First = std::lower_bound(LineBreaks.begin(), LineBreaks.end(), Node->Start);
+			return Offset + GetCharIndex(*Node, *(First + LineBreak) + 1 - Node->Start);
+		}
+
+		LineBreak -= Node->LineBreakCount;
+		Offset += Node->CharCount;
+		Node = Node->Right.get();
+	}
+	return GetLength();
+}
+
+std::size_t cbTextDocument::GetLineLength(const std::size_t Line) const
+{
+	const std::size_t LineCount = GetLineCount();
+	if (Line >= LineCount)
+		return 0;
+	const std::size_t End = Line + 1 < LineCount ? GetLineStart(Line + 1) - 1 : GetLength();
+	return End - GetLineStart(Line);
+}
+
+std::u32string cbTextDocument::GetText(const std::size_t Offset, const std::size_t Count) const
+{
+	std::u32string Text;
+	const std::size_t Length = GetLength();
+	if (Offset >= Length || Count == 0)
+		return Text;
+
+	const std::size_t End = Offset + std::min(Count, Length - Offset);
+	Text.reserve(End - Offset);
+
+	ForEachPiece(Root.get(), 0, Offset, End, [&](const cbPiece& Piece, const std::size_t PieceOffset)
+	{
+		const std::size_t First = GetByteIndex(Piece, Offset > PieceOffset ? Offset - PieceOffset : 0);
+		const std::size_t Last = GetByteIndex(Piece, std::min(End - PieceOffset, Piece.CharCount));
+		cbgui::DecodeUtf8(std::string_view(GetPieceData(Piece) + First, Last - First), Text);
+	});
+
+	return Text;
+}
+
+std::string cbTextDocument::GetUtf8Text() const
+{
+	std::string Text;
+	ForEachPiece(Root.get(), 0, 0, GetLength(), [&](const cbPiece& Piece, const std::size_t)
+	{
+		Text.append(GetPieceData(Piece), Piece.Size);
+	});
+	return Text;
+}
+
+std::u32string cbTextDocument::GetLine(const std::size_t Line) const
+{
+	return GetText(GetLineStart(Line), GetLineLength(Line));
+}
+
+std::u32string cbTextDocument::GetLines(const std::size_t FirstLine, const std::size_t Count) const
+{
+	const std::size_t LineCount = GetLineCount();
+	if (FirstLine >= LineCount || Count == 0)
+		return std::u32string();
+
+	const std::size_t LastLine = std::min(FirstLine + Count, LineCount) - 1;
+	const std::size_t Start = GetLineStart(FirstLine);
+	const std::size_t End = GetLineStart(LastLine) + GetLineLength(LastLine);
+	return GetText(Start, End - Start);
+}
+
+char32_t cbTextDocument::GetChar(const std::size_t Offset) const
+{
+	const std::u32string Char = GetText(Offset, 1);
+	return Char.empty() ? 0 : Char[0];
+}
+
+std::size_t cbTextDocument::GetOffset(const cbTextPosition& Position) const
+{
+	const std::size_t Line = std::min(Position.Line, GetLineCount() - 1);
+	return GetLineStart(Line) + std::min(Position.Column, GetLineLength(Line));
+}
+
+cbTextPosition cbTextDocument::GetPosition(const std::size_t Offset) const
+{
+	const std::size_t ClampedOffset = std::min(Offset, GetLength());
+
+	/* Counts the line breaks before the offset. */
+	std::size_t Line = 0;
+	std::size_t Char = ClampedOffset;
+	const cbPiece* Node = Root.get();
+	while (Node)
+	{
+		const std::size_t LeftChars = Node->Left ? Node->Left->SubtreeCharCount : 0;
+		if (Char < LeftChars)
+		{
+			Node = Node->Left.get();
+			continue;
+		}
+
+		Char -= LeftChars;
+		Line += Node->Left ? Node->Left->SubtreeLineBreakCount : 0;
+		if (Char < Node->CharCount)
+		{
+			Line += CountLineBreaks(Node->Buffer, Node->Start, Node->Start + GetByteIndex(*Node, Char));
+			break;
+		}
+
+		Char -= Node->CharCount;
+		Line += Node->LineBreakCount;
+		Node = Node->Right.get();
+	}
+
+	return cbTextPosition(Line, ClampedOffset - GetLineStart(Line));
+}
+
+void cbTextDocument::Insert(const std::size_t InOffset, const std::u32string& Text)
+{
+	if (Text.empty())
+		return;
+
+	const std::size_t Offset = std::min(InOffset, GetLength());
+	const std::size_t AddStart = Added.size();
+	cbgui::EncodeUtf8(Text, Added);
+	AddLineBreaks(Added, AddStart, AddedLineBreaks);
+	const std::size_t Size = Added.size() - AddStart;
+
+	std::unique_ptr<cbPiece> Left;
+	std::unique_ptr<cbPiece> Right;
+	Split(std::move(Root), Offset, Left, Right);
+
+	/* Consecutive typing extends the last piece of the add buffer. */
+	if (!ExtendLastPiece(Left.get(), AddStart, Size, Text.size()))
+		AppendPieces(ePieceBuffer::Add, AddStart, Size, Left);
+
+	Root = Merge(std::move(Left), std::move(Right));
+}
+
+void cbTextDocument::Erase(const std::size_t Offset, const std::size_t InCount)
+{
+	const std::size_t Length = GetLength();
+	if (Offset >= Length || InCount == 0)
+		return;
+
+	std::unique_ptr<cbPiece> Left;
+	std::unique_ptr<cbPiece> Erased;
+	std::unique_ptr<cbPiece> Right;
+	Split(std::move(Root), Offset, Left, Right);
+	Split(std::move(Right), std::min(InCount, Length - Offset), Erased, Right);
+
+	Root = Merge(std::move(Left), std::move(Right));
+}
+
+void cbTextDocument::Erase(const cbTextPosition& Start, const cbTextPosition& End)
+{
+	const std::size_t StartOffset = GetOffset(Start);
+	const std::size_t EndOffset = GetOffset(End);
+	if (StartOffset < EndOffset)
+		Erase(StartOffset, EndOffset - StartOffset);
+}
+
+std::uint32_t cbTextDocument::NextPriority()
+{
+	Seed ^= Seed << 13;
+	Seed ^= Seed >> 17;
+	Seed ^= Seed << 5;
+	return Seed;
+}
+
+const char* cbTextDocument::GetPieceData(const cbPiece& Piece) const
+{
+	return (Piece.Buffer == ePieceBuffer::Original ? Original.data() : Added.data()) + Piece.Start;
+}
+
+const std::vector<std::size_t>& cbTextDocument::GetLineBreaks(const ePieceBuffer Buffer) const
+{
+	return Buffer == ePieceBuffer::Original ? OriginalLineBreaks : AddedLineBreaks;
+}
+
+std::size_t cbTextDocument::CountLineBreaks(const ePieceBuffer Buffer, const std::size_t Start, const std::size_t End) const
+{
+	const auto& LineBreaks = GetLineBreaks(Buffer);
+	const auto First = std::lower_bound(LineBreaks.begin(), LineBreaks.end(), Start);
+	return std::distance(First, std::lower_bound(First, LineBreaks.end(), End));
+}
+
+std::size_t cbTextDocument::GetByteIndex(const cbPiece& Piece, const std::size_t Char) const
+{
+	/* ASCII pieces have a byte for each character. */
+	if (Piece.CharCount == Piece.Size || Char == 0)
+		return Char;
+	if (Char >= Piece.CharCount)
+		return Piece.Size;
+
+	const char* Data = GetPieceData(Piece);
+	std::size_t Count = 0;
+	for (std::size_t i = 0; i < Piece.Size; i++)
+	{
+		if (!IsContinuationByte(Data[i]) && Count++ == Char)
+			return i;
+	}
+	return Piece.Size;
+}
+
+std::size_t cbTextDocument::GetCharIndex(const cbPiece& Piece, const std::size_t Byte) const
+{
+	if (Piece.CharCount == Piece.Size)
+		return Byte;
+	return CountChars(GetPieceData(Piece), std::min(Byte, Piece.Size));
+}
+
+std::unique_ptr<cbTextDocument::cbPiece> cbTextDocument::CreatePiece(const ePieceBuffer Buffer, const std::size_t Start, const std::size_t Size, const std::size_t CharCount)
+{
+	return std::make_unique<cbPiece>(Buffer, Start, Size, CharCount, CountLineBreaks(Buffer, Start, Start + Size), NextPriority());
+}
+
+void cbTextDocument::AppendPieces(const ePieceBuffer Buffer, std::size_t Start, const std::size_t Size, std::unique_ptr<cbPiece>& Tree)
+{
+	const std::string& Data = Buffer == ePieceBuffer::Original ? Original : Added;
+	const std::size_t End = Start + Size;
+	while (Start < End)
+	{
+		/* A piece never ends inside a character. */
+		const std::size_t PieceEnd = End - Start > MaxPieceSize ? AlignToChar(Data, Start, Start + MaxPieceSize) : End;
+		Tree = Merge(std::move(Tree), CreatePiece(Buffer, Start, PieceEnd - Start, CountChars(Data.data() + Start, PieceEnd - Start)));
+		Start = PieceEnd;
+	}
+}
+
+bool cbTextDocument::ExtendLastPiece(cbPiece* Node, const std::size_t AddStart, const std::size_t Size, const std::size_t CharCount)
+{
+	if (!Node)
+		return false;
+
+	if (Node->Right)
+	{
+		if (!ExtendLastPiece(Node->Right.get(), AddStart, Size, CharCount))
+			return false;
+		Node->Update();
+		return true;
+	}
+
+	if (Node->Buffer != ePieceBuffer::Add || Node->Start + Node->Size != AddStart || Node->Size + Size > MaxPieceSize)
+		return false;
+
+	Node->Size += Size;
+	Node->CharCount += CharCount;
+	Node->LineBreakCount += CountLineBreaks(ePieceBuffer::Add, AddStart, AddStart + Size);
+	Node->Update();
+	return true;
+}
+
+void cbTextDocument::Split(std::unique_ptr<cbPiece> Node, const std::size_t Offset, std::unique_ptr<cbPiece>& Left, std::unique_ptr<cbPiece>& Right)
+{
+	if (!Node)
+	{
+		Left = nullptr;
+		Right = nullptr;
+		return;
+	}
+
+	const std::size_t LeftChars = Node->Left ? Node->Left->SubtreeCharCount : 0;
+	if (Offset <= LeftChars)
+	{
+		std::unique_ptr<cbPiece> Child = std::move(Node->Left);
+		Split(std::move(Child), Offset, Left, Node->Left);
+		Node->Update();
+		Right = std::move(Node);
+	}
+	else if (Offset >= LeftChars + Node->CharCount)
+	{
+		std::unique_ptr<cbPiece> Child = std::move(Node->Right);
+		Split(std::move(Child), Offset - LeftChars - Node->CharCount, Node->Right, Right);
+		Node->Update();
+		Left = std::move(Node);
+	}
+	else
+	{
+		/* The offset is inside the piece, the tail becomes a new piece. */
+		const std::size_t Char = Offset - LeftChars;
+		const std::size_t Byte = GetByteIndex(*Node, Char);
+		std::unique_ptr<cbPiece> Tail = CreatePiece(Node->Buffer, Node->Start + Byte, Node->Size - Byte, Node->CharCount - Char);
+		Node->Size = Byte;
+		Node->CharCount = Char;
+		Node->LineBreakCount -= Tail->LineBreakCount;
+
+		Right = Merge(std::move(Tail), std::move(Node->Right));
+		Node->Update();
+		Left = std::move(Node);
+	}
+}
+
+std::unique_ptr<cbTextDocument::cbPiece> cbTextDocument::Merge(std::unique_ptr<cbPiece> Left, std::unique_ptr<cbPiece> Right)
+{
+	if (!Left)
+		return Right;
+	if (!Right)
+		return Left;
+
+	if (Left->Priority > Right->Priority)
+	{
+		Left->Right = Merge(std::move(Left->Right), std::move(Right));
+		Left->Update();
+		return Left;
+	}
+
+	Right->Left = Merge(std::move(Left), std::move(Right->Left));
+	Right->Update();
+	return Right;
+}
+
+template<typename Function>
+void cbTextDocument::ForEachPiece(const cbPiece* Node, const std::size_t NodeOffset, const std::size_t Begin, const std::size_t End, const Function& Func) const
+{
+	if (!Node || Begin >= NodeOffset + Node->SubtreeCharCount || End <= NodeOffset)
+		return;
+
+	const std::size_t LeftChars = Node->Left ? Node->Left->SubtreeCharCount : 0;
+	const std::size_t PieceOffset = NodeOffset + LeftChars;
+	ForEachPiece(Node->Left.get(), NodeOffset, Begin, End, Func);
+	if (Begin < PieceOffset + Node->CharCount && End > PieceOffset)
+		Func(*Node, PieceOffset);
+	ForEachPiece(Node->Right.get(), PieceOffset + Node->CharCount, Begin, End, Func);
+}
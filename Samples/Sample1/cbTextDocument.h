@@ -0,0 +1,178 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <set>
+#include "cbClassBody.h"
+
+/* Line/Column location in a text document. */
+struct cbTextPosition
+{
+	std::size_t Line;
+	std::size_t Column;
+
+	constexpr cbTextPosition(std::size_t InLine = 0, std::size_t InColumn = 0)
+		: Line(InLine)
+		, Column(InColumn)
+	{}
+
+	constexpr bool operator==(const cbTextPosition& Other) const { return Line == Other.Line && Column == Other.Column; }
+	constexpr bool operator!=(const cbTextPosition& Other) const { return !(*this == Other); }
+	constexpr bool operator<(const cbTextPosition& Other) const { return Line < Other.Line || (Line == Other.Line && Column < Other.Column); }
+};
+
+/*
+* Piece table text buffer for large documents.
+* The loaded UTF-8 text is never decoded, copied or moved by edits, inserted text is appended to the add buffer
+* and the document is described by pieces of both buffers.
+* Pieces are kept in a balanced tree that sums their characters and line breaks, lookups and edits are O(log n).
+* Offsets and columns count code points, only the requested range is decoded.
+*/
+class cbTextDocument
+{
+	cbBaseClassBody(cbClassConstructor, cbTextDocument)
+private:
+	enum class ePieceBuffer : std::uint8_t
+	{
+		Original,
+		Add,
+	};
+
+	/* Byte range of a buffer. Pieces are the nodes of a treap ordered by their document offset. */
+	struct cbPiece
+	{
+		ePieceBuffer Buffer;
+		std::size_t Start;
+		std::size_t Size;
+		std::size_t CharCount;
+		std::size_t LineBreakCount;
+
+		std::uint32_t Priority;
+		std::unique_ptr<cbPiece> Left;
+		std::unique_ptr<cbPiece> Right;
+		/* Sums of the subtree, the piece included. */
+		std::size_t SubtreeCharCount;
+		std::size_t SubtreeLineBreakCount;
+
+		cbPiece(ePieceBuffer InBuffer, std::size_t InStart, std::size_t InSize, std::size_t InCharCount, std::size_t InLineBreakCount, std::uint32_t InPriority)
+			: Buffer(InBuffer)
+			, Start(InStart)
+			, Size(InSize)
+			, CharCount(InCharCount)
+			, LineBreakCount(InLineBreakCount)
+			, Priority(InPriority)
+			, Left(nullptr)
+			, Right(nullptr)
+			, SubtreeCharCount(InCharCount)
+			, SubtreeLineBreakCount(InLineBreakCount)
+		{}
+
+		void Update()
+		{
+			SubtreeCharCount = CharCount + (Left ? Left->SubtreeCharCount : 0) + (Right ? Right->SubtreeCharCount : 0);
+			SubtreeLineBreakCount = LineBreakCount + (Left ? Left->SubtreeLineBreakCount : 0) + (Right ? Right->SubtreeLineBreakCount : 0);
+		}
+	};
+
+	/* A lookup inside a piece scans its bytes, pieces are never longer than this. */
+	static constexpr std::size_t MaxPieceSize = 64 * 1024;
+
+	std::string Original;
+	std::string Added;
+	/* Sorted byte index of each line break of the buffers. */
+	std::vector<std::size_t> OriginalLineBreaks;
+	std::vector<std::size_t> AddedLineBreaks;
+	std::unique_ptr<cbPiece> Root;
+	std::uint32_t Seed;
+
+public:
+	cbTextDocument(const std::string& Text = std::string());
+	cbTextDocument(std::string&& Text);
+	cbTextDocument(const std::u32string& Text);
+
+	virtual ~cbTextDocument();
+
+	/*
+	* Deletes the existing text and the edit history, adds a new one.
+	* The UTF-8 text is kept as is, invalid sequences are replaced with U+FFFD.
+	*/
+	void SetText(std::string&& Text);
+	void SetText(const std::string& Text) { SetText(std::string(Text)); }
+	void SetText(const std::u32string& Text);
+	void Clear();
+
+	std::size_t GetLength() const { return Root ? Root->SubtreeCharCount : 0; }
+	std::size_t GetLineCount() const { return (Root ? Root->SubtreeLineBreakCount : 0) + 1; }
+	std::size_t GetLineStart(const std::size_t Line) const;
+	/* Returns the length of the line without the line break. */
+	std::size_t GetLineLength(const std::size_t Line) const;
+
+	std::u32string GetText() const { return GetText(0, GetLength()); }
+	std::u32string GetText(const std::size_t Offset, const std::size_t Count) const;
+	/* Returns the whole document without decoding it. */
+	std::string GetUtf8Text() const;
+	/* Returns the line without the line break. */
+	std::u32string GetLine(const std::size_t Line) const;
+	/* Returns the given range of lines separated by line breaks, without the last line break. */
+	std::u32string GetLines(const std::size_t FirstLine, const std::size_t Count) const;
+	char32_t GetChar(const std::size_t Offset) const;
+
+	/* Position is clamped to the document. */
+	std::size_t GetOffset(const cbTextPosition& Position) const;
+	cbTextPosition GetPosition(const std::size_t Offset) const;
+
+	void Insert(const std::size_t Offset, const std::u32string& Text);
+	void Insert(const cbTextPosition& Position, const std::u32string& Text) { Insert(GetOffset(Position), Text); }
+	void Erase(const std::size_t Offset, const std::size_t Count);
+	/* Erases the characters between Start and End. End is not included. */
+	void Erase(const cbTextPosition& Start, const cbTextPosition& End);
+
+private:
+	std::uint32_t NextPriority();
+	const char* GetPieceData(const cbPiece& Piece) const;
+	const std::vector<std::size_t>& GetLineBreaks(const ePieceBuffer Buffer) const;
+	/* Returns the line breaks of the buffer between the byte indexes, End is not included. */
+	std::size_t CountLineBreaks(const ePieceBuffer Buffer, const std::size_t Start, const std::size_t End) const;
+	/* Converts a character index of the piece to a byte index and back. */
+	std::size_t GetByteIndex(const cbPiece& Piece, const std::size_t Char) const;
+	std::size_t GetCharIndex(const cbPiece& Piece, const std::size_t Byte) const;
+
+	std::unique_ptr<cbPiece> CreatePiece(const ePieceBuffer Buffer, const std::size_t Start, const std::size_t Size, const std::size_t CharCount);
+	/* Cuts the byte range into pieces and appends them to the tree. */
+	void AppendPieces(const ePieceBuffer Buffer, std::size_t Start, const std::size_t Size, std::unique_ptr<cbPiece>& Tree);
+	/* Grows the last piece if the text was appended right after it in the add buffer. */
+	bool ExtendLastPiece(cbPiece* Node, const std::size_t AddStart, const std::size_t Size, const std::size_t CharCount);
+	/* Left gets the characters before the offset, a piece at the offset is cut in two. */
+	void Split(std::unique_ptr<cbPiece> Node, const std::size_t Offset, std::unique_ptr<cbPiece>& Left, std::unique_ptr<cbPiece>& Right);
+	static std::unique_ptr<cbPiece> Merge(std::unique_ptr<cbPiece> Left, std::unique_ptr<cbPiece> Right);
+	/* Calls the function for each piece that intersects the range, in document order. */
+	template<typename Function>
+	void ForEachPiece(const cbPiece* Node, const std::size_t NodeOffset, const std::size_t Begin, const std::size_t End, const Function& Func) const;
+};
@@ -0,0 +1,101 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+/*
+* Prints the size and the heap footprint of the widgets.
+* The heap bytes are counted by the global operator new while T::Create() runs, the shared pointer control block included.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "cbgui.h"
+
+#if defined(_MSC_VER)
+#pragma comment(lib, "CBGUI.lib")
+#endif
+
+using namespace cbgui;
+
+/* Upper bounds of the compacted state, a new member that grows them should be moved to the widget extension. */
+#if defined(_WIN64) || defined(__x86_64__) || defined(__aarch64__)
+static_assert(sizeof(cbTransform) <= 72, "cbTransform grew past its compacted size.");
+static_assert(sizeof(cbWidget) <= 160, "cbWidget grew past its compacted size.");
+#endif
+
+static std::size_t AllocatedBytes = 0;
+static std::size_t AllocationCount = 0;
+
+void* operator new(std::size_t Size)
+{
+	AllocatedBytes += Size;
+	AllocationCount++;
+	if (void* Ptr = std::malloc(Size ? Size : 1))
+		return Ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* Ptr) noexcept
+{
+	std::free(Ptr);
+}
+
+void operator delete(void* Ptr, std::size_t) noexcept
+{
+	std::free(Ptr);
+}
+
+template<typename T>
+static void PrintFootprint(const char* Name)
+{
+	/* The first widget of a type may create shared state, it is not counted. */
+	{
+		auto Warmup = T::Create();
+	}
+
+	const std::size_t Bytes = AllocatedBytes;
+	const std::size_t Count = AllocationCount;
+	auto Widget = T::Create();
+	std::printf("%-16s sizeof %4zu  heap %5zu bytes in %2zu allocations\n", Name, sizeof(T), AllocatedBytes - Bytes, AllocationCount - Count);
+}
+
+int main()
+{
+	std::printf("%-16s sizeof %4zu\n", "cbWidget", sizeof(cbWidget));
+	std::printf("%-16s sizeof %4zu\n", "cbTransform", sizeof(cbTransform));
+	std::printf("%-16s sizeof %4zu\n", "cbSlot", sizeof(cbSlot));
+
+	PrintFootprint<cbImage>("cbImage");
+	PrintFootprint<cbButton>("cbButton");
+	PrintFootprint<cbCheckBox>("cbCheckBox");
+	PrintFootprint<cbSlider>("cbSlider");
+	PrintFootprint<cbBorder>("cbBorder");
+	PrintFootprint<cbSizeBox>("cbSizeBox");
+	PrintFootprint<cbOverlay>("cbOverlay");
+	PrintFootprint<cbVerticalBox>("cbVerticalBox");
+	PrintFootprint<cbHorizontalBox>("cbHorizontalBox");
+	PrintFootprint<cbScrollBox>("cbScrollBox");
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <array>
+#include <memory>
+#include <new>
+#include <vector>
+#include <cstddef>
+
+namespace cbgui
+{
+	/*
+	* Memory of the objects created by cbClassConstructor::Create while the arena is bound, see cbArenaScope.
+	* The blocks are served from size class pools, consecutive objects are placed next to each other.
+	* Freed blocks return to the pool, the chunks are released together when the last object of the arena is destroyed.
+	* Not thread safe, an arena is used by the thread that builds and destroys its widgets.
+	*/
+	class cbArena : public std::enable_shared_from_this<cbArena>
+	{
+	public:
+		using SharedPtr = std::shared_ptr<cbArena>;
+
+		/* Larger or over-aligned allocations go to the global heap. */
+		static constexpr std::size_t MaxPooledSize = 2048;
+		static constexpr std::size_t Granularity = 16;
+		static constexpr std::size_t ChunkSize = 64 * 1024;
+
+		static SharedPtr Create(const std::size_t InChunkSize = ChunkSize) { return SharedPtr(new cbArena(InChunkSize)); }
+
+	private:
+		cbArena(const std::size_t InChunkSize);
+
+	public:
+		~cbArena();
+
+		cbArena(const cbArena&) = delete;
+		cbArena& operator=(const cbArena&) = delete;
+
+		void* Allocate(const std::size_t Size, const std::size_t Alignment);
+		void Deallocate(void* Ptr, const std::size_t Size, const std::size_t Alignment);
+
+		/* Bytes in use by the live objects. */
+		inline std::size_t GetUsedBytes() const { return UsedBytes; }
+		/* Bytes reserved from the global heap. */
+		inline std::size_t GetReservedBytes() const { return Chunks.size() * ChunkBytes + HeapBytes; }
+		inline std::size_t GetAllocationCount() const { return AllocationCount; }
+
+		/* The arena that Create allocates from on the calling thread, null for the global heap. */
+		static void Bind(cbArena* Arena);
+		static cbArena* GetBound();
+
+	private:
+		static constexpr bool IsPooled(const std::size_t Size, const std::size_t Alignment) { return Size <= MaxPooledSize && Alignment <= Granularity; }
+		static constexpr std::size_t GetPoolIndex(const std::size_t Size) { return Size == 0 ? 0 : (Size - 1) / Granularity; }
+
+		struct cbFreeBlock
+		{
+			cbFreeBlock* Next;
+		};
+
+		std::array<cbFreeBlock*, MaxPooledSize / Granularity> FreeLists;
+		std::vector<unsigned char*> Chunks;
+		unsigned char* Cursor;
+		std::size_t Remaining;
+		const std::size_t ChunkBytes;
+
+		std::size_t UsedBytes;
+		std::size_t HeapBytes;
+		std::size_t AllocationCount;
+	};
+
+	/* Binds the arena to the calling thread until the scope ends, the previous arena is restored. */
+	class cbArenaScope
+	{
+	public:
+		cbArenaScope(const cbArena::SharedPtr& InArena)
+			: Arena(InArena)
+			, Previous(cbArena::GetBound())
+		{
+			cbArena::Bind(Arena.get());
+		}
+		~cbArenaScope()
+		{
+			cbArena::Bind(Previous);
+		}
+
+		cbArenaScope(const cbArenaScope&) = delete;
+		cbArenaScope& operator=(const cbArenaScope&) = delete;
+
+	private:
+		cbArena::SharedPtr Arena;
+		cbArena* Previous;
+	};
+
+	/* Standard allocator over an arena. The objects keep the arena alive until they are destroyed. */
+	template<typename T>
+	class cbArenaAllocator
+	{
+		template<typename U> friend class cbArenaAllocator;
+	public:
+		using value_type = T;
+
+		cbArenaAllocator(const cbArena::SharedPtr& InArena)
+			: Arena(InArena)
+		{}
+		template<typename U>
+		cbArenaAllocator(const cbArenaAllocator<U>& Other)
+			: Arena(Other.Arena)
+		{}
+
+		T* allocate(const std::size_t Count) { return static_cast<T*>(Arena->Allocate(Count * sizeof(T), alignof(T))); }
+		void deallocate(T* Ptr, const std::size_t Count) { Arena->Deallocate(Ptr, Count * sizeof(T), alignof(T)); }
+
+		template<typename U>
+		bool operator==(const cbArenaAllocator<U>& Other) const { return Arena == Other.Arena; }
+		template<typename U>
+		bool operator!=(const cbArenaAllocator<U>& Other) const { return Arena != Other.Arena; }
+
+	private:
+		cbArena::SharedPtr Arena;
+	};
+
+	/* make_shared that allocates the object and its control block from the bound arena, if any. */
+	template<typename T, typename... Args>
+	inline std::shared_ptr<T> cbMakeShared(Args&&... args)
+	{
+		if (cbArena* Arena = cbArena::GetBound())
+			return std::allocate_shared<T>(cbArenaAllocator<T>(Arena->shared_from_this()), std::forward<Args>(args)...);
+		return std::make_shared<T>(std::forward<Args>(args)...);
+	}
+}
@@ -91,6 +91,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const override final { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const override final { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual cbBounds GetBounds() const override final { return cbBounds(GetOwner<cbBorder>()->GetSlotDimension(), Location); }
 			virtual cbVector GetLocation() const override final { return Location; }
@@ -101,6 +103,7 @@ namespace cbgui
 			virtual void UpdateVerticalAlignment() override final
 			{
 				Location.Y = GetOwner<cbBorder>()->GetVerticalSlotLocation();
+				InvalidateWorldCache();
 
 				if (Content)
 					Content->UpdateVerticalAlignment();
@@ -109,6 +112,7 @@ namespace cbgui
 			virtual void UpdateHorizontalAlignment() override final
 			{
 				Location.X = GetOwner<cbBorder>()->GetHorizontalSlotLocation();
+				InvalidateWorldCache();
 
 				if (Content)
 					Content->UpdateHorizontalAlignment();
@@ -192,19 +196,26 @@ namespace cbgui
 
 		/* Returns slots. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final;
+		virtual std::size_t GetChildrenCount() const override final { return Slot ? 1 : 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Slot.get() : nullptr; }
 		/* Checks whether a slot has been created. */
 		virtual bool HasAnyChildren() const override final { return Slot != nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 	public:
 		virtual bool HasGeometry() const override final { return true; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
 		virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 		virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
-		cbVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle; }
+		virtual std::optional<cbColor> GetVertexColor(const bool LineGeometry = false) const override final;
+		cbVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle.Get(); }
 		void SetVertexColorStyle(const cbVertexColorStyle& style);
+		/* References the shared style, see cbStyleRegistry. */
+		void SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle);
 
 	private:
 		virtual void OnAttach() override final;
@@ -220,7 +231,7 @@ namespace cbgui
 		virtual bool UnWrapHorizontal() override final;
 
 	private:
-		cbVertexColorStyle VertexColorStyle;
+		cbStyleRef<cbVertexColorStyle> VertexColorStyle;
 		cbTransform Transform;
 		cbMargin BorderThickness;
 		cbBorderSlot::SharedPtr Slot;
@@ -36,7 +36,7 @@ namespace cbgui
 	{
 		cbClassBody(cbClassConstructor, cbButton, cbWidget)
 	private:
-		cbButtonVertexColorStyle VertexColorStyle;
+		cbStyleRef<cbButtonVertexColorStyle> VertexColorStyle;
 		cbTransform Transform;
 
 		std::function<void()> fOnClicked;
@@ -128,18 +128,25 @@ namespace cbgui
 	public:
 		virtual bool HasGeometry() const override final { return true; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
+		virtual std::optional<cbColor> GetVertexColor(const bool LineGeometry = false) const override final;
 		virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 		virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
 
-		cbButtonVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle; }
+		cbButtonVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle.Get(); }
 		void SetVertexColorStyle(const cbButtonVertexColorStyle& style);
 		void SetVertexColorStyle(const eButtonState State, const cbColor& Color);
+		/* References the shared style, see cbStyleRegistry. */
+		void SetVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle);
 
 		virtual bool HasAnyChildren() const override final { return false; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>(); }
+		virtual std::size_t GetChildrenCount() const override final { return 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 	public:
 		virtual bool OnMouseEnter(const cbMouseInput& Mouse) override;
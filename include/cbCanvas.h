@@ -56,16 +56,32 @@ namespace cbgui
 		/* Called when any widget transform is updated or the Vertex Color Style is updated. */
 		virtual void WidgetUpdated(cbWidgetObj* Widget) = 0;
 		/*
+		* Called when only the vertex color of the widget is changed. e.g; Hover, press or check state transitions.
+		* The positions and texture coordinates are unchanged, see cbWidgetObj::GetVertexColor.
+		*/
+		virtual void WidgetColorUpdated(cbWidgetObj* Widget) = 0;
+		/*
+		* Called when only a range of the vertices is changed, the vertex count is unchanged. e.g; A numeric text that replaced a few digits.
+		* The range indexes the vertex data of the widget, see cbWidgetObj::GetVertexRangeData.
+		*/
+		virtual void WidgetVerticesUpdated(cbWidgetObj* Widget, const std::size_t FirstVertex, const std::size_t VertexCount) = 0;
+		/*
 		* Called when the vertex size gets bigger or smaller. 
 		* e.g; When a letter is added to the text.
 		*/
 		virtual void VerticesSizeChanged(cbWidgetObj* Widget, const std::size_t NewSize) = 0;
+		/* Called when the render transform of the widget is updated. The geometry of the widget and its children is unchanged. */
+		virtual void RenderTransformUpdated(cbWidgetObj* Widget) = 0;
+		/* Called when the widget or component enables or disables ticking, or changes the tick interval. */
+		virtual void TickUpdated(cbWidgetObj* Widget) = 0;
 
 		virtual void NewSlotAdded(cbSlottedBox* Parent, cbSlot* Slot) = 0;
 		virtual void SlotRemoved(cbSlottedBox* Parent, cbSlot* Slot) = 0;
 		virtual void SlotContentReplaced(cbSlot* Parent, cbWidget* Old, cbWidget* New) = 0;
 
 		virtual void VisibilityChanged(cbWidgetObj* Widget) = 0;
+		/* Called when the widget gains or loses focus. The keyboard input is routed to the focused widget. */
+		virtual void FocusChanged(cbWidget* Widget) = 0;
 
 		virtual void ZOrderModeUpdated(cbWidgetObj* Widget) = 0;
 		virtual void ZOrderChanged(cbWidgetObj* Widget, const std::int32_t ZOrder) = 0;
@@ -29,6 +29,7 @@
 #include <memory>
 #include <set>
 #include <vector>
+#include "cbArena.h"
 
 namespace cbgui
 {
@@ -62,7 +63,7 @@ namespace cbgui
 		template <typename... Args>																											\
 		static inline Class::SharedPtr Create(Args&&... other)																				\
 		{																																	\
-			auto pClass = std::make_shared<Class>(std::forward<Args>(other)...);															\
+			auto pClass = cbgui::cbMakeShared<Class>(std::forward<Args>(other)...);														\
 			return pClass;																													\
 		}																																	\
 		template <typename... Args>																											\
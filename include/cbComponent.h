@@ -38,6 +38,7 @@ namespace cbgui
 		cbComponent* ComponentOwner;
 		std::optional<std::string> Name;
 		std::optional<float> VertexColorAlpha;
+		std::optional<float> TickInterval;
 
 	public:
 		cbComponent(cbWidget* pOwner)
@@ -45,12 +46,14 @@ namespace cbgui
 			, ComponentOwner(nullptr)
 			, Name(std::nullopt)
 			, VertexColorAlpha(std::nullopt)
+			, TickInterval(std::nullopt)
 		{}
 		cbComponent(cbComponent* pComponentOwner)
 			: Owner(pComponentOwner->Owner)
 			, ComponentOwner(pComponentOwner)
 			, Name(std::nullopt)
 			, VertexColorAlpha(std::nullopt)
+			, TickInterval(std::nullopt)
 		{}
 
 	public:
@@ -61,7 +64,22 @@ namespace cbgui
 		}
 
 		virtual void BeginPlay() {}
-		virtual void Tick(float DeltaTime) {}
+		virtual void Tick(float DeltaTime) override {}
+
+		/* Registers the component to the tick list of the canvas, an interval of 0 ticks every frame. */
+		void SetTickEnabled(const bool Value, const float Interval = 0.0f)
+		{
+			const std::optional<float> NewInterval = Value ? std::optional<float>(std::max(Interval, 0.0f)) : std::nullopt;
+			if (TickInterval == NewInterval)
+				return;
+
+			TickInterval = NewInterval;
+
+			if (HasCanvas())
+				GetCanvas()->TickUpdated(this);
+		}
+		inline bool IsTickEnabled() const { return TickInterval.has_value(); }
+		virtual std::optional<float> GetTickInterval() const override final { return TickInterval; }
 
 		virtual std::string GetName() const override final
 		{
@@ -93,9 +111,25 @@ namespace cbgui
 
 		virtual bool HasAnyChildren() const override { return false; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override { return std::vector<cbWidgetObj*>(); }
+		virtual std::size_t GetChildrenCount() const override { return 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override { return nullptr; }
 
 		virtual bool HasAnyComponents() const { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const { return nullptr; }
+
+		/* Visits the components without allocating. */
+		template<typename Function>
+		void ForEachComponent(Function&& Func) const
+		{
+			const std::size_t Count = GetComponentsCount();
+			for (std::size_t i = 0; i < Count; i++)
+			{
+				if (cbComponent* Component = GetComponentAt(i))
+					Func(Component);
+			}
+		}
 
 		virtual bool HasGeometry() const override { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override { return std::vector<cbGeometryVertexData>(); };
@@ -110,6 +144,7 @@ namespace cbgui
 
 		bool NotifyCanvas_WidgetUpdated()
 		{
+			InvalidateWorldCache();
 			if (HasCanvas())
 			{
 				GetCanvas()->WidgetUpdated(this);
@@ -118,6 +153,16 @@ namespace cbgui
 			return false;
 		}
 
+		bool NotifyCanvas_ColorUpdated()
+		{
+			if (HasCanvas())
+			{
+				GetCanvas()->WidgetColorUpdated(this);
+				return true;
+			}
+			return false;
+		}
+
 		void UpdateAlignments() { UpdateVerticalAlignment(); UpdateHorizontalAlignment(); }
 		virtual void UpdateVerticalAlignment() = 0;
 		virtual void UpdateHorizontalAlignment() = 0;
@@ -134,46 +179,46 @@ namespace cbgui
 		virtual cbVector GetRotatorOrigin() const override { return Owner->GetRotatorOrigin(); }
 		virtual bool IsRotated() const override { return Owner->IsRotated(); }
 		virtual float GetRotation() const override { return IsItAttachedToComponent() ? ComponentOwner->GetRotation() : Owner->GetRotation(); }
+		virtual bool HasRenderTransform() const override { return Owner->HasRenderTransform(); }
+		virtual cbMatrix2x3 GetRenderMatrix() const override { return Owner->GetRenderMatrix(); }
+		virtual float GetRenderOpacity() const override { return Owner->GetRenderOpacity(); }
 
 		virtual void SetVertexColorAlpha(std::optional<float> Alpha, bool PropagateToChildren = true) override final
 		{
 			VertexColorAlpha = Alpha;
 
-			auto Components = GetAllComponents();
-			for (const auto& Component : Components)
-				Component->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren);
+			ForEachComponent([&](cbComponent* Component) { Component->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren); });
 
 			if (PropagateToChildren)
-			{
-				auto Children = GetAllChildren();
-
-				for (const auto& Child : Children)
-					Child->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren);
-			}
+				ForEachChild([&](cbWidgetObj* Child) { Child->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren); });
 
 			if (Owner->bShouldNotifyCanvas)
 				NotifyCanvas_WidgetUpdated();
 		}
 		virtual std::optional<float> GetVertexColorAlpha() const override final { return VertexColorAlpha; }
+		virtual void VertexColorStyleUpdated() override { NotifyCanvas_ColorUpdated(); }
 
 		/* Resets the focus and input state. */
 		virtual void ResetInput() = 0;
 
 		virtual bool IsInside(const cbVector& Location) const
 		{
+			const cbVector Point = HasRenderTransform() ? Owner->GetInverseRenderMatrix().TransformPoint(Location) : Location;
 			if (GetRotation() != 0.0f)
-				return cbgui::IsInside(GetBounds(), Location, GetRotation(), GetRotatorOrigin());
-			return cbgui::IsInside(GetBounds(), Location);
+				return cbgui::IsInside(GetBounds(), Point, GetRotation(), GetRotatorOrigin());
+			return cbgui::IsInside(GetBounds(), Point);
 		}
 		virtual bool Intersect(const cbBounds& Other) const
 		{
+			const cbBounds Bounds = HasRenderTransform() ? Owner->GetInverseRenderMatrix().TransformBounds(Other) : Other;
 			if (GetRotation() != 0.0f)
-				return cbgui::Intersect(GetBounds(), Other, GetRotation(), GetRotatorOrigin());
-			return cbgui::Intersect(GetBounds(), Other);
+				return cbgui::Intersect(GetBounds(), Bounds, GetRotation(), GetRotatorOrigin());
+			return cbgui::Intersect(GetBounds(), Bounds);
 		}
 
 		virtual bool IsItCulled() const override { return IsItAttachedToComponent() ? ComponentOwner->IsItCulled() : Owner->IsItCulled(); }
 		virtual cbBounds GetCulledBounds() const override { return IsItAttachedToComponent() ? ComponentOwner->GetCulledBounds() : Owner->GetCulledBounds(); }
+		virtual cbBounds GetRenderBounds() const override { return IsItAttachedToComponent() ? ComponentOwner->GetRenderBounds() : Owner->GetRenderBounds(); }
 
 		virtual bool IsEnabled() const override { return IsItAttachedToComponent() ? ComponentOwner->IsEnabled() : Owner->IsEnabled(); }
 
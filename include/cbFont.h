@@ -27,15 +27,19 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
+#include <cstdint>
 
 #include "cbClassBody.h"
 
 #include "cbGeometry.h"
 #include "cbVertexColorStyle.h"
+#include "cbStyleRegistry.h"
 
 namespace cbgui
 {
@@ -131,9 +135,30 @@ namespace cbgui
 
 		/*
 		* Called when new Glyph is added.
+		* After the atlas is compacted, it is called once with the whole texture.
 		*/
 		std::function<void(const void*, std::size_t, std::size_t, std::size_t, std::size_t, std::size_t)> fFontTextureUpdate_Callback;
 
+		/*
+		* When the used atlas height passes 'AtlasHighWaterMark', glyphs that are not used by any text
+		* for 'GlyphEvictionAge' frames are evicted and the atlas is compacted.
+		* Frames are counted by cbIFontFamily::BeginFrame, the eviction runs in the next BeginFrame.
+		* dafault : false
+		*/
+		bool bEnableGlyphEviction;
+		// Ratio of the atlas height. dafault : 0.9f
+		float AtlasHighWaterMark;
+		// dafault : 300
+		std::uint32_t GlyphEvictionAge;
+
+		/*
+		* Families with the same atlas and rasterization settings share the font faces, glyphs and the texture atlas.
+		* Faces are matched by the canonical file path or by the hash of the font data.
+		* Font data loaded from memory is copied and owned by the shared face.
+		* dafault : true
+		*/
+		bool bShareFontFaces;
+
 		// dafault : 2048
 		std::uint32_t AtlasWidth;
 		// dafault : 2048
@@ -164,6 +189,10 @@ namespace cbgui
 			, UseVerticalAligment(VerticalAligment)
 			, CharPadding(cbMargin())
 			, fFontTextureUpdate_Callback(nullptr)
+			, bEnableGlyphEviction(false)
+			, AtlasHighWaterMark(0.9f)
+			, GlyphEvictionAge(300)
+			, bShareFontFaces(true)
 			, SDF(false)
 			, Spread(4)
 			, Overlaps(0)
@@ -248,6 +277,55 @@ namespace cbgui
 		{}
 	};
 
+	/* Styled span of text. Can be used instead of style tags. */
+	struct cbTextStyleRun
+	{
+		std::size_t Start;
+		std::size_t Length;
+		/* Index of the style in the text styles. */
+		std::size_t StyleIndex;
+
+		cbFORCEINLINE constexpr cbTextStyleRun()
+			: Start(0)
+			, Length(0)
+			, StyleIndex(0)
+		{}
+		cbFORCEINLINE constexpr cbTextStyleRun(std::size_t InStart, std::size_t InLength, std::size_t InStyleIndex)
+			: Start(InStart)
+			, Length(InLength)
+			, StyleIndex(InStyleIndex)
+		{}
+	};
+
+	/* Range of lines and glyph quads. End values are not included. */
+	struct cbTextGlyphRange
+	{
+		std::size_t FirstLine;
+		std::size_t EndLine;
+		std::size_t FirstGlyph;
+		std::size_t EndGlyph;
+
+		cbFORCEINLINE constexpr cbTextGlyphRange()
+			: FirstLine(0)
+			, EndLine(0)
+			, FirstGlyph(0)
+			, EndGlyph(0)
+		{}
+		cbFORCEINLINE constexpr cbTextGlyphRange(std::size_t InFirstLine, std::size_t InEndLine, std::size_t InFirstGlyph, std::size_t InEndGlyph)
+			: FirstLine(InFirstLine)
+			, EndLine(InEndLine)
+			, FirstGlyph(InFirstGlyph)
+			, EndGlyph(InEndGlyph)
+		{}
+
+		cbFORCEINLINE constexpr std::size_t GetGlyphCount() const { return EndGlyph - FirstGlyph; }
+		cbFORCEINLINE constexpr bool operator==(const cbTextGlyphRange& Other) const
+		{
+			return FirstLine == Other.FirstLine && EndLine == Other.EndLine && FirstGlyph == Other.FirstGlyph && EndGlyph == Other.EndGlyph;
+		}
+		cbFORCEINLINE constexpr bool operator!=(const cbTextGlyphRange& Other) const { return !(*this == Other); }
+	};
+
 	/* Text Data. */
 	struct cbTextMetrics
 	{
@@ -347,6 +425,151 @@ namespace cbgui
 			}
 		};
 
+		/*
+		* Character data stored as structure of arrays.
+		* Layout and geometry loops only stream the arrays they need.
+		* Line, filtered and ignored counts are maintained on every change.
+		*/
+		class cbCharacterArray
+		{
+		public:
+			static constexpr std::uint16_t NoColor = 0xFFFF;
+
+			std::u32string Codepoints;
+			std::vector<std::uint32_t> WordOrders;
+			std::vector<std::uint32_t> LineOrders;
+			std::vector<std::uint16_t> CharacterSizes;
+			std::vector<eFontType> Types;
+			std::vector<std::int16_t> Ascenders;
+			std::vector<std::int16_t> Descenders;
+			std::vector<std::int16_t> XAdvances;
+			std::vector<std::int16_t> BearingXs;
+			std::vector<cbBounds> Bounds;
+			std::vector<cbBounds> TextureCoordinates;
+			std::vector<float> Kernings;
+			std::vector<float> AlignedKernings;
+			std::vector<std::uint8_t> Ignored;
+			/* Index into Colors, NoColor if the character uses the vertex color style. */
+			std::vector<std::uint16_t> ColorIndices;
+			std::vector<cbColor> Colors;
+
+		private:
+			std::size_t NewLineCount;
+			std::size_t FilteredCount;
+			std::size_t IgnoredCount;
+
+		public:
+			cbFORCEINLINE cbCharacterArray()
+				: NewLineCount(0)
+				, FilteredCount(0)
+				, IgnoredCount(0)
+			{}
+			cbFORCEINLINE ~cbCharacterArray() = default;
+
+			cbFORCEINLINE std::size_t size() const { return Codepoints.size(); }
+			cbFORCEINLINE bool empty() const { return Codepoints.empty(); }
+
+			cbFORCEINLINE bool IsNewLine(const std::size_t i) const { return Codepoints[i] == '\n'; }
+			cbFORCEINLINE bool IsSpace(const std::size_t i) const { return Codepoints[i] == 32; }
+			cbFORCEINLINE bool IsIgnored(const std::size_t i) const { return Ignored[i] != 0; }
+			cbFORCEINLINE bool IsValid(const std::size_t i) const { return (Codepoints[i] != '\n') && Codepoints[i] >= 32 && !Ignored[i]; }
+			/* Characters that generate a quad. */
+			cbFORCEINLINE bool IsVisible(const std::size_t i) const { return IsValid(i) && !IsSpace(i); }
+
+			cbFORCEINLINE std::size_t GetLineCount() const { return size() == 0 ? 0 : NewLineCount + 1; }
+			/* Ignores new line, space and ignored character */
+			cbFORCEINLINE std::size_t GetFilteredSize() const { return FilteredCount; }
+			/* Ignored characters, new lines excluded. */
+			cbFORCEINLINE std::size_t GetIgnoredCount() const { return IgnoredCount; }
+
+			cbFORCEINLINE std::optional<cbColor> GetColor(const std::size_t i) const
+			{
+				if (ColorIndices[i] == NoColor)
+					return std::nullopt;
+				return Colors[ColorIndices[i]];
+			}
+			cbFORCEINLINE void SetColor(const std::size_t i, const std::optional<cbColor>& Color)
+			{
+				if (!Color.has_value())
+				{
+					ColorIndices[i] = NoColor;
+					return;
+				}
+
+				const cbColor& Value = Color.value();
+				for (std::size_t j = 0; j < Colors.size(); j++)
+				{
+					if (Colors[j].R == Value.R && Colors[j].G == Value.G && Colors[j].B == Value.B && Colors[j].A == Value.A)
+					{
+						ColorIndices[i] = static_cast<std::uint16_t>(j);
+						return;
+					}
+				}
+
+				/* Erased and replaced colors stay in the palette until it outgrows the characters. */
+				if (Colors.size() >= NoColor || Colors.size() >= (size() * 2) + 16)
+					CompactColors(i);
+
+				if (Colors.size() >= NoColor)
+				{
+					ColorIndices[i] = GetNearestColor(Value);
+					return;
+				}
+
+				ColorIndices[i] = static_cast<std::uint16_t>(Colors.size());
+				Colors.push_back(Value);
+			}
+
+			cbFORCEINLINE void SetIgnored(const std::size_t i, const bool Value)
+			{
+				RemoveFromCounters(i);
+				Ignored[i] = Value;
+				AddToCounters(i);
+			}
+
+			void Reserve(const std::size_t Size);
+			void Clear();
+			/* Replaces all characters with the given code points without copying them. */
+			void Assign(std::u32string&& InCodepoints, const std::size_t CharacterSize, const eFontType Type);
+			void PushBack(const cbCharacter& Character);
+			void Insert(const std::size_t i, const cbCharacter& Character);
+			void Erase(const std::size_t i);
+
+			cbCharacter Get(const std::size_t i) const;
+			cbFORCEINLINE cbCharacter Back() const { return Get(size() - 1); }
+			void Set(const std::size_t i, const cbCharacter& Character);
+
+			/* Returns the memory used by the arrays in bytes. */
+			std::size_t GetMemorySize() const;
+
+		private:
+			void Write(const std::size_t i, const cbCharacter& Character);
+
+			/* Removes the colors that no character uses, the color of the Skipped character is dropped as well. */
+			void CompactColors(const std::size_t Skipped);
+			/* Used when every palette entry is in use. */
+			std::uint16_t GetNearestColor(const cbColor& Value) const;
+
+			cbFORCEINLINE void AddToCounters(const std::size_t i)
+			{
+				if (IsNewLine(i))
+					NewLineCount++;
+				else if (Ignored[i])
+					IgnoredCount++;
+				if (IsVisible(i))
+					FilteredCount++;
+			}
+			cbFORCEINLINE void RemoveFromCounters(const std::size_t i)
+			{
+				if (IsNewLine(i))
+					NewLineCount--;
+				else if (Ignored[i])
+					IgnoredCount--;
+				if (IsVisible(i))
+					FilteredCount--;
+			}
+		};
+
 		struct cbLineMetaData
 		{
 			std::size_t Index;
@@ -386,15 +609,49 @@ namespace cbgui
 			float Width;
 			float HorizontalAlignment;
 
+			/* Character range of the word, ignored characters included. */
+			std::size_t FirstCharacter;
+			std::size_t LastCharacter;
+			/* Kerning of the first visible character. Used as the line offset when the word starts a new line. */
+			float Start;
+			/* Largest Ascender/Descender of the visible characters in the word. */
+			int Ascender;
+			int Descender;
+			bool bEndsWithNewLine;
+
 			cbFORCEINLINE constexpr cbWordMetaData()
 				: Index(0)
 				, Width(0.0f)
 				, HorizontalAlignment(0.0f)
+				, FirstCharacter(0)
+				, LastCharacter(0)
+				, Start(0.0f)
+				, Ascender(0)
+				, Descender(0)
+				, bEndsWithNewLine(false)
 			{}
 			cbFORCEINLINE constexpr cbWordMetaData(std::size_t InIndex, float InWidth, float InHorizontalAlignment)
 				: Index(InIndex)
 				, Width(InWidth)
 				, HorizontalAlignment(InHorizontalAlignment)
+				, FirstCharacter(0)
+				, LastCharacter(0)
+				, Start(0.0f)
+				, Ascender(0)
+				, Descender(0)
+				, bEndsWithNewLine(false)
+			{}
+			cbFORCEINLINE constexpr cbWordMetaData(std::size_t InIndex, float InWidth, float InHorizontalAlignment, std::size_t InFirstCharacter, std::size_t InLastCharacter,
+													float InStart, int InAscender, int InDescender, bool InEndsWithNewLine)
+				: Index(InIndex)
+				, Width(InWidth)
+				, HorizontalAlignment(InHorizontalAlignment)
+				, FirstCharacter(InFirstCharacter)
+				, LastCharacter(InLastCharacter)
+				, Start(InStart)
+				, Ascender(InAscender)
+				, Descender(InDescender)
+				, bEndsWithNewLine(InEndsWithNewLine)
 			{}
 
 			cbFORCEINLINE ~cbWordMetaData() = default;
@@ -402,7 +659,7 @@ namespace cbgui
 			cbFORCEINLINE constexpr float GetLeft() const { return HorizontalAlignment + (Width / 2.0f); }
 		};
 
-		std::vector<cbCharacter> Characters;
+		cbCharacterArray Characters;
 
 		std::vector<cbLineMetaData> LineMetaData;
 		std::vector<cbWordMetaData> WordMetaData;
@@ -429,6 +686,10 @@ namespace cbgui
 		bool bIsTextStylingEnabled;
 
 		std::vector<cbTextStyle> TextStyles;
+		/* Parsed from style tags or set directly. */
+		std::vector<cbTextStyleRun> StyleRuns;
+		/* Style runs are set by the user, the text has no style tags. */
+		bool bIsStyleRunsPrecompiled;
 
 		cbFORCEINLINE cbTextMetrics()
 			: FontName("")
@@ -446,6 +707,7 @@ namespace cbgui
 			, ShadowColor(cbColor::Black())*/
 			, bIsAscenderDescenderPowerOfTwo(true)
 			, bIsTextStylingEnabled(false)
+			, bIsStyleRunsPrecompiled(false)
 		{}
 
 		cbFORCEINLINE ~cbTextMetrics()
@@ -456,50 +718,62 @@ namespace cbgui
 
 		cbFORCEINLINE void Release()
 		{
-			Characters.clear();
+			Characters.Clear();
 			LineMetaData.clear();
 			WordMetaData.clear();
+			StyleRuns.clear();
+			bIsStyleRunsPrecompiled = false;
 		}
 
-		cbFORCEINLINE std::size_t LineCount() const
+		/* Keeps precompiled style runs on the same characters after an insert or remove. */
+		cbFORCEINLINE void ShiftStyleRuns(const std::size_t Index, const bool bInserted)
 		{
-			if (Characters.size() == 0)
-				return 0;
+			if (!bIsStyleRunsPrecompiled)
+				return;
 
-			std::size_t LineCount = 1;
-			for (const auto& Character : Characters)
-				if (Character.Character == 10)
-					LineCount++;
+			for (auto& Run : StyleRuns)
+			{
+				if (bInserted)
+				{
+					if (Index < Run.Start)
+						Run.Start++;
+					else if (Index < Run.Start + Run.Length)
+						Run.Length++;
+				}
+				else
+				{
+					if (Index < Run.Start)
+						Run.Start--;
+					else if (Index < Run.Start + Run.Length)
+						Run.Length--;
+				}
+			}
+		}
 
-			return LineCount;
+		cbFORCEINLINE std::size_t LineCount() const
+		{
+			return Characters.GetLineCount();
 		}
 
 		/* Ignores new line, space and ignored character */
 		cbFORCEINLINE std::size_t GetFilteredSize() const
 		{
-			std::size_t FilteredSize = 0;
-			for (const auto& Character : Characters)
-				if (Character.IsValid() && !Character.IsSpace())
-					FilteredSize++;
-
-			return FilteredSize;
+			return Characters.GetFilteredSize();
 		}
 
 		cbFORCEINLINE std::u32string GetText() const
 		{
-			std::u32string Text;
-			for (auto& Character : Characters)
-				Text.push_back(Character.Character);
-			return Text;
+			return Characters.Codepoints;
 		}
 
 		/* Ignores new line, space and ignored character */
 		cbFORCEINLINE std::u32string GetFilteredText() const
 		{
 			std::u32string Text;
-			for (auto& Character : Characters)
-				if (Character.IsValid())
-					Text.push_back(Character.Character);
+			Text.reserve(Characters.size() - Characters.GetIgnoredCount());
+			for (std::size_t i = 0; i < Characters.size(); i++)
+				if (Characters.IsValid(i))
+					Text.push_back(Characters.Codepoints[i]);
 			return Text;
 		}
 
@@ -561,6 +835,7 @@ namespace cbgui
 			, Pitch(0)
 			, VerticalAligment(0)
 			, UseVerticalAligment(false)
+			, LastUsedFrame(0)
 		{}
 		cbFORCEINLINE cbFontTextureGlyphData(std::size_t InWidth, std::size_t InHeight, std::size_t InPitch, const cbVector& InPenLocation,
 												bool InUseVerticalAligment, std::int32_t InVerticalAligment)
@@ -570,6 +845,7 @@ namespace cbgui
 			, Pitch(InPitch)
 			, VerticalAligment(InVerticalAligment)
 			, UseVerticalAligment(InUseVerticalAligment)
+			, LastUsedFrame(0)
 		{}
 		cbFORCEINLINE ~cbFontTextureGlyphData()
 		{
@@ -601,6 +877,8 @@ namespace cbgui
 		std::int32_t VerticalAligment;
 		bool UseVerticalAligment;
 		std::vector<unsigned char> Pixels;
+		/* Frame index of the last text that used the glyph, used for eviction. */
+		std::uint64_t LastUsedFrame;
 	};
 
 	/* Glyph data. */
@@ -654,6 +932,96 @@ namespace cbgui
 		}
 	};
 
+	/* Glyph metrics in pixels, available without rasterizing the glyph. */
+	struct cbGlyphMetrics
+	{
+		unsigned int Width;
+		unsigned int Height;
+		int BearingX;
+		int BearingY;
+		int xadvance;
+
+		cbFORCEINLINE constexpr cbGlyphMetrics()
+			: Width(0)
+			, Height(0)
+			, BearingX(0)
+			, BearingY(0)
+			, xadvance(0)
+		{}
+		cbFORCEINLINE constexpr cbGlyphMetrics(unsigned int InWidth, unsigned int InHeight, int InBearingX, int InBearingY, int Inxadvance)
+			: Width(InWidth)
+			, Height(InHeight)
+			, BearingX(InBearingX)
+			, BearingY(InBearingY)
+			, xadvance(Inxadvance)
+		{}
+		cbFORCEINLINE constexpr cbGlyphMetrics(const cbGlyph& Glyph)
+			: Width(Glyph.Width)
+			, Height(Glyph.Height)
+			, BearingX(Glyph.BearingX)
+			, BearingY(Glyph.BearingY)
+			, xadvance(Glyph.xadvance)
+		{}
+	};
+
+	/* Font data that is missing while the text is shaped in read-only mode, see cbFreeTypeFontFamily::BindRequests. */
+	struct cbFontRequests
+	{
+		struct cbGlyphRequest
+		{
+			eFontType FontType;
+			std::size_t FontSize;
+			char32_t Character;
+
+			cbGlyphRequest(const eFontType InFontType, const std::size_t InFontSize, const char32_t InCharacter)
+				: FontType(InFontType)
+				, FontSize(InFontSize)
+				, Character(InCharacter)
+			{}
+		};
+
+		struct cbMetricsRequest
+		{
+			eFontType FontType;
+			std::size_t FontSize;
+
+			cbMetricsRequest(const eFontType InFontType, const std::size_t InFontSize)
+				: FontType(InFontType)
+				, FontSize(InFontSize)
+			{}
+		};
+
+		struct cbKerningRequest
+		{
+			eFontType FontType;
+			std::size_t FontSize;
+			int First;
+			int Second;
+
+			cbKerningRequest(const eFontType InFontType, const std::size_t InFontSize, const int InFirst, const int InSecond)
+				: FontType(InFontType)
+				, FontSize(InFontSize)
+				, First(InFirst)
+				, Second(InSecond)
+			{}
+		};
+
+		std::vector<cbGlyphRequest> Glyphs;
+		std::vector<cbMetricsRequest> Metrics;
+		std::vector<cbKerningRequest> Kernings;
+
+		cbFontRequests() = default;
+		~cbFontRequests() = default;
+
+		inline bool IsEmpty() const { return Glyphs.empty() && Metrics.empty() && Kernings.empty(); }
+		inline void Clear()
+		{
+			Glyphs.clear();
+			Metrics.clear();
+			Kernings.clear();
+		}
+	};
+
 	/* Font library interface. */
 	class cbIFontFamily
 	{
@@ -666,6 +1034,8 @@ namespace cbgui
 		virtual const cbGlyph* FindOrAdd(const eFontType& FontType, const std::size_t& FontSize, const char32_t& character) = 0;
 		/* Returns Character Glyph. */
 		virtual const cbGlyph* GetGlyph(const eFontType& FontType, const std::size_t& Size, const char32_t& ch) const = 0;
+		/* Returns the metrics of the character without creating it. Metrics of characters that are not created are loaded once and cached. */
+		virtual std::optional<cbGlyphMetrics> GetGlyphMetrics(const eFontType& FontType, const std::size_t& Size, const char32_t& Character) = 0;
 		/* Returns the length of the space between characters. */
 		virtual std::int32_t GetKerning(const int& ch1, const int& ch2, const std::size_t& Size, const eFontType& Type) const = 0;
 		virtual std::optional<cbBounds> GetTextureCoordinate(const eFontType& FontType, const std::size_t& Size, const char32_t& Character) = 0;
@@ -686,8 +1056,13 @@ namespace cbgui
 
 		/* Returns Font Texture. */
 		virtual const std::vector<unsigned char> GetTexture() const = 0;
+
+		/* Advances the frame index used for glyph eviction. Call once per frame. */
+		virtual void BeginFrame() = 0;
 	};
 
+	class cbFontGeometry;
+
 	/* FreeType Font library interface. */
 	class cbFreeTypeFontFamily : public cbIFontFamily
 	{
@@ -704,6 +1079,8 @@ namespace cbgui
 		virtual const cbGlyph* FindOrAdd(const eFontType& FontType, const std::size_t& FontSize, const char32_t& character) override;
 		/* Returns Character Glyph. */
 		virtual const cbGlyph* GetGlyph(const eFontType& FontType, const std::size_t& Size, const char32_t& ch) const override;
+		/* Returns the metrics of the character without creating it. Metrics of characters that are not created are loaded once and cached. */
+		virtual std::optional<cbGlyphMetrics> GetGlyphMetrics(const eFontType& FontType, const std::size_t& Size, const char32_t& Character) override;
 		/* Returns the length of the space between characters. */
 		virtual std::int32_t GetKerning(const int& ch1, const int& ch2, const std::size_t& Size, const eFontType& Type) const override;
 		virtual std::optional<cbBounds> GetTextureCoordinate(const eFontType& FontType, const std::size_t& Size, const char32_t& Character) override;
@@ -725,10 +1102,51 @@ namespace cbgui
 		/* Returns Font Texture. */
 		virtual const std::vector<unsigned char> GetTexture() const override;
 
+		/* Advances the frame index used for glyph eviction and runs the eviction requested by CreateChar. Call once per frame, outside of text updates. */
+		virtual void BeginFrame() override;
+		/* Returns the frame index of the shared store, the highest frame index of its families. */
+		std::uint64_t GetFrameIndex() const;
+
+		/* Returns the used ratio of the atlas height. */
+		float GetAtlasUsage() const;
+		/*
+		* Evicts the glyphs that are not used by any text for 'GlyphEvictionAge' frames.
+		* The atlas is compacted if any glyph is evicted. Returns the evicted glyph count.
+		*/
+		std::size_t EvictUnusedGlyphs();
+		/*
+		* Repacks the glyphs, updates the texture coordinates of the texts and uploads the whole texture.
+		* Nothing changes if the glyphs do not fit in the repacked order.
+		*/
+		void CompactAtlas();
+
+		/*
+		* Binds a request list to the calling thread. While bound, the families do not create glyphs or load metrics,
+		* the missing font data is added to the list and the text is shaped from what already exists.
+		* Shaping in this mode does not modify the families and can run on several threads. Pass nullptr to unbind.
+		*/
+		static void BindRequests(cbFontRequests* Requests);
+		static cbFontRequests* GetBoundRequests();
+		/* Creates the requested glyphs and caches the requested metrics. Must not run while any thread shapes text. */
+		void ResolveRequests(const cbFontRequests& Requests);
+
+	private:
+		friend cbFontGeometry;
+		void AddGeometry(cbFontGeometry* Geometry);
+		void RemoveGeometry(cbFontGeometry* Geometry);
+
 	private:
 		cbFontDesc Desc;
+		class FreeTypeFontStore;
 		class FreeTypeFont;
 		FreeTypeFont* FreeTypeFontManager;
+		/* Geometries using the family, their texture coordinates are remapped after compaction. */
+		std::unordered_set<cbFontGeometry*> Geometries;
+		std::uint64_t FrameIndex;
+		/* Ascenders and descenders keyed by type and size, kerning keyed by type, size and the character pair. */
+		mutable std::unordered_map<std::uint64_t, int> Ascenders;
+		mutable std::unordered_map<std::uint64_t, int> Descenders;
+		std::unordered_map<std::uint64_t, std::int32_t> Kernings;
 	};
 
 	/* Required function to load FreeTypeFont library. */
@@ -740,6 +1158,8 @@ namespace cbgui
 	class cbFontGeometry
 	{
 		cbBaseClassBody(cbClassConstructor, cbFontGeometry)
+		friend cbFreeTypeFontFamily;
+		friend class cbTextBatchUpdater;
 	public:
 		cbFontGeometry(cbText* pOwner, cbIFontFamily* FontFamily);
 		cbFontGeometry(cbText* pOwner, const std::u32string& inText, const cbTextDesc& TextDesc, cbIFontFamily* FontFamily);
@@ -762,29 +1182,69 @@ namespace cbgui
 
 		/* Deletes the existing text, adds a new one. */
 		void SetText(const std::u32string& Text, const std::optional<cbTextDesc> Desc);
+		void SetText(std::u32string&& Text, const std::optional<cbTextDesc> Desc);
+		/* Decodes UTF-8 directly into the character storage. Invalid sequences are replaced with U+FFFD. */
+		void SetTextUtf8(const std::string_view& Text, const std::optional<cbTextDesc> Desc);
+		/*
+		* Deletes the existing text, adds a new one styled by the given runs.
+		* The text is not parsed for style tags. When runs overlap, the earlier run wins.
+		*/
+		void SetStyledText(const std::u32string& Text, const std::vector<cbTextStyleRun>& Runs, const std::optional<cbTextDesc> Desc = std::nullopt);
 		/* Appends text to the end of existing text. */
 		void AppendText(const std::u32string& Text);
+		/* Appends UTF-8 text to the end of existing text. */
+		void AppendTextUtf8(const std::string_view& Text);
 		/* Destroys all characters. */
 		void Clear();
 
 		/* Build or Rebuilds character data. */
 		void BuildText();
+
+		/* SetText looks up and stores the layout in the shared cbTextLayoutCache. Default : true */
+		void SetLayoutCacheEnabled(const bool Value) { bIsLayoutCacheEnabled = Value; }
+		inline bool IsLayoutCacheEnabled() const { return bIsLayoutCacheEnabled; }
+
+		/*
+		* Every character advances by the widest of the given characters at the default font size and is centered in its cell.
+		* Kerning pairs are skipped. Used for tabular digits, empty disables it.
+		*/
+		void SetTabularCharacters(const std::u32string& Characters);
+		inline const std::u32string& GetTabularCharacters() const { return TabularCharacters; }
+		/*
+		* Replaces a visible character without rebuilding the layout, only its quad and texture coordinates are patched.
+		* The following characters are not moved, intended for tabular text. Returns false if the character has no quad.
+		*/
+		bool ReplaceChar(const std::size_t Index, const char32_t Character);
 	private:
-		bool BuildCharacter(cbTextMetrics::cbCharacter* Character);
+		bool BuildCharacter(const std::size_t Index);
+		/* Finds the widest advance of the tabular characters, creates the missing glyphs. */
+		void UpdateTabularAdvance();
 		/* Generates character data and apply Text Style if available. */
-		void ParseCharacters(const std::u32string& Text);
+		void ParseCharacters(std::u32string&& Text);
+		/* Generates style runs from style tags in a single pass and marks the tags as ignored. */
+		void ParseStyleTags(const std::u32string& Text);
+		void ApplyStyleRuns();
 
 		const cbGlyph* GetGlyph(const eFontType& Type, const std::size_t& Size, const char32_t& ch) const;
+		cbBounds GetCharacterTextureCoordinate(const cbGlyph* Glyph) const;
+		/* Stamps the glyphs of the characters with the frame index, used glyphs are not evicted. */
+		void MarkUsedGlyphs(const std::uint64_t FrameIndex) const;
+		/* Called by the font family after the atlas is compacted. Texture coordinates are patched in place, also when the data is shared. */
+		void FontAtlasRemapped();
+		/* Returns font Ascender/Descender, rounded to even if bIsAscenderDescenderPowerOfTwo is enabled. */
+		void GetAscenderDescender(const std::size_t Size, const eFontType Type, int& outAscender, int& outDescender) const;
 
 	public:
-		inline std::vector<cbVector4> GetVertices() const { return Vertices; }
-		inline std::vector<cbColor> GetVertexColors() const { return VertexColors; }
-		inline std::vector<cbVector> GetTextureCoordinate() const { return TextureCoordinates; }
+		inline const std::vector<cbVector4>& GetVertices() const { return Vertices(); }
+		inline const std::vector<cbColor>& GetVertexColors() const { return VertexColors(); }
+		inline const std::vector<cbVector>& GetTextureCoordinate() const { return TextureCoordinates(); }
 		std::vector<std::uint32_t> GenerateIndices() const;
+		/* Returns the lines between Top and Bottom in geometry space and their glyph quads. Lines are found by binary search over the baselines. */
+		cbTextGlyphRange GetGlyphRange(const float Top, const float Bottom) const;
 
 		inline const std::size_t GetDrawCount() const { return (GetTextSize() * 6); }
-		inline const std::size_t GetVerticesSize() const { return Vertices.size(); }
-		inline const std::size_t GetIndexCount() const { return (Vertices.size() / 4) * 6; }
+		inline const std::size_t GetVerticesSize() const { return Vertices().size(); }
+		inline const std::size_t GetIndexCount() const { return (Vertices().size() / 4) * 6; }
 
 		//virtual void SetFontVertexSize(const float& FontSize) override;
 
@@ -795,7 +1255,7 @@ namespace cbgui
 		bool RemoveChars(const std::vector<std::size_t>& Indices);
 
 		/* Returns the total dimensions of the text. */
-		inline constexpr cbBounds GetGeometryBounds() const { return CachedBounds; }
+		inline cbBounds GetGeometryBounds() const { return CachedBounds(); }
 		/* Returns the total sizes of individual rows. */
 		std::vector<cbBounds> GetLineBounds() const;
 
@@ -832,10 +1292,15 @@ namespace cbgui
 		/* A style used to format text. */
 		void AddTextStyle(const cbTextStyle& Style);
 		void RemoveTextStyle(const std::size_t& Index);
-		inline std::vector<cbTextStyle> GetTextStyles() const { return TextMetrics.TextStyles; }
+		inline std::vector<cbTextStyle> GetTextStyles() const { return TextMetrics().TextStyles; }
+		inline const std::vector<cbTextStyleRun>& GetStyleRuns() const { return TextMetrics().StyleRuns; }
 
-		inline cbVertexColorStyle GetVertexColorStyle() const { return Style; }
-		void SetVertexColorStyle(const cbVertexColorStyle& pStyle) { Style = pStyle; UpdateVertexColors(); }
+		inline cbVertexColorStyle GetVertexColorStyle() const { return Style.Get(); }
+		void SetVertexColorStyle(const cbVertexColorStyle& pStyle) { Style.Set(pStyle); UpdateVertexColors(); }
+		/* References the shared style, see cbStyleRegistry. */
+		void SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle) { Style.Bind(Handle); UpdateVertexColors(); }
+		/* Reapplies the shared style after the registry replaced it. */
+		void VertexColorStyleUpdated() { UpdateVertexColors(); }
 
 		/* Returns all characters in the line and the bounds of the line. */
 		bool GetLineData(std::size_t Index, cbBounds& outLineBounds, std::vector<cbCharacterData>& outCharacterData) const;
@@ -851,30 +1316,72 @@ namespace cbgui
 
 		inline constexpr cbTextDesc GetTextDesc() const { return TextDesc; }
 
-		inline const std::size_t GetLineCount() const { return TextMetrics.LineCount(); }
+		inline const std::size_t GetLineCount() const { return TextMetrics().LineCount(); }
 
 		/* Updates Vertices, TextureCoordinates, VertexColors */
 		void UpdateGeometry();
 		/* Aligns the text. */
 		void UpdateAlignments();
+		/* Breaks lines using the cached word widths. Horizontal alignment must be up to date. */
 		void UpdateVerticalAlignment();
+		/* Computes kerning and caches word widths. */
 		void UpdateHorizontalAlignment();
 		/* Updates Cached Text Bounds */
 		void UpdateBounds();
 
 	private:
 		void RebuildText();
+		/* Re-breaks lines after a wrap width change without recomputing kerning. */
+		void ReWrap();
 
 		void UpdateVertices();
+		void UpdateLineGlyphOffsets();
 		void UpdateVertexColors();
+		/* Returns true if the vertex colors match the style and the character colors. */
+		bool IsVertexColorsUpToDate() const;
 		void UpdateTextureCoordinates();
 
+	public:
+		/*
+		* Layout and geometry of the text. Instances created by cbWidget::Instantiate share it with the prototype
+		* and texts found in cbTextLayoutCache share it with the cache, the first write through the non-const accessors copies it.
+		*/
+		struct cbGeometryData
+		{
+			cbTextMetrics TextMetrics;
+			std::vector<cbVector4> Vertices;
+			std::vector<cbColor> VertexColors;
+			std::vector<cbVector> TextureCoordinates;
+			cbBounds CachedBounds;
+			/* Index of the first glyph quad of each line. The last entry is the glyph quad count. */
+			std::vector<std::size_t> LineGlyphOffsets;
+
+			/* Approximate heap usage in bytes. */
+			std::size_t GetMemorySize() const;
+		};
+
 	private:
 		cbText* Owner;
 		cbFreeTypeFontFamily* FontFamily;
-		cbVertexColorStyle Style;
-
-		cbTextMetrics TextMetrics;
+		cbStyleRef<cbVertexColorStyle> Style;
+
+		std::shared_ptr<cbGeometryData> Data;
+
+		inline cbGeometryData& MakeUnique() { if (Data.use_count() > 1) Detach(); return *Data; }
+		void Detach();
+
+		inline const cbTextMetrics& TextMetrics() const { return Data->TextMetrics; }
+		inline cbTextMetrics& TextMetrics() { return MakeUnique().TextMetrics; }
+		inline const std::vector<cbVector4>& Vertices() const { return Data->Vertices; }
+		inline std::vector<cbVector4>& Vertices() { return MakeUnique().Vertices; }
+		inline const std::vector<cbColor>& VertexColors() const { return Data->VertexColors; }
+		inline std::vector<cbColor>& VertexColors() { return MakeUnique().VertexColors; }
+		inline const std::vector<cbVector>& TextureCoordinates() const { return Data->TextureCoordinates; }
+		inline std::vector<cbVector>& TextureCoordinates() { return MakeUnique().TextureCoordinates; }
+		inline const cbBounds& CachedBounds() const { return Data->CachedBounds; }
+		inline cbBounds& CachedBounds() { return MakeUnique().CachedBounds; }
+		inline const std::vector<std::size_t>& LineGlyphOffsets() const { return Data->LineGlyphOffsets; }
+		inline std::vector<std::size_t>& LineGlyphOffsets() { return MakeUnique().LineGlyphOffsets; }
 
 		cbTextDesc TextDesc;
 
@@ -891,9 +1398,9 @@ namespace cbgui
 		bool bAutoWrapText;
 		std::optional<float> CustomWrapSize;
 
-		std::vector<cbVector4> Vertices;
-		std::vector<cbColor> VertexColors;
-		std::vector<cbVector> TextureCoordinates;
-		cbBounds CachedBounds;
+		bool bIsLayoutCacheEnabled;
+
+		std::u32string TabularCharacters;
+		int TabularAdvance;
 	};
 }
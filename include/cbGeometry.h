@@ -27,6 +27,7 @@
 
 #include "cbClassBody.h"
 #include "cbVertexColorStyle.h"
+#include "cbStyleRegistry.h"
 #include "cbMath.h"
 
 namespace cbgui
@@ -51,6 +51,7 @@ namespace cbgui
 		private:
 			void UpdateHorizontalDimension()
 			{
+				InvalidateWorldCache();
 				if (Alignment == eSlotAlignment::BoundToContent)
 					Dimension.Width = Content ?  Content->GetNonAlignedWidth() + Content->GetPadding().GetWidth() : 0.0f;
 				else if (Alignment == eSlotAlignment::BoundToSlot)
@@ -58,14 +59,17 @@ namespace cbgui
 			}
 			void UpdateVerticalDimension()
 			{
+				InvalidateWorldCache();
 				Dimension.Height = GetOwner<cbHorizontalBox>()->GetHeight();
 			}
 			void UpdateHorizontalLocation()
 			{
+				InvalidateWorldCache();
 				Location.X = (GetOwner<cbHorizontalBox>()->GetNextSlotLocation(eHorizontalAlignment::Align_Left, this) + GetWidth() / 2.0f);
 			}
 			void UpdateVerticalLocation()
 			{
+				InvalidateWorldCache();
 				Location.Y = (GetOwner<cbHorizontalBox>()->GetLocation().Y);
 			}
 
@@ -133,6 +137,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const override final { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const override final { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual cbBounds GetBounds() const override final { return cbBounds(GetDimension(), GetLocation()); }
 			virtual cbVector GetLocation() const override { return Location; }
@@ -233,9 +239,13 @@ namespace cbgui
 		virtual bool HasAnyChildren() const override final;
 		/* Returns slots and components. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final;
+		virtual std::size_t GetChildrenCount() const override final;
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final;
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasGeometry() const override final { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
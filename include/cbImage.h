@@ -83,17 +83,24 @@ namespace cbgui
 
 		virtual bool HasAnyChildren() const override final { return false; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>(); }
+		virtual std::size_t GetChildrenCount() const override final { return 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 	public:
 		virtual bool HasGeometry() const override final { return true; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
 		virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 		virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
-		cbVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle; }
+		virtual std::optional<cbColor> GetVertexColor(const bool LineGeometry = false) const override final;
+		cbVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle.Get(); }
 		void SetVertexColorStyle(const cbVertexColorStyle& style);
+		/* References the shared style, see cbStyleRegistry. */
+		void SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle);
 
 	private:
 		virtual void OnAttach() override final;
@@ -101,6 +108,6 @@ namespace cbgui
 
 	private:
 		cbTransform Transform;
-		cbVertexColorStyle VertexColorStyle;
+		cbStyleRef<cbVertexColorStyle> VertexColorStyle;
 	};
 }
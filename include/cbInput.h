@@ -25,7 +25,8 @@
 */
 #pragma once
 
-#include <map>
+#include <cstdint>
+#include <type_traits>
 #include "cbMath.h"
 
 namespace cbgui
@@ -44,21 +45,118 @@ namespace cbgui
 		Disabled,
 	};
 
+	/* Mouse button bits of the input events. */
+	enum class eMouseButton : std::uint8_t
+	{
+		None = 0,
+		Left = 1 << 0,
+		Right = 1 << 1,
+		Middle = 1 << 2,
+		XB1 = 1 << 3,
+		XB2 = 1 << 4,
+	};
+
+	/* Modifier key bits of the input events. */
+	enum class eInputModifier : std::uint8_t
+	{
+		None = 0,
+		Shift = 1 << 0,
+		Control = 1 << 1,
+		Alt = 1 << 2,
+	};
+
+	enum class eInputEventType : std::uint8_t
+	{
+		MouseMove,
+		MouseButtonDown,
+		MouseButtonUp,
+		MouseButtonDoubleClick,
+		MouseWheel,
+		KeyDown,
+		KeyUp,
+		/* Translated character of the pressed key. */
+		Char,
+	};
+
+	/* Platform independent input event, it is copied by value into the input queue. */
+	struct cbInputEvent
+	{
+		eInputEventType Type;
+		/* Button of the button events. */
+		eMouseButton Button;
+		/* Pressed mouse buttons, eMouseButton bits. */
+		std::uint8_t Buttons;
+		/* Pressed modifier keys, eInputModifier bits. */
+		std::uint8_t Modifiers;
+		/* Mouse location in client space. */
+		float X;
+		float Y;
+		float WheelDelta;
+		std::uint64_t KeyCode;
+		/* Platform time of the event in milliseconds. */
+		std::uint64_t Timestamp;
+
+		cbInputEvent(const eInputEventType InType = eInputEventType::MouseMove)
+			: Type(InType)
+			, Button(eMouseButton::None)
+			, Buttons(0)
+			, Modifiers(0)
+			, X(0.0f)
+			, Y(0.0f)
+			, WheelDelta(0.0f)
+			, KeyCode(0)
+			, Timestamp(0)
+		{}
+
+		inline cbVector GetLocation() const { return cbVector(X, Y); }
+		inline void SetLocation(const cbVector& Location) { X = Location.X; Y = Location.Y; }
+		inline bool IsMouseEvent() const { return Type <= eInputEventType::MouseWheel; }
+		inline bool IsKeyboardEvent() const { return Type >= eInputEventType::KeyDown; }
+		inline bool IsButtonPressed(const eMouseButton InButton) const { return (Buttons & (std::uint8_t)InButton) != 0; }
+		inline bool HasModifier(const eInputModifier Modifier) const { return (Modifiers & (std::uint8_t)Modifier) != 0; }
+	};
+	static_assert(std::is_trivially_copyable<cbInputEvent>::value, "cbInputEvent must be trivially copyable.");
+
+	/* Mouse state passed to the widget handlers, it is built from the input event without allocation. */
 	struct cbMouseInput
 	{
-		std::map<std::string, cbMouseButtonState> Buttons;
+		/* Pressed mouse buttons, eMouseButton bits. */
+		std::uint8_t Buttons;
+		/* Pressed modifier keys, eInputModifier bits. */
+		std::uint8_t Modifiers;
 		cbMouseState State;
 		cbVector MouseLocation;
 
 		cbMouseInput()
-			: State(cbMouseState::Idle)
+			: Buttons(0)
+			, Modifiers(0)
+			, State(cbMouseState::Idle)
 			, MouseLocation(cbVector::Zero())
+		{}
+
+		cbMouseInput(const cbInputEvent& Event)
+			: Buttons(Event.Buttons)
+			, Modifiers(Event.Modifiers)
+			, State(Event.Type == eInputEventType::MouseMove ? cbMouseState::Moving : cbMouseState::Idle)
+			, MouseLocation(Event.GetLocation())
+		{
+			/* The state of the changed button follows the event, not the platform button state. */
+			if (Event.Type == eInputEventType::MouseButtonDown || Event.Type == eInputEventType::MouseButtonDoubleClick)
+				Buttons |= (std::uint8_t)Event.Button;
+			else if (Event.Type == eInputEventType::MouseButtonUp)
+				Buttons &= ~(std::uint8_t)Event.Button;
+		}
+
+		inline cbMouseButtonState GetButtonState(const eMouseButton Button) const
+		{
+			return (Buttons & (std::uint8_t)Button) != 0 ? cbMouseButtonState::Pressed : cbMouseButtonState::Released;
+		}
+		inline void SetButtonState(const eMouseButton Button, const cbMouseButtonState ButtonState)
 		{
-			Buttons.insert({ "Left", cbMouseButtonState::Released });
-			Buttons.insert({ "Right", cbMouseButtonState::Released });
-			Buttons.insert({ "Middle", cbMouseButtonState::Released });
-			Buttons.insert({ "XB1", cbMouseButtonState::Disabled });
-			Buttons.insert({ "XB2", cbMouseButtonState::Disabled });
+			if (ButtonState == cbMouseButtonState::Pressed)
+				Buttons |= (std::uint8_t)Button;
+			else
+				Buttons &= ~(std::uint8_t)Button;
 		}
 	};
 }
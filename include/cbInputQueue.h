@@ -0,0 +1,58 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <vector>
+#include <functional>
+#include "cbInput.h"
+
+namespace cbgui
+{
+	/*
+	* Buffers the input events of the platform until the canvas dispatches them.
+	* Consecutive mouse moves are coalesced into the latest one, the order of the other events is preserved.
+	* The event storage is reused, pushing and dispatching do not allocate once the capacity is reached.
+	*/
+	class cbInputQueue
+	{
+	public:
+		cbInputQueue() = default;
+		~cbInputQueue() = default;
+
+		void Push(const cbInputEvent& Event);
+
+		/* Dispatches the queued events in order and clears the queue. Events pushed by the handler are dispatched next time. */
+		void Dispatch(const std::function<void(const cbInputEvent&)>& fHandler);
+
+		inline std::size_t size() const { return Events.size(); }
+		inline bool IsEmpty() const { return Events.empty(); }
+		inline void Clear() { Events.clear(); }
+
+	private:
+		std::vector<cbInputEvent> Events;
+		std::vector<cbInputEvent> DispatchedEvents;
+	};
+}
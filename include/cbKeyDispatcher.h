@@ -0,0 +1,75 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include "cbWidget.h"
+
+namespace cbgui
+{
+	/*
+	* Routes the keyboard input of the canvas.
+	* The canvas reports the focus changes, the deepest focused widget receives the keys first and
+	* the unhandled keys bubble up to its owners. Global shortcuts are looked up by key and modifiers.
+	* The cost of a key event depends on the depth of the focused widget, not on the size of the tree.
+	*/
+	class cbKeyDispatcher
+	{
+	public:
+		cbKeyDispatcher();
+		~cbKeyDispatcher() = default;
+
+		/* Called by the canvas when the widget gains or loses focus. */
+		void FocusChanged(cbWidget* Widget);
+		/* Called by the canvas when the widget is removed, clears the focus if it was focused. */
+		void WidgetRemoved(cbWidgetObj* Widget);
+		inline cbWidget* GetFocusedWidget() const { return FocusedWidget; }
+		inline void ResetFocus() { FocusedWidget = nullptr; }
+
+		/* Modifiers are eInputModifier bits. The callback returns true if the key is handled. */
+		void SetShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers, const std::function<bool()>& fCallback);
+		void RemoveShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers);
+		bool HasShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers) const;
+		inline void ClearShortcuts() { Shortcuts.clear(); }
+		/* Returns true if a shortcut is bound to the key and handled it. */
+		bool ExecuteShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers);
+
+		/* Sends the key to the focused widget, then to its owners until it is handled. */
+		bool KeyDown(const std::uint64_t KeyCode);
+		bool KeyUp(const std::uint64_t KeyCode);
+
+	private:
+		static cbWidget* GetOwnerWidget(const cbWidgetObj* Widget);
+		static cbWidget* GetFocusedOwner(const cbWidget* Widget);
+		static bool IsOwnerOf(const cbWidget* Owner, const cbWidget* Widget);
+		static inline std::uint64_t GetShortcutKey(const std::uint64_t KeyCode, const std::uint8_t Modifiers) { return (KeyCode << 8) | Modifiers; }
+
+	private:
+		cbWidget* FocusedWidget;
+		std::unordered_map<std::uint64_t, std::function<bool()>> Shortcuts;
+	};
+}
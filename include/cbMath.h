@@ -1509,6 +1509,97 @@ namespace cbgui
 		return Bound;
 	}
 
+	/*
+	* 2D affine transform, row vector convention like the viewport transform.
+	* (X, Y) -> (X * M11 + Y * M21 + M31, X * M12 + Y * M22 + M32)
+	*/
+	struct cbMatrix2x3
+	{
+		float M11, M12;
+		float M21, M22;
+		float M31, M32;
+
+		cbFORCEINLINE constexpr cbMatrix2x3()
+			: M11(1.0f), M12(0.0f)
+			, M21(0.0f), M22(1.0f)
+			, M31(0.0f), M32(0.0f)
+		{}
+		cbFORCEINLINE constexpr cbMatrix2x3(float In11, float In12, float In21, float In22, float In31, float In32)
+			: M11(In11), M12(In12)
+			, M21(In21), M22(In22)
+			, M31(In31), M32(In32)
+		{}
+
+		static constexpr cbMatrix2x3 Identity() { return cbMatrix2x3(); }
+		static constexpr cbMatrix2x3 Translation(const cbVector& Offset) { return cbMatrix2x3(1.0f, 0.0f, 0.0f, 1.0f, Offset.X, Offset.Y); }
+		static constexpr cbMatrix2x3 Scale(const cbVector& InScale) { return cbMatrix2x3(InScale.X, 0.0f, 0.0f, InScale.Y, 0.0f, 0.0f); }
+		/* Same direction as RotateVectorAroundPoint. */
+		static cbMatrix2x3 Rotation(const float Degrees)
+		{
+			const float Cos = std::cos(DegreesToRadians(Degrees));
+			const float Sin = std::sin(DegreesToRadians(Degrees));
+			return cbMatrix2x3(Cos, Sin, -Sin, Cos, 0.0f, 0.0f);
+		}
+
+		/* Applies this transform first, then Other. */
+		cbFORCEINLINE constexpr cbMatrix2x3 operator*(const cbMatrix2x3& Other) const
+		{
+			return cbMatrix2x3(M11 * Other.M11 + M12 * Other.M21, M11 * Other.M12 + M12 * Other.M22,
+							   M21 * Other.M11 + M22 * Other.M21, M21 * Other.M12 + M22 * Other.M22,
+							   M31 * Other.M11 + M32 * Other.M21 + Other.M31, M31 * Other.M12 + M32 * Other.M22 + Other.M32);
+		}
+		cbFORCEINLINE constexpr bool operator==(const cbMatrix2x3& Other) const
+		{
+			return M11 == Other.M11 && M12 == Other.M12 && M21 == Other.M21 && M22 == Other.M22 && M31 == Other.M31 && M32 == Other.M32;
+		}
+		cbFORCEINLINE constexpr bool operator!=(const cbMatrix2x3& Other) const { return !(*this == Other); }
+
+		cbFORCEINLINE constexpr bool IsIdentity() const { return *this == cbMatrix2x3(); }
+		cbFORCEINLINE constexpr float GetDeterminant() const { return M11 * M22 - M12 * M21; }
+
+		cbFORCEINLINE constexpr cbVector TransformPoint(const cbVector& Point) const
+		{
+			return cbVector(Point.X * M11 + Point.Y * M21 + M31, Point.X * M12 + Point.Y * M22 + M32);
+		}
+
+		/* Returns the identity if the matrix is not invertible. */
+		cbFORCEINLINE constexpr cbMatrix2x3 GetInverse() const
+		{
+			const float Det = GetDeterminant();
+			if (Det == 0.0f)
+				return cbMatrix2x3();
+
+			const float InvDet = 1.0f / Det;
+			const float I11 = M22 * InvDet;
+			const float I12 = -M12 * InvDet;
+			const float I21 = -M21 * InvDet;
+			const float I22 = M11 * InvDet;
+			return cbMatrix2x3(I11, I12, I21, I22, -(M31 * I11 + M32 * I21), -(M31 * I12 + M32 * I22));
+		}
+
+		/* Returns the axis-aligned bounds of the transformed corners. */
+		cbFORCEINLINE constexpr cbBounds TransformBounds(const cbBounds& Bounds) const
+		{
+			const cbVector P0 = TransformPoint(Bounds.Min);
+			const cbVector P1 = TransformPoint(cbVector(Bounds.Max.X, Bounds.Min.Y));
+			const cbVector P2 = TransformPoint(cbVector(Bounds.Min.X, Bounds.Max.Y));
+			const cbVector P3 = TransformPoint(Bounds.Max);
+			return cbBounds(cbVector(std::min(std::min(P0.X, P1.X), std::min(P2.X, P3.X)), std::min(std::min(P0.Y, P1.Y), std::min(P2.Y, P3.Y))),
+							cbVector(std::max(std::max(P0.X, P1.X), std::max(P2.X, P3.X)), std::max(std::max(P0.Y, P1.Y), std::max(P2.Y, P3.Y))));
+		}
+
+		/* Row major 4x4 matrix, can be multiplied with the viewport transform. */
+		cbFORCEINLINE constexpr std::array<cbVector4, 4> GetMatrix4x4() const
+		{
+			std::array<cbVector4, 4> Matrix;
+			Matrix[0] = cbVector4(M11, M12, 0.0f, 0.0f);
+			Matrix[1] = cbVector4(M21, M22, 0.0f, 0.0f);
+			Matrix[2] = cbVector4(0.0f, 0.0f, 1.0f, 0.0f);
+			Matrix[3] = cbVector4(M31, M32, 0.0f, 1.0f);
+			return Matrix;
+		}
+	};
+
 	cbFORCEINLINE constexpr std::array<cbVector4, 4> GetViewportTransform(const int width, const int height)
 	{
 		const int Dx = 0;
@@ -0,0 +1,69 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <string_view>
+#include "cbText.h"
+
+namespace cbgui
+{
+	/*
+	* Text widget for values that are updated many times a second, counters, meters, prices.
+	* Reserves a fixed number of tabular glyph slots and right aligns the value in them.
+	* Numbers are formatted without allocation and an update only patches the glyphs of the changed slots,
+	* the vertex count never changes.
+	*/
+	class cbNumericText : public cbText
+	{
+		cbClassBody(cbClassConstructor, cbNumericText, cbText);
+	public:
+		cbNumericText(const std::size_t SlotCount, const cbTextDesc& TextDesc, cbIFontFamily* FontFamily);
+		cbNumericText(const cbNumericText& Other);
+	public:
+		virtual ~cbNumericText();
+
+		virtual cbWidget::SharedPtr CloneWidget() override;
+
+		void SetInteger(const std::int64_t Value);
+		/* Fixed notation with the given number of digits after the decimal point. */
+		void SetFloat(const double Value, const int Precision = 2);
+		/* Preformatted value. Characters other than digits and "+-.,:%#" are shown as blank slots. */
+		void SetValueText(const std::string_view& Text);
+
+		/* Rebuilds the text with the given number of slots, the shown value is cleared. */
+		void SetSlotCount(const std::size_t Count);
+		inline std::size_t GetSlotCount() const { return Slots.size(); }
+		/* The last value did not fit into the slots, all slots show '#'. */
+		inline bool IsOverflowed() const { return bIsOverflowed; }
+
+	private:
+		void SetSlots(const char* Text, const std::size_t Length);
+
+	private:
+		std::u32string Slots;
+		bool bIsOverflowed;
+	};
+}
@@ -85,6 +85,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const override final { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const override final { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual bool IsInside(const cbVector& Location) const override final { return GetContent()->IsInside(Location); }
 			virtual cbBounds GetBounds() const override final { return cbBounds(GetDimension(), GetLocation()); }
@@ -155,9 +157,13 @@ namespace cbgui
 		virtual bool HasAnyChildren() const override final;
 		/* Returns slots and components. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final;
+		virtual std::size_t GetChildrenCount() const override final;
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final;
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasGeometry() const override final { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
@@ -48,7 +48,7 @@ namespace cbgui
 			{
 				cbClassBody(cbClassConstructor, cbScrollBarHandleComponent, cbComponent)
 			private:
-				cbButtonVertexColorStyle VertexColorStyle;
+				cbStyleRef<cbButtonVertexColorStyle> VertexColorStyle;
 				eButtonState ButtonState;
 				std::optional<cbVector> mouseOffset;
 				float Percent;
@@ -120,10 +120,12 @@ namespace cbgui
 			public:
 				virtual bool HasGeometry() const override final { return true; }
 				virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
+				virtual std::optional<cbColor> GetVertexColor(const bool LineGeometry = false) const override final;
 				virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 				virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
-				cbButtonVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle; }
+				cbButtonVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle.Get(); }
 				void SetVertexColorStyle(const cbButtonVertexColorStyle& style);
+				void SetVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle);
 
 			private:
 				void OnPressed();
@@ -139,7 +141,7 @@ namespace cbgui
 			};
 
 		private:
-			cbVertexColorStyle VertexColorStyle;
+			cbStyleRef<cbVertexColorStyle> VertexColorStyle;
 			float Thickness;
 			float BarThickness;
 			// Offset
@@ -160,6 +162,7 @@ namespace cbgui
 				, ScrollStepPercent(0.1f)
 				, bIsHidden(false)
 				, bShowScrollBarIfScrollable(false)
+				, VertexColorStyle(this)
 				, Handle(cbScrollBarHandleComponent::Create(this))
 			{}
 
@@ -169,7 +172,7 @@ namespace cbgui
 				, BarThickness(Other.BarThickness)
 				, ScrollAmount(Other.ScrollAmount)
 				, Padding(Other.Padding)
-				, VertexColorStyle(Other.VertexColorStyle)
+				, VertexColorStyle(this, Other.VertexColorStyle)
 				, ScrollStepPercent(Other.ScrollStepPercent)
 				, bIsHidden(bIsHidden)
 				, bShowScrollBarIfScrollable(bShowScrollBarIfScrollable)
@@ -192,9 +195,13 @@ namespace cbgui
 
 			virtual bool HasAnyComponents() const override final { return Handle != nullptr; }
 			virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>{ Handle.get()}; }
+			virtual std::size_t GetComponentsCount() const override final { return Handle ? 1 : 0; }
+			virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return Index == 0 ? Handle.get() : nullptr; }
 
 			virtual bool HasAnyChildren() const override final { return Handle != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Handle.get()}; }
+			virtual std::size_t GetChildrenCount() const override final { return Handle ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Handle.get() : nullptr; }
 
 			virtual bool HasGeometry() const override final { return true; }
 			virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
@@ -203,8 +210,10 @@ namespace cbgui
 
 			void SetHandleVertexColorStyle(const cbButtonVertexColorStyle& style) { Handle->SetVertexColorStyle(style); }
 			void SetBarVertexColorStyle(const cbVertexColorStyle& style);
+			void SetHandleVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& pHandle) { Handle->SetVertexColorStyle(pHandle); }
+			void SetBarVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& pHandle);
 
-			cbVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle; }
+			cbVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle.Get(); }
 			cbButtonVertexColorStyle GetHandleVertexColorStyle() const { return Handle->GetVertexColorStyle(); }
 
 			void SetHandleName(const std::string Name) const { Handle->SetName(Name); }
@@ -321,6 +330,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const final { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const final { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const final { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const final { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual cbBounds GetBounds() const override final { return cbBounds(GetDimension(), GetLocation()); }
 			virtual cbVector GetLocation() const override { return Location; }
@@ -383,9 +394,13 @@ namespace cbgui
 		virtual bool HasAnyChildren() const override final;
 		/* Returns slots and components. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final;
+		virtual std::size_t GetChildrenCount() const override final;
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final;
 
 		virtual bool HasAnyComponents() const override final { return ScrollBar != nullptr; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>{ ScrollBar.get() }; }
+		virtual std::size_t GetComponentsCount() const override final { return ScrollBar ? 1 : 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return Index == 0 ? ScrollBar.get() : nullptr; }
 
 		virtual bool HasGeometry() const override final { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
@@ -497,6 +512,9 @@ namespace cbgui
 		void SetScrollBarHandleName(const std::string Name) const { ScrollBar->SetHandleName(Name); }
 		inline void SetScrollBarBackgroundVertexColorStyle(const cbVertexColorStyle& style) { ScrollBar->SetBarVertexColorStyle(style); }
 		inline void SetScrollBarHandleVertexColorStyle(const cbButtonVertexColorStyle& style) { ScrollBar->SetHandleVertexColorStyle(style); }
+		/* References the shared styles, see cbStyleRegistry. */
+		inline void SetScrollBarBackgroundVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle) { ScrollBar->SetBarVertexColorStyle(Handle); }
+		inline void SetScrollBarHandleVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle) { ScrollBar->SetHandleVertexColorStyle(Handle); }
 		cbVertexColorStyle GetScrollBarBackgroundVertexColorStyle() const { return ScrollBar->GetVertexColorStyle(); }
 		cbButtonVertexColorStyle GetScrollBarHandleVertexColorStyle() const { return ScrollBar->GetHandleVertexColorStyle(); }
 
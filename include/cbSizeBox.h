@@ -91,6 +91,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const override final { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const override final { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual cbBounds GetBounds() const override final { return GetOwner()->GetBounds(); }
 			virtual cbVector GetLocation() const override final { return GetOwner<cbSizeBox>()->GetLocation(); }
@@ -180,11 +182,15 @@ namespace cbgui
 
 		/* Returns slots. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final;
+		virtual std::size_t GetChildrenCount() const override final { return Slot ? 1 : 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Slot.get() : nullptr; }
 		/* Checks whether a slot has been created. */
 		virtual bool HasAnyChildren() const override final { return Slot != nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasGeometry() const override final { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
@@ -102,11 +102,13 @@ namespace cbgui
 		public:
 			virtual bool HasGeometry() const override final { return true; }
 			virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
+			virtual std::optional<cbColor> GetVertexColor(const bool LineGeometry = false) const override final;
 			virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 			virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
 
-			cbButtonVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle; }
+			cbButtonVertexColorStyle GetVertexColorStyle() const { return VertexColorStyle.Get(); }
 			void SetVertexColorStyle(const cbButtonVertexColorStyle& style);
+			void SetVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle);
 
 		private:
 			void OnPressed();
@@ -117,7 +119,7 @@ namespace cbgui
 			void SetButtonStatus(const eButtonState& ButtonStatus);
 
 		private:
-			cbButtonVertexColorStyle VertexColorStyle;
+			cbStyleRef<cbButtonVertexColorStyle> VertexColorStyle;
 			eButtonState ButtonState;
 			float Length;
 			float Thickness;
@@ -237,9 +239,13 @@ namespace cbgui
 	public:
 		virtual bool HasAnyChildren() const override final { return Handle != nullptr; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Handle.get() }; }
+		virtual std::size_t GetChildrenCount() const override final { return Handle ? 1 : 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Handle.get() : nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return Handle != nullptr; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>{ Handle.get() }; }
+		virtual std::size_t GetComponentsCount() const override final { return Handle ? 1 : 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return Index == 0 ? Handle.get() : nullptr; }
 
 		inline void BindFunctionTo_OnValueChanged(std::function<void(float)> Function) { fOnValueChanged = Function; }
 		inline void UnBindFunctionTo_OnValueChanged() { fOnValueChanged = nullptr; }
@@ -261,10 +267,13 @@ namespace cbgui
 		virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 		virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
 
-		cbVertexColorStyle GetBarVertexColorStyle() const { return VertexColorStyle; }
+		cbVertexColorStyle GetBarVertexColorStyle() const { return VertexColorStyle.Get(); }
 		cbButtonVertexColorStyle GetHandleVertexColorStyle() const { return Handle->GetVertexColorStyle(); }
 		void SetBarVertexColorStyle(const cbVertexColorStyle& style);
 		void SetHandleVertexColorStyle(const cbButtonVertexColorStyle& style);
+		/* References the shared styles, see cbStyleRegistry. */
+		void SetBarVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& pHandle);
+		void SetHandleVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& pHandle);
 
 		void SetHandleName(const std::string Name) const { Handle->SetName(Name); }
 
@@ -273,7 +282,7 @@ namespace cbgui
 		virtual void OnRemoveFromParent() override final;
 
 	private:
-		cbVertexColorStyle VertexColorStyle;
+		cbStyleRef<cbVertexColorStyle> VertexColorStyle;
 		cbTransform Transform;
 		float Thickness;
 		bool bVerticalFill;
@@ -134,11 +134,8 @@ namespace cbgui
 	private:
 		cbSlottedBox* Owner;
 		bool bIsEnabled;
-		/*
-		* To Do :
-		* Cache CulledBounds
-		*/
-		//cbBounds CulledBounds;
+		/* Culled bounds and culled state, rebuilt after a layout change. */
+		mutable cbWorldCache WorldCache;
 	protected:
 		cbSlot(cbSlottedBox* pOwner)
 			: Super()
@@ -160,10 +157,11 @@ namespace cbgui
 
 	public:
 		void BeginPlay() { if (HasContent()) GetContent()->BeginPlay(); OnBeginPlay(); }
-		void Tick(float DeltaTime) { if (HasContent()) GetContent()->Tick(DeltaTime); OnTick(DeltaTime); }
+		/* Slots do not tick, the content is registered to the canvas on its own. */
+		virtual void Tick(float DeltaTime) override final {}
+		virtual std::optional<float> GetTickInterval() const override final { return std::nullopt; }
 	private:
 		virtual void OnBeginPlay() { }
-		virtual void OnTick(float DeltaTime) { }
 
 	public:
 		template<typename T>
@@ -187,6 +185,8 @@ namespace cbgui
 		virtual bool HasAnyChildren() const override { return false; }
 		/* Returns raw Content. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override { return std::vector<cbWidgetObj*>(); }
+		virtual std::size_t GetChildrenCount() const override { return 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override { return nullptr; }
 
 		virtual bool IsInside(const cbVector& Location) const
 		{
@@ -243,6 +243,10 @@ namespace cbgui
 		/* Returns owner rotation. */
 		virtual bool IsRotated() const override final;
 		virtual float GetRotation() const override final;
+		/* Returns owner render transform. */
+		virtual bool HasRenderTransform() const override final;
+		virtual cbMatrix2x3 GetRenderMatrix() const override final;
+		virtual float GetRenderOpacity() const override final;
 
 		virtual bool IsEnabled() const override final;
 		/* Returns content state. */
@@ -256,16 +260,15 @@ namespace cbgui
 		virtual void UpdateRotation() { if (HasContent()) GetContent()->UpdateRotation(); }
 		void UpdateStatus();
 
-		/*
-		* To Do :
-		* Cache CulledBounds
-		*/
-		//void UpdateCulledBounds();
-		//void UpdateVerticalCulledBounds();
-		//void UpdateHorizontalCulledBounds();
 		virtual cbBounds GetCulledBounds() const override;
+		virtual cbBounds GetRenderBounds() const override;
+		virtual void InvalidateWorldCache() override;
+		virtual void ChildWorldCacheValidated() const override;
 		/* Checks if it appears on the screen. */
 		virtual bool IsItCulled() const override;
+	private:
+		const cbWorldCache& GetWorldCache() const;
+	public:
 
 		/* Returns ZOrder Mode. Default : eZOrderMode::InOrder */
 		virtual eZOrderMode GetZOrderMode() const override;
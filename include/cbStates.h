@@ -27,7 +27,7 @@
 
 namespace cbgui
 {
-	enum class eZOrderMode
+	enum class eZOrderMode : unsigned short
 	{
 		/* Draw in the regular order. */
 		InOrder,
@@ -37,7 +37,7 @@ namespace cbgui
 		Latest,
 	};
 
-	enum class eFocusMode
+	enum class eFocusMode : unsigned short
 	{
 		/* Focus based on ZOrder. */
 		ZOrder,
@@ -45,7 +45,7 @@ namespace cbgui
 		Immediate,
 	};
 
-	enum class eVisibility
+	enum class eVisibility : unsigned short
 	{
 		/* The Widget is Visible. */
 		Visible,
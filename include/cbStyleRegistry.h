@@ -0,0 +1,292 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <cstddef>
+
+namespace cbgui
+{
+	class cbWidgetObj;
+
+	/* Link of a widget in the user list of a shared style. */
+	class cbStyleUser
+	{
+	protected:
+		cbStyleUser(cbWidgetObj* InOwner)
+			: Owner(InOwner)
+			, Prev(nullptr)
+			, Next(nullptr)
+		{}
+		~cbStyleUser() = default;
+
+	public:
+		cbStyleUser(const cbStyleUser&) = delete;
+		cbStyleUser& operator=(const cbStyleUser&) = delete;
+
+		inline cbWidgetObj* GetOwner() const { return Owner; }
+
+		/* Calls cbWidgetObj::VertexColorStyleUpdated for each user of the list. */
+		static void NotifyUsers(cbStyleUser* Head);
+
+	protected:
+		void Link(cbStyleUser*& Head);
+		void Unlink(cbStyleUser*& Head);
+
+	private:
+		cbWidgetObj* Owner;
+		cbStyleUser* Prev;
+		cbStyleUser* Next;
+	};
+
+	/* Interface class for Style Entry. */
+	class cbIStyleEntry
+	{
+	public:
+		virtual ~cbIStyleEntry() = default;
+
+		virtual std::size_t GetStyleHashCode() const = 0;
+		/* Copies the style of an entry of the same type and refreshes the users. */
+		virtual void Assign(const cbIStyleEntry& Other) = 0;
+		/* Called when the registry releases the entry, the users keep the last style. */
+		virtual void Unregister() = 0;
+	};
+
+	/*
+	* Style shared by the widgets that reference it.
+	* The style is immutable for the widgets, it is only replaced as a whole by cbStyleRegistry.
+	*/
+	template<typename T>
+	class cbStyleEntry : public cbIStyleEntry
+	{
+		template<typename> friend class cbStyleRef;
+		friend class cbStyleRegistry;
+	public:
+		using SharedPtr = std::shared_ptr<cbStyleEntry<T>>;
+
+		cbStyleEntry(const T& InStyle, const bool InRegistered = false)
+			: Style(InStyle)
+			, Users(nullptr)
+			, bIsRegistered(InRegistered)
+		{}
+		virtual ~cbStyleEntry() = default;
+
+		inline const T& Get() const { return Style; }
+		inline bool IsRegistered() const { return bIsRegistered; }
+
+		virtual std::size_t GetStyleHashCode() const override final { return T::GetStaticHashCode(); }
+		virtual void Assign(const cbIStyleEntry& Other) override final
+		{
+			if (Other.GetStyleHashCode() != GetStyleHashCode())
+				return;
+			Replace(static_cast<const cbStyleEntry<T>&>(Other).Style);
+		}
+		virtual void Unregister() override final { bIsRegistered = false; }
+
+	private:
+		void Replace(const T& InStyle)
+		{
+			Style = InStyle;
+			cbStyleUser::NotifyUsers(Users);
+		}
+
+	private:
+		T Style;
+		cbStyleUser* Users;
+		bool bIsRegistered;
+	};
+
+	/* Handle of a shared style. */
+	template<typename T>
+	using cbStyleHandle = std::shared_ptr<cbStyleEntry<T>>;
+
+	/*
+	* Style member of a widget, it references a shared entry instead of keeping a copy of the style.
+	* Widgets created with the default style or cloned from the same widget share one entry.
+	* Changing the style of a single widget copies the entry on write, registered styles are not modified.
+	*/
+	template<typename T>
+	class cbStyleRef : public cbStyleUser
+	{
+	public:
+		cbStyleRef(cbWidgetObj* InOwner)
+			: cbStyleRef(InOwner, GetDefault())
+		{}
+		cbStyleRef(cbWidgetObj* InOwner, const cbStyleRef& Other)
+			: cbStyleRef(InOwner, Other.Entry)
+		{}
+		cbStyleRef(cbWidgetObj* InOwner, const cbStyleHandle<T>& Handle)
+			: cbStyleUser(InOwner)
+			, Entry(Handle)
+		{
+			Link(Entry->Users);
+		}
+		~cbStyleRef()
+		{
+			Unlink(Entry->Users);
+		}
+
+		inline const T& Get() const { return Entry->Style; }
+		inline const T* operator->() const { return &Entry->Style; }
+		inline const cbStyleHandle<T>& GetHandle() const { return Entry; }
+		inline bool IsShared() const { return Entry->bIsRegistered || Entry.use_count() > 1; }
+
+		/* References the shared style, the widget follows its updates. */
+		void Bind(const cbStyleHandle<T>& Handle)
+		{
+			if (!Handle || Entry == Handle)
+				return;
+
+			Unlink(Entry->Users);
+			Entry = Handle;
+			Link(Entry->Users);
+		}
+
+		/* Replaces the style of this widget only. */
+		void Set(const T& Style)
+		{
+			if (IsShared())
+				Bind(std::make_shared<cbStyleEntry<T>>(Style));
+			else
+				Entry->Style = Style;
+		}
+
+		/* Modifies the style of this widget only, e.g. Edit([&](T& Style) { Style.SetColor(State, Color); }). */
+		template<typename Function>
+		void Edit(Function&& Func)
+		{
+			if (IsShared())
+			{
+				T Style = Entry->Style;
+				Func(Style);
+				Bind(std::make_shared<cbStyleEntry<T>>(Style));
+			}
+			else
+			{
+				Func(Entry->Style);
+			}
+		}
+
+		/* Entry of the default constructed style, shared by the widgets that do not set a style. */
+		static const cbStyleHandle<T>& GetDefault()
+		{
+			/* Never destroyed, widgets that outlive the static objects still unlink from it. */
+			static const cbStyleHandle<T>* Default = new cbStyleHandle<T>(std::make_shared<cbStyleEntry<T>>(T()));
+			return *Default;
+		}
+
+	private:
+		cbStyleHandle<T> Entry;
+	};
+
+	/*
+	* Named styles of a theme.
+	* Updating a style replaces one entry and refreshes the vertex colors of its users only,
+	* a theme swap with Apply is O(styles) and does not walk the widget hierarchy.
+	* Not thread safe, the styles are used by the thread that updates the widgets.
+	*/
+	class cbStyleRegistry
+	{
+	public:
+		cbStyleRegistry() = default;
+		~cbStyleRegistry();
+
+		cbStyleRegistry(const cbStyleRegistry&) = delete;
+		cbStyleRegistry& operator=(const cbStyleRegistry&) = delete;
+
+		/* Registers the style, an existing style with the same name and type is updated. */
+		template<typename T>
+		cbStyleHandle<T> Register(const std::string& Name, const T& Style)
+		{
+			if (auto Handle = Find<T>(Name))
+			{
+				Update(Handle, Style);
+				return Handle;
+			}
+
+			auto Handle = std::make_shared<cbStyleEntry<T>>(Style, true);
+			Styles.insert({ GetKey<T>(Name), Handle });
+			return Handle;
+		}
+
+		template<typename T>
+		cbStyleHandle<T> Find(const std::string& Name) const
+		{
+			const auto It = Styles.find(GetKey<T>(Name));
+			if (It == Styles.end())
+				return nullptr;
+			return std::static_pointer_cast<cbStyleEntry<T>>(It->second);
+		}
+
+		template<typename T>
+		bool Update(const std::string& Name, const T& Style)
+		{
+			if (auto Handle = Find<T>(Name))
+			{
+				Update(Handle, Style);
+				return true;
+			}
+			return false;
+		}
+
+		/* Replaces the shared style, the users only refresh their vertex colors. */
+		template<typename T>
+		static void Update(const cbStyleHandle<T>& Handle, const T& Style)
+		{
+			if (Handle)
+				Handle->Replace(Style);
+		}
+
+		/* The widgets keep the style, it is no longer updated by the registry. */
+		template<typename T>
+		bool Unregister(const std::string& Name)
+		{
+			const auto It = Styles.find(GetKey<T>(Name));
+			if (It == Styles.end())
+				return false;
+			It->second->Unregister();
+			Styles.erase(It);
+			return true;
+		}
+
+		/* Copies the styles of the theme to the styles with the same name and type, returns the updated style count. */
+		std::size_t Apply(const cbStyleRegistry& Theme);
+
+		inline std::size_t GetStyleCount() const { return Styles.size(); }
+
+	private:
+		typedef std::pair<std::size_t, std::string> cbStyleKey;
+
+		template<typename T>
+		static cbStyleKey GetKey(const std::string& Name) { return cbStyleKey(T::GetStaticHashCode(), Name); }
+
+	private:
+		std::map<cbStyleKey, std::shared_ptr<cbIStyleEntry>> Styles;
+	};
+}
@@ -35,6 +35,10 @@ namespace cbgui
 	class cbText : public cbWidget
 	{
 		cbClassBody(cbClassConstructor, cbText, cbWidget);
+		/* Notifies the canvas after the font atlas is compacted. */
+		friend cbFontGeometry;
+		/* Shapes the geometry in batches and commits the result. */
+		friend class cbTextBatchUpdater;
 	public:
 		cbText(const std::u32string& Text, const cbTextDesc& TextDesc, cbIFontFamily* FontFamily);
 		cbText(const cbText& Other);
@@ -80,9 +84,13 @@ namespace cbgui
 
 		virtual bool HasAnyChildren() const override final { return false; }
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>(); }
+		virtual std::size_t GetChildrenCount() const override final { return 0; }
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 		/* Sets the font and font library. Text library is required for text data. */
 		void SetFontFamily(cbIFontFamily* FontFamily);
@@ -100,8 +108,14 @@ namespace cbgui
 		const std::u32string GetText(bool Filtered = false) const;
 		/* Deletes the existing text, adds a new one. */
 		void SetText(const std::u32string& Text, const std::optional<cbTextDesc> Desc = std::nullopt);
+		/* Deletes the existing text, adds a new one decoded from UTF-8. Invalid sequences are replaced with U+FFFD. */
+		void SetTextUtf8(const std::string_view& Text, const std::optional<cbTextDesc> Desc = std::nullopt);
+		/* Deletes the existing text, adds a new one styled by the given runs. Style tags are not parsed. */
+		void SetStyledText(const std::u32string& Text, const std::vector<cbTextStyleRun>& Runs, const std::optional<cbTextDesc> Desc = std::nullopt);
 		/* Appends text to the end of existing text. */
 		void AppendText(const std::u32string& Text);
+		/* Appends UTF-8 text to the end of existing text. */
+		void AppendTextUtf8(const std::string_view& Text);
 		/* Creates Character. If filtered is true, the index location may change based on ignored characters. */
 		void AddChar(const char32_t pChar, const std::optional<std::size_t> Index = std::nullopt, bool Filtered = true);
 		/* Creates Character. If filtered is true, the index location may change based on ignored characters.*/
@@ -142,6 +156,8 @@ namespace cbgui
 
 		/* Sets the length of the space(32) character. */
 		void SetDefaultSpaceWidth(const std::optional<std::size_t> Width);
+		/* Every character advances by the widest of the given characters and is centered in its cell. Empty disables it. */
+		void SetTabularCharacters(const std::u32string& Characters);
 		/*
 		* Manipulates Current Line Ascender and Previous Line Descender.
 		* Default : 1.0f
@@ -174,14 +190,39 @@ namespace cbgui
 	protected:
 		/* Notifies the canvas and updates the geometry. */
 		void GeometryVerticesSizeChanged(std::size_t Size);
+	private:
+		/* Aligns the text after its geometry is rebuilt and notifies the canvas. */
+		void TextGeometryUpdated(const std::size_t OldVerticesSize);
+	protected:
+		/* Direct access for widgets that patch the geometry in place. The canvas must be notified by the caller. */
+		cbFontGeometry* GetFontGeometry() const { return FontGeometryBuilder.get(); }
 	public:
 		virtual bool HasGeometry() const override final { return true; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
+		virtual std::vector<cbGeometryVertexData> GetVertexRangeData(const std::size_t FirstVertex, const std::size_t VertexCount) const override final;
 		virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const override final;
 		virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const override final;
 
 		cbVertexColorStyle GetVertexColorStyle() const { return FontGeometryBuilder->GetVertexColorStyle(); }
 		void SetVertexColorStyle(const cbVertexColorStyle& style);
+		/* References the shared style, see cbStyleRegistry. */
+		void SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle);
+		/* Rebuilds the colors of the glyph vertices, the text is not single colored. */
+		virtual void VertexColorStyleUpdated() override final;
+
+		/* Only the lines inside the culled bounds are emitted. Rotated text and text under a render transform are always emitted in full. Default : true */
+		void SetGlyphClippingEnabled(const bool Value);
+		bool IsGlyphClippingEnabled() const { return bIsGlyphClippingEnabled; }
+		/* Re-emits the geometry if the visible lines differ from the emitted lines. Called when the culled bounds may have changed without moving the text. */
+		void UpdateClipping();
+	private:
+		std::optional<cbTextGlyphRange> GetVisibleGlyphRange() const;
+		/* Positions the glyph vertices [FirstVertex, EndVertex) of the font geometry. */
+		std::vector<cbGeometryVertexData> GetGlyphVertexData(const std::size_t FirstVertex, const std::size_t EndVertex) const;
+	protected:
+		/* Notify canvas, only the quads of the glyphs in the range are updated. Glyphs of culled lines are skipped. */
+		bool NotifyCanvas_GlyphsUpdated(const std::size_t FirstGlyph, const std::size_t GlyphCount);
+	public:
 
 		/*
 		//  On the to-do list.
@@ -213,5 +254,8 @@ namespace cbgui
 		cbTransform Transform;
 		cbFontGeometry::UniquePtr FontGeometryBuilder;
 		bool bIsItWrapped;
+		bool bIsGlyphClippingEnabled;
+		/* Glyph range of the last vertex data, used to skip re-emitting while the visible lines stay the same. */
+		mutable std::optional<cbTextGlyphRange> EmittedGlyphRange;
 	};
 }
@@ -0,0 +1,93 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include <memory>
+#include "cbText.h"
+
+namespace cbgui
+{
+	/*
+	* Updates the text of many labels at once.
+	* The texts are shaped in parallel from the existing glyphs, the missing glyphs and metrics of all texts are
+	* created in one pass on the calling thread, then the texts that were missing data are shaped again.
+	* The widgets and the canvas are updated on the calling thread after shaping.
+	*/
+	class cbTextBatchUpdater
+	{
+	public:
+		/*
+		* Uses the hardware thread count if zero, the calling thread is one of the threads.
+		* The worker threads are started by the first parallel Commit and kept until the updater is destroyed.
+		*/
+		cbTextBatchUpdater(const std::size_t InThreadCount = 0);
+		~cbTextBatchUpdater();
+
+		/* Adding the same text again replaces its pending string. */
+		void Add(cbText* Text, const std::u32string& String, const std::optional<cbTextDesc> Desc = std::nullopt);
+		void Add(cbText* Text, std::u32string&& String, const std::optional<cbTextDesc> Desc = std::nullopt);
+
+		/* Shapes and commits the added texts, the list is cleared. Must be called on the UI thread. */
+		void Commit();
+
+		inline std::size_t size() const { return Entries.size(); }
+		inline bool IsEmpty() const { return Entries.empty(); }
+		void Clear();
+
+	private:
+		struct cbTextBatchEntry
+		{
+			cbText* Text;
+			std::u32string String;
+			std::optional<cbTextDesc> Desc;
+			std::size_t OldVerticesSize;
+			cbFontRequests Requests;
+
+			cbTextBatchEntry(cbText* InText, std::u32string&& InString, const std::optional<cbTextDesc> InDesc)
+				: Text(InText)
+				, String(std::move(InString))
+				, Desc(InDesc)
+				, OldVerticesSize(0)
+				, Requests(cbFontRequests())
+			{}
+		};
+
+		/* Shapes the entries in read-only mode on the worker threads, small batches are shaped on the calling thread. */
+		void Shape(const std::vector<cbTextBatchEntry*>& Pending);
+		static void ShapeEntry(cbTextBatchEntry* Entry, const bool bReadOnly);
+
+	private:
+		std::vector<cbTextBatchEntry> Entries;
+		std::unordered_map<cbText*, std::size_t> Indices;
+		std::size_t ThreadCount;
+		class cbWorkerPool;
+		std::unique_ptr<cbWorkerPool> Workers;
+	};
+}
@@ -0,0 +1,152 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "cbFont.h"
+
+namespace cbgui
+{
+	/* Everything that affects the result of a text layout. */
+	struct cbTextLayoutKey
+	{
+		std::u32string Text;
+		const cbIFontFamily* FontFamily;
+		eFontType FontType;
+		std::size_t FontSize;
+		bool bIsTextStylingEnabled;
+		std::vector<cbTextStyle> TextStyles;
+		/* Negative if auto wrap is disabled. */
+		float WrapWidth;
+		eTextJustify TextJustify;
+		std::optional<std::size_t> DefaultSpaceWidth;
+		float LineHeightPercentage;
+		bool bIsAscenderDescenderPowerOfTwo;
+		std::u32string TabularCharacters;
+
+		std::size_t Hash;
+
+		cbTextLayoutKey()
+			: FontFamily(nullptr)
+			, FontType(eFontType::Regular)
+			, FontSize(24)
+			, bIsTextStylingEnabled(false)
+			, WrapWidth(-1.0f)
+			, TextJustify(eTextJustify::Left)
+			, DefaultSpaceWidth(std::nullopt)
+			, LineHeightPercentage(1.0f)
+			, bIsAscenderDescenderPowerOfTwo(true)
+			, Hash(0)
+		{}
+
+		/* Must be called after the key is filled. */
+		void GenerateHash();
+
+		bool operator==(const cbTextLayoutKey& Other) const;
+		bool operator!=(const cbTextLayoutKey& Other) const { return !(*this == Other); }
+	};
+
+	/* Shared result of a text layout. The geometries that reference it copy it before writing. */
+	using cbTextLayout = cbFontGeometry::cbGeometryData;
+
+	/*
+	* Process-wide cache of text layouts.
+	* Widgets that show the same string in the same style reference one layout instead of shaping and storing it again.
+	* A layout is only stored once its key was added a second time, strings shown once do not evict the repeated ones.
+	* Least recently used layouts are evicted when the memory budget is exceeded.
+	*/
+	class cbTextLayoutCache
+	{
+	private:
+		cbTextLayoutCache();
+		cbTextLayoutCache(const cbTextLayoutCache&) = delete;
+		cbTextLayoutCache(cbTextLayoutCache&&) = delete;
+		cbTextLayoutCache& operator=(const cbTextLayoutCache&) = delete;
+		cbTextLayoutCache& operator=(cbTextLayoutCache&&) = delete;
+
+	public:
+		~cbTextLayoutCache();
+
+		static cbTextLayoutCache& Get();
+
+		std::shared_ptr<cbTextLayout> Find(const cbTextLayoutKey& Key);
+		void Add(const cbTextLayoutKey& Key, const std::shared_ptr<cbTextLayout>& Layout);
+
+		/* Removes all layouts of the font family. */
+		void Invalidate(const cbIFontFamily* FontFamily);
+		void Clear();
+
+		void SetEnabled(const bool Value);
+		inline bool IsEnabled() const { return bIsEnabled; }
+
+		/*
+		* Maximum memory used by the cached layouts in bytes.
+		* Default : 8 MB
+		*/
+		void SetMemoryBudget(const std::size_t Bytes);
+		inline std::size_t GetMemoryBudget() const { return MemoryBudget; }
+		inline std::size_t GetMemoryUsage() const { return MemoryUsage; }
+
+		inline std::size_t GetLayoutCount() const { return Layouts.size(); }
+		inline std::size_t GetHitCount() const { return HitCount; }
+		inline std::size_t GetMissCount() const { return MissCount; }
+		inline std::size_t GetEvictionCount() const { return EvictionCount; }
+		void ResetCounters();
+
+	private:
+		void Evict();
+
+	private:
+		struct cbEntry
+		{
+			cbTextLayoutKey Key;
+			std::shared_ptr<cbTextLayout> Layout;
+			std::size_t MemorySize;
+		};
+
+		/* Hashes of the keys added once, cleared when it reaches MaxCandidateCount. */
+		std::unordered_set<std::size_t> Candidates;
+		static constexpr std::size_t MaxCandidateCount = 4096;
+
+		mutable std::mutex Mutex;
+
+		/* Most recently used at the front. */
+		std::list<cbEntry> Layouts;
+		std::unordered_map<std::size_t, std::list<cbEntry>::iterator> LayoutMap;
+
+		bool bIsEnabled;
+		std::size_t MemoryBudget;
+		std::size_t MemoryUsage;
+
+		std::size_t HitCount;
+		std::size_t MissCount;
+		std::size_t EvictionCount;
+	};
+}
@@ -0,0 +1,92 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <optional>
+#include "cbFont.h"
+
+namespace cbgui
+{
+	/* Layout settings of a measured text, mirrors the settings of cbFontGeometry. */
+	struct cbTextMeasureDesc
+	{
+		std::size_t CharSize;
+		eFontType FontType;
+		/* Lines are broken at word boundaries when the width is exceeded. */
+		std::optional<float> WrapWidth;
+		/* Length of the space(32) character, fonts default horiAdvance if not set. */
+		std::optional<std::size_t> DefaultSpaceWidth;
+		bool bIsAscenderDescenderPowerOfTwo;
+		/* Scales the distance between the lines, see cbFontGeometry::SetLineHeightPercentage. Default : 1.0f */
+		float LineHeightPercentage;
+
+		cbFORCEINLINE constexpr cbTextMeasureDesc(std::size_t InCharSize = 24, eFontType InFontType = eFontType::Regular, std::optional<float> InWrapWidth = std::nullopt)
+			: CharSize(InCharSize)
+			, FontType(InFontType)
+			, WrapWidth(InWrapWidth)
+			, DefaultSpaceWidth(std::nullopt)
+			, bIsAscenderDescenderPowerOfTwo(true)
+			, LineHeightPercentage(1.0f)
+		{}
+		cbFORCEINLINE constexpr cbTextMeasureDesc(const cbTextDesc& TextDesc, std::optional<float> InWrapWidth = std::nullopt)
+			: CharSize(TextDesc.CharSize)
+			, FontType(TextDesc.FontType)
+			, WrapWidth(InWrapWidth)
+			, DefaultSpaceWidth(std::nullopt)
+			, bIsAscenderDescenderPowerOfTwo(true)
+			, LineHeightPercentage(1.0f)
+		{}
+	};
+
+	struct cbTextMeasurement
+	{
+		/* Same as the geometry bounds of a cbText with the same text and settings. */
+		cbDimension Dimension;
+		std::size_t LineCount;
+
+		cbFORCEINLINE constexpr cbTextMeasurement()
+			: Dimension(cbDimension())
+			, LineCount(0)
+		{}
+	};
+
+	/*
+	* Measures text without building geometry.
+	* Uses the glyph metrics and kerning of the font family, glyphs are not rasterized or added to the atlas.
+	* The result matches the layout of cbFontGeometry, style tags are not parsed and count as text.
+	*/
+	class cbTextMeasurer
+	{
+	private:
+		cbTextMeasurer() = delete;
+
+	public:
+		/* Line widths are written to outLineWidths if given. The vector is cleared, reuse it to avoid allocation. */
+		static cbTextMeasurement Measure(cbIFontFamily* FontFamily, const std::u32string_view& Text, const cbTextMeasureDesc& Desc, std::vector<float>* outLineWidths = nullptr);
+	};
+}
@@ -0,0 +1,87 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include "cbWidget.h"
+
+namespace cbgui
+{
+	/*
+	* Flat list of the widgets and components that tick, owned by the canvas.
+	* Only the registered objects are ticked, the widget tree is not traversed.
+	* Objects with an interval are ticked with the time elapsed since their last tick.
+	*/
+	class cbTickList
+	{
+	public:
+		cbTickList();
+		~cbTickList() = default;
+
+		/* An interval of 0 ticks every frame. Registering again updates the interval. */
+		void Register(cbWidgetObj* Object, const float Interval = 0.0f);
+		void Unregister(cbWidgetObj* Object);
+		/* Registers or unregisters the object by its tick interval. */
+		void Update(cbWidgetObj* Object);
+		/* Updates the object and its children. */
+		void UpdateHierarchy(cbWidgetObj* Object);
+		/* Unregisters the object and its children. */
+		void UnregisterHierarchy(cbWidgetObj* Object);
+
+		bool IsRegistered(cbWidgetObj* Object) const { return Indices.find(Object) != Indices.end(); }
+
+		/* Objects can be registered or unregistered while ticking, new objects tick from the next frame. */
+		void Tick(const float DeltaTime);
+
+		inline std::size_t size() const { return Indices.size(); }
+		inline bool IsEmpty() const { return Indices.empty(); }
+		void Clear();
+
+	private:
+		void RemoveAt(const std::size_t Index);
+
+	private:
+		struct cbTickEntry
+		{
+			cbWidgetObj* Object;
+			float Interval;
+			float Elapsed;
+
+			cbTickEntry(cbWidgetObj* InObject, const float InInterval)
+				: Object(InObject)
+				, Interval(InInterval)
+				, Elapsed(0.0f)
+			{}
+		};
+
+		std::vector<cbTickEntry> Entries;
+		std::unordered_map<cbWidgetObj*, std::size_t> Indices;
+		bool bIsTicking;
+		bool bHasRemovedEntries;
+	};
+}
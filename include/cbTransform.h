@@ -45,10 +45,16 @@ namespace cbgui
 		float Rotation;
 		cbMargin Padding;
 
-		std::optional<float> WidthAlignment;
-		std::optional<float> HeightAlignment;
-		std::optional<float> WidthCompression;
-		std::optional<float> HeightCompression;
+		/* The values are only valid while the matching flag is set. */
+		float WidthAlignment;
+		float HeightAlignment;
+		float WidthCompression;
+		float HeightCompression;
+
+		bool bIsWidthAligned : 1;
+		bool bIsHeightAligned : 1;
+		bool bIsWidthCompressed : 1;
+		bool bIsHeightCompressed : 1;
 
 	public:
 		cbTransform(const cbDimension dimension = cbDimension(256.0f, 256.0f))
@@ -57,10 +63,14 @@ namespace cbgui
 			, LocationOffset(cbVector::Zero())
 			, Rotation(0.0f)
 			, Padding(cbMargin())
-			, WidthAlignment(std::nullopt)
-			, HeightAlignment(std::nullopt)
-			, WidthCompression(std::nullopt)
-			, HeightCompression(std::nullopt)
+			, WidthAlignment(0.0f)
+			, HeightAlignment(0.0f)
+			, WidthCompression(0.0f)
+			, HeightCompression(0.0f)
+			, bIsWidthAligned(false)
+			, bIsHeightAligned(false)
+			, bIsWidthCompressed(false)
+			, bIsHeightCompressed(false)
 		{}
 
 	public:
@@ -78,31 +88,31 @@ namespace cbgui
 		inline constexpr cbDimension GetDimension() const { return cbDimension(GetWidth(), GetHeight()); }
 		inline constexpr float GetWidth() const
 		{
-			if (WidthAlignment.has_value())
-				return WidthAlignment.value();
-			if (WidthCompression.has_value())
-				return WidthCompression.value();
+			if (bIsWidthAligned)
+				return WidthAlignment;
+			if (bIsWidthCompressed)
+				return WidthCompression;
 			return Dimension.GetWidth();
 		}
 		inline constexpr float GetHeight() const 
 		{
-			if (HeightAlignment.has_value())
-				return HeightAlignment.value();
-			if (HeightCompression.has_value())
-				return HeightCompression.value();
+			if (bIsHeightAligned)
+				return HeightAlignment;
+			if (bIsHeightCompressed)
+				return HeightCompression;
 			return Dimension.GetHeight();
 		}
 
 		inline constexpr float GetNonAlignedWidth() const
 		{
-			if (WidthCompression.has_value())
-				return WidthCompression.value();
+			if (bIsWidthCompressed)
+				return WidthCompression;
 			return Dimension.GetWidth();
 		}
 		inline constexpr float GetNonAlignedHeight() const
 		{
-			if (HeightCompression.has_value())
-				return HeightCompression.value();
+			if (bIsHeightCompressed)
+				return HeightCompression;
 			return Dimension.GetHeight();
 		}
 
@@ -115,15 +125,15 @@ namespace cbgui
 		/* Aligns Horizontally. */
 		bool Align(const eVerticalAlignment Align, const cbBounds BoundsToAlign, const eAnchors Anchor = eAnchors::Inside);
 
-		inline constexpr bool IsWidthAligned() const { return WidthAlignment.has_value(); }
-		inline constexpr bool IsHeightAligned() const { return HeightAlignment.has_value(); }
+		inline constexpr bool IsWidthAligned() const { return bIsWidthAligned; }
+		inline constexpr bool IsHeightAligned() const { return bIsHeightAligned; }
 		bool AlignWidth(float Alignment);
 		bool AlignHeight(float Alignment);
 		void ResetWidthAlignment();
 		void ResetHeightAlignment();
 
-		inline constexpr bool IsWidthCompressed() const { return WidthCompression != 0.0f; }
-		inline constexpr bool IsHeightCompressed() const { return HeightCompression != 0.0f; }
+		inline constexpr bool IsWidthCompressed() const { return !bIsWidthCompressed || WidthCompression != 0.0f; }
+		inline constexpr bool IsHeightCompressed() const { return !bIsHeightCompressed || HeightCompression != 0.0f; }
 		bool CompressWidth(const float Compression);
 		bool CompressHeight(const float Compression);
 		void ResetWidthCompressed();
@@ -182,4 +192,81 @@ namespace cbgui
 				+ " Padding: " + Padding.ToString() + " Rotation: " + std::to_string(GetRotation()) + " };");
 		}
 	};
+
+	/*
+	* Draw-time transform of a widget, applied by the renderer on top of the layout.
+	* Children inherit it. It does not change the layout or the geometry of the widget.
+	*/
+	struct cbRenderTransform
+	{
+		cbVector Translation;
+		/* Degrees, around the pivot. */
+		float Rotation;
+		cbVector Scale;
+		float Opacity;
+		/* Rotation and scale origin, relative to the widget bounds. (0.5, 0.5) is the center. */
+		cbVector Pivot;
+
+		cbFORCEINLINE constexpr cbRenderTransform()
+			: Translation(cbVector::Zero())
+			, Rotation(0.0f)
+			, Scale(cbVector(1.0f, 1.0f))
+			, Opacity(1.0f)
+			, Pivot(cbVector(0.5f, 0.5f))
+		{}
+		cbFORCEINLINE constexpr cbRenderTransform(const cbVector& InTranslation, const float InRotation = 0.0f, const cbVector& InScale = cbVector(1.0f, 1.0f), const float InOpacity = 1.0f)
+			: Translation(InTranslation)
+			, Rotation(InRotation)
+			, Scale(InScale)
+			, Opacity(InOpacity)
+			, Pivot(cbVector(0.5f, 0.5f))
+		{}
+
+		cbFORCEINLINE constexpr bool IsIdentity() const
+		{
+			return Translation == cbVector::Zero() && Rotation == 0.0f && Scale == cbVector(1.0f, 1.0f) && Opacity == 1.0f;
+		}
+
+		/* Returns the transform of the points inside the bounds. */
+		cbMatrix2x3 GetMatrix(const cbBounds& Bounds) const
+		{
+			const cbVector Origin(Bounds.Min.X + Bounds.GetWidth() * Pivot.X, Bounds.Min.Y + Bounds.GetHeight() * Pivot.Y);
+			return cbMatrix2x3::Translation(cbVector(-Origin.X, -Origin.Y)) * cbMatrix2x3::Scale(Scale) * cbMatrix2x3::Rotation(Rotation) * cbMatrix2x3::Translation(Origin + Translation);
+		}
+	};
+
+	/*
+	* World state of a widget, computed from its owners.
+	* It is marked dirty with the subtree of the widget whose layout, render transform or owner changed,
+	* and rebuilt on the next read.
+	*/
+	struct cbWorldCache
+	{
+		bool bIsValid;
+		/* Set by the widget that marked its subtree dirty, cleared when the widget or a child rebuilds. */
+		bool bIsSubtreeInvalid;
+		bool bIsRotated;
+		bool bIsCulled;
+		bool bHasRenderTransform;
+		float RenderOpacity;
+		cbMatrix2x3 RenderMatrix;
+		cbMatrix2x3 InverseRenderMatrix;
+		/* Scissor rect in layout space. */
+		cbBounds CulledBounds;
+
+		cbWorldCache()
+			: bIsValid(false)
+			, bIsSubtreeInvalid(false)
+			, bIsRotated(false)
+			, bIsCulled(false)
+			, bHasRenderTransform(false)
+			, RenderOpacity(1.0f)
+			, RenderMatrix(cbMatrix2x3::Identity())
+			, InverseRenderMatrix(cbMatrix2x3::Identity())
+		{}
+
+		inline bool IsValid() const { return bIsValid; }
+		inline void Validate() { bIsValid = true; bIsSubtreeInvalid = false; }
+		inline void Invalidate() { bIsValid = false; bIsSubtreeInvalid = true; }
+	};
 }
@@ -0,0 +1,49 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace cbgui
+{
+	/*
+	* Decodes UTF-8 and appends the code points to Out.
+	* Invalid or truncated sequences, overlong forms and surrogates are replaced with U+FFFD.
+	* Returns false if the text was not valid UTF-8.
+	*/
+	bool DecodeUtf8(const std::string_view& Text, std::u32string& Out);
+	/* Decodes UTF-8, invalid sequences are replaced with U+FFFD. */
+	std::u32string DecodeUtf8(const std::string_view& Text);
+
+	/*
+	* Encodes the code points as UTF-8 and appends them to Out.
+	* Surrogates and values above U+10FFFF are replaced with U+FFFD.
+	*/
+	void EncodeUtf8(const std::u32string_view& Text, std::string& Out);
+	/* Encodes the code points as UTF-8, invalid code points are replaced with U+FFFD. */
+	std::string EncodeUtf8(const std::u32string_view& Text);
+}
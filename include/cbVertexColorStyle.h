@@ -26,7 +26,7 @@
 #pragma once
 
 #include <vector>
-#include <map>
+#include <array>
 
 #include "cbClassBody.h"
 #include "cbMath.h"
@@ -130,65 +130,67 @@ namespace cbgui
 			: bUseDisabledVertexColorStyle(UseDisabledVertexColorStyle)
 			, DisabledVertexColorStyle(inDisabledVertexColorStyle)
 		{
-			PolygonColors.insert({ eButtonState::Default, DefaultColor });
-			PolygonColors.insert({ eButtonState::Pressed, DefaultColor });
-			PolygonColors.insert({ eButtonState::Hovered, DefaultColor });
-			PolygonColors.insert({ eButtonState::Disabled, DefaultColor });
+			PolygonColors[GetPaletteIndex(eButtonState::Default)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eButtonState::Pressed)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eButtonState::Hovered)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eButtonState::Disabled)] = DefaultColor;
 		}
 		cbFORCEINLINE cbButtonVertexColorStyle(const cbColor& DefaultColor, const cbColor& PressedColor, const cbColor& HoveredColor, const cbColor& DisabledColor, 
 						const bool UseDisabledVertexColorStyle = false, const cbDisabledVertexColorStyle inDisabledVertexColorStyle = cbDisabledVertexColorStyle())
 			: bUseDisabledVertexColorStyle(UseDisabledVertexColorStyle)
 			, DisabledVertexColorStyle(inDisabledVertexColorStyle)
 		{
-			PolygonColors.insert({ eButtonState::Default, DefaultColor });
-			PolygonColors.insert({ eButtonState::Pressed, PressedColor });
-			PolygonColors.insert({ eButtonState::Hovered, HoveredColor });
-			PolygonColors.insert({ eButtonState::Disabled, DisabledColor });
+			PolygonColors[GetPaletteIndex(eButtonState::Default)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eButtonState::Pressed)] = PressedColor;
+			PolygonColors[GetPaletteIndex(eButtonState::Hovered)] = HoveredColor;
+			PolygonColors[GetPaletteIndex(eButtonState::Disabled)] = DisabledColor;
 		}
 
-		virtual ~cbButtonVertexColorStyle()
-		{
-			PolygonColors.clear();
-		}
+		virtual ~cbButtonVertexColorStyle() = default;
 
 	public:
-		std::map<eButtonState, cbColor> PolygonColors;
+		/* State colors, indexed by the button state. */
+		std::array<cbColor, 4> PolygonColors;
+
+		static constexpr std::size_t GetPaletteIndex(const eButtonState State) { return static_cast<std::size_t>(State); }
+		/* Resolved state colors, the draw state of the button is the index of its color. */
+		const std::array<cbColor, 4>& GetPalette() const { return PolygonColors; }
 
 		cbDisabledVertexColorStyle GetDisabledVertexColorStyle() const { return DisabledVertexColorStyle; };
 
 		inline cbColor GetColor(const eButtonState& Status) const
 		{
-			return PolygonColors.at(Status);
+			return PolygonColors[GetPaletteIndex(Status)];
 		}
 
 		inline void SetColor(const eButtonState State, const cbColor& Color)
 		{
-			PolygonColors[State] = Color;
+			PolygonColors[GetPaletteIndex(State)] = Color;
 		}
 
 		inline void SetDefaultColor(const cbColor& Color)
 		{
-			PolygonColors[eButtonState::Default] = Color;
+			PolygonColors[GetPaletteIndex(eButtonState::Default)] = Color;
 		}
 
 		inline void SetDisabledColor(const cbColor& Color)
 		{
-			PolygonColors[eButtonState::Disabled] = Color;
+			PolygonColors[GetPaletteIndex(eButtonState::Disabled)] = Color;
 		}
 
 		inline void SetHoveredColor(const cbColor& Color)
 		{
-			PolygonColors[eButtonState::Hovered] = Color;
+			PolygonColors[GetPaletteIndex(eButtonState::Hovered)] = Color;
 		}
 
 		inline void SetPressedColor(const cbColor& Color)
 		{
-			PolygonColors[eButtonState::Pressed] = Color;
+			PolygonColors[GetPaletteIndex(eButtonState::Pressed)] = Color;
 		}
 
 		inline cbColor GetDisabledColor() const
 		{
-			return bUseDisabledVertexColorStyle ? DisabledVertexColorStyle(PolygonColors.at(eButtonState::Default)) : PolygonColors.at(eButtonState::Disabled);
+			return bUseDisabledVertexColorStyle ? DisabledVertexColorStyle(PolygonColors[GetPaletteIndex(eButtonState::Default)]) : PolygonColors[GetPaletteIndex(eButtonState::Disabled)];
 		}
 	};
 
@@ -209,116 +211,118 @@ namespace cbgui
 			: bUseDisabledVertexColorStyle(UseDisabledVertexColorStyle)
 			, DisabledVertexColorStyle(inDisabledVertexColorStyle)
 		{
-			PolygonColors.insert({ eCheckBoxState::Unchecked, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::UncheckedHovered, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::UncheckedPressed, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::Checked, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::CheckedHovered, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::CheckedPressed, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::Undetermined, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::UndeterminedHovered, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::UndeterminedPressed, DefaultColor });
+			PolygonColors[GetPaletteIndex(eCheckBoxState::Unchecked)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedHovered)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedPressed)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::Checked)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedHovered)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedPressed)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::Undetermined)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedHovered)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedPressed)] = DefaultColor;
 
-			PolygonColors.insert({ eCheckBoxState::UncheckedDisabled, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::CheckedDisabled, DefaultColor });
-			PolygonColors.insert({ eCheckBoxState::UndeterminedDisabled, DefaultColor });
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedDisabled)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedDisabled)] = DefaultColor;
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedDisabled)] = DefaultColor;
 		}
 
-		virtual ~cbCheckBoxVertexColorStyle()
-		{
-			PolygonColors.clear();
-		}
+		virtual ~cbCheckBoxVertexColorStyle() = default;
 
 	public:
-		std::map<eCheckBoxState, cbColor> PolygonColors;
+		/* State colors, indexed by the check box state. */
+		std::array<cbColor, 12> PolygonColors;
+
+		static constexpr std::size_t GetPaletteIndex(const eCheckBoxState State) { return static_cast<std::size_t>(State); }
+		/* Resolved state colors, the draw state of the check box is the index of its color. */
+		const std::array<cbColor, 12>& GetPalette() const { return PolygonColors; }
 
 		cbDisabledVertexColorStyle GetDisabledVertexColorStyle() const { return DisabledVertexColorStyle; };
 
 		inline cbColor GetColor(const eCheckBoxState& Status) const
 		{
-			return PolygonColors.at(Status);
+			return PolygonColors[GetPaletteIndex(Status)];
 		}
 		inline cbColor GetDisabledColor(const eCheckBoxState& Status) const
 		{
-			return bUseDisabledVertexColorStyle ? DisabledVertexColorStyle(PolygonColors.at((Status == eCheckBoxState::Checked || Status == eCheckBoxState::CheckedPressed || Status == eCheckBoxState::CheckedHovered || 
+			return bUseDisabledVertexColorStyle ? DisabledVertexColorStyle(PolygonColors[GetPaletteIndex((Status == eCheckBoxState::Checked || Status == eCheckBoxState::CheckedPressed || Status == eCheckBoxState::CheckedHovered || 
 				Status == eCheckBoxState::CheckedDisabled) ? eCheckBoxState::Checked : (Status == eCheckBoxState::Undetermined || Status == eCheckBoxState::UndeterminedPressed || Status == eCheckBoxState::UndeterminedHovered || 
-				Status == eCheckBoxState::UndeterminedDisabled) ? eCheckBoxState::Undetermined : eCheckBoxState::Unchecked)) : PolygonColors.at(Status);
+				Status == eCheckBoxState::UndeterminedDisabled) ? eCheckBoxState::Undetermined : eCheckBoxState::Unchecked)]) : PolygonColors[GetPaletteIndex(Status)];
 		}
 
 		inline void SetColor(const eCheckBoxState State, const cbColor& Color)
 		{
-			PolygonColors[State] = Color;
+			PolygonColors[GetPaletteIndex(State)] = Color;
 		}
 
 		inline void SetUncheckedColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::Unchecked] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::Unchecked)] = (Color);
 		}
 		inline void SetUncheckedHoveredColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UncheckedHovered] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedHovered)] = (Color);
 		}
 		inline void SetUncheckedPressedColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UncheckedPressed] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedPressed)] = (Color);
 		}
 
 		inline void SetCheckedColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::Checked] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::Checked)] = (Color);
 		}
 		inline void SetCheckedHoveredColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::CheckedHovered] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedHovered)] = (Color);
 		}
 		inline void SetCheckedPressedColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::CheckedPressed] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedPressed)] = (Color);
 		}
 
 		inline void SetUndeterminedColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::Undetermined] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::Undetermined)] = (Color);
 		}
 		inline void SetUndeterminedHoveredColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UndeterminedHovered] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedHovered)] = (Color);
 		}
 		inline void SetUndeterminedPressedColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UndeterminedPressed] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedPressed)] = (Color);
 		}
 
 		inline void SetUncheckedDisabledColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UncheckedDisabled] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedDisabled)] = (Color);
 		}
 		inline void SetCheckedDisabledColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::CheckedDisabled] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedDisabled)] = (Color);
 		}
 		inline void SetUndeterminedDisabledColor(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UndeterminedDisabled] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedDisabled)] = (Color);
 		}
 
 		inline void SetDefaultHoveredColors(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UncheckedHovered] = (Color);
-			PolygonColors[eCheckBoxState::CheckedHovered] = (Color);
-			PolygonColors[eCheckBoxState::UndeterminedHovered] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedHovered)] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedHovered)] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedHovered)] = (Color);
 		}
 		inline void SetDefaultDisabledColors(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UncheckedDisabled] = (Color);
-			PolygonColors[eCheckBoxState::CheckedDisabled] = (Color);
-			PolygonColors[eCheckBoxState::UndeterminedDisabled] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedDisabled)] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedDisabled)] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedDisabled)] = (Color);
 		}
 		inline void SetDefaultPressedColors(const cbColor& Color)
 		{
-			PolygonColors[eCheckBoxState::UncheckedPressed] = (Color);
-			PolygonColors[eCheckBoxState::CheckedPressed] = (Color);
-			PolygonColors[eCheckBoxState::UndeterminedPressed] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UncheckedPressed)] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::CheckedPressed)] = (Color);
+			PolygonColors[GetPaletteIndex(eCheckBoxState::UndeterminedPressed)] = (Color);
 		}
 	};
 }
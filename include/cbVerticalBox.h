@@ -51,10 +51,12 @@ namespace cbgui
 		private:
 			void UpdateHorizontalDimension()
 			{
+				InvalidateWorldCache();
 				Dimension.Width = GetOwner<cbVerticalBox>()->GetWidth();
 			}
 			void UpdateVerticalDimension()
 			{
+				InvalidateWorldCache();
 				if (Alignment == eSlotAlignment::BoundToContent)
 					Dimension.Height = Content ? Content->GetNonAlignedHeight() + Content->GetPadding().GetHeight() : 0.0f;
 				else if (Alignment == eSlotAlignment::BoundToSlot)
@@ -62,10 +64,12 @@ namespace cbgui
 			}
 			void UpdateHorizontalLocation()
 			{
+				InvalidateWorldCache();
 				Location.X = (GetOwner<cbVerticalBox>()->GetLocation().X);
 			}
 			void UpdateVerticalLocation()
 			{
+				InvalidateWorldCache();
 				Location.Y = (GetOwner<cbVerticalBox>()->GetNextSlotLocation(eVerticalAlignment::Align_Top, this) + GetHeight() / 2.0f);
 			}
 
@@ -134,6 +138,8 @@ namespace cbgui
 
 			virtual bool HasAnyChildren() const override final { return Content != nullptr; }
 			virtual std::vector<cbWidgetObj*> GetAllChildren() const override final { return std::vector<cbWidgetObj*>{ Content.get() }; }
+			virtual std::size_t GetChildrenCount() const override final { return Content ? 1 : 0; }
+			virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final { return Index == 0 ? Content.get() : nullptr; }
 
 			virtual cbBounds GetBounds() const override final { return cbBounds(GetDimension(), GetLocation()); }
 			virtual cbVector GetLocation() const override { return Location; }
@@ -234,9 +240,13 @@ namespace cbgui
 		virtual bool HasAnyChildren() const override final;
 		/* Returns slots and components. */
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const override final;
+		virtual std::size_t GetChildrenCount() const override final;
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const override final;
 
 		virtual bool HasAnyComponents() const override final { return false; }
 		virtual std::vector<cbComponent*> GetAllComponents() const override final { return std::vector<cbComponent*>(); }
+		virtual std::size_t GetComponentsCount() const override final { return 0; }
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const override final { return nullptr; }
 
 		virtual bool HasGeometry() const override final { return false; }
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const override final;
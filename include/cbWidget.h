@@ -52,6 +52,11 @@ namespace cbgui
 	public:
 		virtual std::string GetName() const = 0;
 
+		/* Called by the canvas every frame or interval, only if the object is registered to tick. */
+		virtual void Tick(float DeltaTime) = 0;
+		/* Returns the tick interval in seconds if the object ticks, 0 ticks every frame. */
+		virtual std::optional<float> GetTickInterval() const = 0;
+
 		/*
 		* If it has no owner and no canvas, returns the center position.
 		* If owner exists, returns the origin of the owner.
@@ -71,6 +76,13 @@ namespace cbgui
 		/* 2D Rotation. Requires Stencil Clipping during rendering, */
 		virtual float GetRotation() const = 0;
 		virtual bool IsRotated() const = 0;
+		/* Draw-time transform of the owners and the widget, it does not affect the layout. */
+		virtual bool HasRenderTransform() const = 0;
+		virtual cbMatrix2x3 GetRenderMatrix() const = 0;
+		/* Opacity of the render transforms of the owners and the widget. */
+		virtual float GetRenderOpacity() const = 0;
+		/* Opacity of the widget alone. The renderer multiplies it down the hierarchy. */
+		virtual float GetLocalRenderOpacity() const { return 1.0f; }
 		/* Returns Aligned/Wrapped dimension of the Widget */
 		virtual cbDimension GetDimension() const = 0;
 		/* Return Aligned/Wrapped width of the Widget */
@@ -86,6 +98,15 @@ namespace cbgui
 		* otherwise it will give bad results.
 		*/
 		virtual cbBounds GetCulledBounds() const = 0;
+		/* Culled bounds after the render transform, in screen space. */
+		virtual cbBounds GetRenderBounds() const = 0;
+		/*
+		* Marks the cached world state of the object and its children dirty.
+		* Called when the layout, the render transform, the owner or the canvas of the object changes.
+		*/
+		virtual void InvalidateWorldCache() { ForEachChild([](cbWidgetObj* Child) { Child->InvalidateWorldCache(); }); }
+		/* Called when a child rebuilds its world state, the owners clear their dirty subtree marks up to the first valid one. */
+		virtual void ChildWorldCacheValidated() const { if (HasOwner()) GetOwner()->ChildWorldCacheValidated(); }
 
 		virtual eZOrderMode GetZOrderMode() const = 0;
 		virtual std::int32_t GetZOrder() const = 0;
@@ -114,18 +135,43 @@ namespace cbgui
 
 		virtual bool HasGeometry() const = 0;
 		virtual std::vector<cbGeometryVertexData> GetVertexData(const bool LineGeometry = false) const = 0;
+		/* Returns the vertices [FirstVertex, FirstVertex + VertexCount) of GetVertexData, clamped to its size. */
+		virtual std::vector<cbGeometryVertexData> GetVertexRangeData(const std::size_t FirstVertex, const std::size_t VertexCount) const;
 		virtual std::vector<std::uint32_t> GetIndexData(const bool LineGeometry = false) const = 0;
 		virtual cbGeometryDrawData GetGeometryDrawData(const bool LineGeometry = false) const = 0;
 		/*
+		* Returns the color of all vertices if the geometry is single colored, without generating the geometry.
+		* If std::nullopt, the color can only be updated with GetVertexData.
+		*/
+		virtual std::optional<cbColor> GetVertexColor(const bool LineGeometry = false) const { return std::nullopt; }
+		/*
 		* Overrides Vertex Color Style Alpha
 		* If Alpha is std::nullopt, VertexColorStyle controls the Alpha channel.
-		* This could be a fade out effect.
+		* The vertices of the widget and its children are updated, use cbWidget::SetRenderOpacity for fade effects.
 		*/
 		virtual void SetVertexColorAlpha(std::optional<float> Alpha, bool PropagateToChildren = true) = 0;
 		virtual std::optional<float> GetVertexColorAlpha() const = 0;
+		/* Called by cbStyleRegistry when a shared style of the object is replaced, only the vertex colors are updated. */
+		virtual void VertexColorStyleUpdated() {}
 
 		virtual bool HasAnyChildren() const = 0;
 		virtual std::vector<cbWidgetObj*> GetAllChildren() const = 0;
+		/* Returns the number of children, in the same order as GetAllChildren. */
+		virtual std::size_t GetChildrenCount() const = 0;
+		/* Returns the child at the index without building the children list. */
+		virtual cbWidgetObj* GetChildAt(const std::size_t Index) const = 0;
+
+		/* Visits the children in draw order without allocating. */
+		template<typename Function>
+		void ForEachChild(Function&& Func) const
+		{
+			const std::size_t Count = GetChildrenCount();
+			for (std::size_t i = 0; i < Count; i++)
+			{
+				if (cbWidgetObj* Child = GetChildAt(i))
+					Func(Child);
+			}
+		}
 	};
 
 	/* Abstract base class for Widget. */
@@ -141,10 +187,18 @@ namespace cbgui
 		virtual ~cbWidget();
 
 		virtual void BeginPlay() = 0;
-		virtual void Tick(float DeltaTime) = 0;
+		virtual void Tick(float DeltaTime) override = 0;
+
+		/*
+		* Registers the widget to the tick list of the canvas, an interval of 0 ticks every frame.
+		* The children are not ticked by their owner, each widget that needs per-frame updates must enable it.
+		*/
+		void SetTickEnabled(const bool Value, const float Interval = 0.0f);
+		inline bool IsTickEnabled() const { return Extension && Extension->TickInterval.has_value(); }
+		virtual std::optional<float> GetTickInterval() const override final { return Extension ? Extension->TickInterval : std::nullopt; }
 
-		inline void SetName(const std::string& inName) { Name = inName; }
-		virtual std::string GetName() const override final { return Name.has_value() ? Name.value() : GetClassID(); }
+		inline void SetName(const std::string& inName) { GetExtension().Name = inName; }
+		virtual std::string GetName() const override final { return Extension && Extension->Name.has_value() ? Extension->Name.value() : GetClassID(); }
 
 		bool IsItSharedObject() const { return !weak_from_this().expired(); }
 		std::optional<long> GetSharedObjectUseCount() const { if (!IsItSharedObject()) return std::nullopt; return weak_from_this().use_count(); }
@@ -153,6 +207,16 @@ namespace cbgui
 		std::shared_ptr<T> Clone() { return std::static_pointer_cast<T>(CloneWidget()); }
 		virtual cbWidget::SharedPtr CloneWidget() = 0;
 
+		/*
+		* Clones the widget as an instance of this prototype. The text layout and geometry are shared with the prototype
+		* and copied on the first change, the styles are shared as in Clone.
+		*/
+		template<typename T>
+		std::shared_ptr<T> Instantiate() { return std::static_pointer_cast<T>(InstantiateWidget()); }
+		cbWidget::SharedPtr InstantiateWidget();
+		/* True while InstantiateWidget is cloning on the calling thread. */
+		static bool IsInstantiating();
+
 		/*
 		* If it has no owner and no canvas, returns the center position.
 		* If owner exists, returns the origin of the owner.
@@ -178,16 +242,33 @@ namespace cbgui
 		void SetWidth(const float Width) { SetWidthHeight(Width, std::nullopt); }
 		void SetHeight(const float Height) { SetWidthHeight(std::nullopt, Height); }
 
-		virtual bool IsRotated() const override { return HasOwner() ? GetOwner()->IsRotated() || GetRotation() != 0.0f : GetRotation() != 0.0f; }
+		virtual bool IsRotated() const override;
 		/* 2D Rotation. Requires Stencil Clipping during rendering, */
 		virtual void SetRotation(const float Rotation) = 0;
 
+		/*
+		* Sets the draw-time transform. The renderer applies it to the widget and its children,
+		* the layout and the geometry are not updated. Hit testing accounts for it.
+		*/
+		void SetRenderTransform(const cbRenderTransform& Transform);
+		void ResetRenderTransform();
+		inline cbRenderTransform GetRenderTransform() const { return Extension && Extension->RenderTransform.has_value() ? Extension->RenderTransform.value() : cbRenderTransform(); }
+		virtual bool HasRenderTransform() const override;
+		virtual cbMatrix2x3 GetRenderMatrix() const override;
+		/* Maps screen space to layout space, used for hit testing. */
+		cbMatrix2x3 GetInverseRenderMatrix() const;
+		virtual float GetRenderOpacity() const override;
+		virtual float GetLocalRenderOpacity() const override { return Extension && Extension->RenderTransform.has_value() ? Extension->RenderTransform->Opacity : 1.0f; }
+		/* Sets the opacity of the render transform. The children inherit it at draw time, the vertices are not updated. */
+		void SetRenderOpacity(const float Opacity);
+
 		virtual cbMargin GetPadding() const = 0;
 		/* Padding is used to align with offset. The padding only works if attached into slot. */
 		virtual void SetPadding(const cbMargin& Padding) = 0;
 
 		virtual void SetVertexColorAlpha(std::optional<float> Alpha, bool PropagateToChildren = true) override final;
 		virtual std::optional<float> GetVertexColorAlpha() const override final;
+		virtual void VertexColorStyleUpdated() override { NotifyCanvas_ColorUpdated(); }
 
 		virtual bool IsInside(const cbVector& Location) const;
 		virtual bool Intersect(const cbBounds& Other) const;
@@ -200,6 +281,9 @@ namespace cbgui
 		* otherwise it will give bad results.
 		*/
 		virtual cbBounds GetCulledBounds() const override;
+		virtual cbBounds GetRenderBounds() const override;
+		virtual void InvalidateWorldCache() override;
+		virtual void ChildWorldCacheValidated() const override;
 
 		void SetZOrderMode(const eZOrderMode Mode);
 		virtual eZOrderMode GetZOrderMode() const override final { return ZOrderMode; }
@@ -254,6 +338,10 @@ namespace cbgui
 		bool DimensionUpdated();
 		/* Notify canvas, transform updated. */
 		bool NotifyCanvas_WidgetUpdated();
+		/* Notify canvas, only the vertex color is updated. */
+		bool NotifyCanvas_ColorUpdated();
+		/* Notify canvas, only the vertices in the range are updated. */
+		bool NotifyCanvas_VerticesUpdated(const std::size_t FirstVertex, const std::size_t VertexCount);
 
 	public:
 		template<class T>
@@ -276,6 +364,20 @@ namespace cbgui
 
 		virtual bool HasAnyComponents() const = 0;
 		virtual std::vector<cbComponent*> GetAllComponents() const = 0;
+		virtual std::size_t GetComponentsCount() const = 0;
+		virtual cbComponent* GetComponentAt(const std::size_t Index) const = 0;
+
+		/* Visits the components without allocating. */
+		template<typename Function>
+		void ForEachComponent(Function&& Func) const
+		{
+			const std::size_t Count = GetComponentsCount();
+			for (std::size_t i = 0; i < Count; i++)
+			{
+				if (cbComponent* Component = GetComponentAt(i))
+					Func(Component);
+			}
+		}
 
 	private:
 		virtual void OnFocus() {}
@@ -333,30 +435,48 @@ namespace cbgui
 		virtual void ResetInput() = 0;
 
 	public:
-		bool bShouldNotifyCanvas;
+		bool bShouldNotifyCanvas : 1;
 
 	private:
-		std::optional<std::string> Name;
+		/* Rarely set state, allocated on first use so that plain widgets do not pay for it. */
+		struct cbWidgetExtension
+		{
+			std::optional<std::string> Name;
+			std::optional<cbRenderTransform> RenderTransform;
+			std::optional<float> TickInterval;
+		};
 
-		std::optional<float> VertexColorAlpha;
+		/* Returns the extension block, creates it if it does not exist. */
+		cbWidgetExtension& GetExtension();
 
-		bool bIsEnabled;
-		eVisibility Visibility;
-		bool bFocusable;
-		bool bFocused;
-		eFocusMode FocusMode;
+		/* Rebuilds the world state if a transform, an owner or the canvas bounds changed since the last read. */
+		const cbWorldCache& GetWorldCache() const;
 
-		bool bIsAlignedToCanvas;
-		eVerticalAlignment mVAlignment;
-		eHorizontalAlignment mHAlignment;
-		eAnchors VerticalAnchor;
-		eAnchors HorizontalAnchor;
-		eCanvasAnchor CanvasAnchor;
+	private:
+		std::unique_ptr<cbWidgetExtension> Extension;
 
-		eZOrderMode ZOrderMode;
-		std::int32_t ZOrder;
+		std::optional<float> VertexColorAlpha;
+		/* World state computed from the owners, see GetWorldCache. */
+		mutable cbWorldCache WorldCache;
 
 		cbSlot* Owner;
 		cbICanvas* Canvas;
+
+		std::int32_t ZOrder;
+
+		/* The flags and the enums are packed, the widths must hold every value of the enum. */
+		bool bIsEnabled : 1;
+		bool bFocusable : 1;
+		bool bFocused : 1;
+		bool bIsAlignedToCanvas : 1;
+		eVisibility Visibility : 2;
+		eFocusMode FocusMode : 1;
+		eZOrderMode ZOrderMode : 2;
+
+		eVerticalAlignment mVAlignment : 3;
+		eHorizontalAlignment mHAlignment : 3;
+		eAnchors VerticalAnchor : 2;
+		eAnchors HorizontalAnchor : 2;
+		eCanvasAnchor CanvasAnchor : 4;
 	};
 }
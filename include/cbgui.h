@@ -26,12 +26,21 @@
 #pragma once
 
 #include "cbCanvas.h"
+#include "cbInputQueue.h"
+#include "cbKeyDispatcher.h"
 #include "cbBorder.h"
 #include "cbButton.h"
 #include "cbCheckBox.h"
 #include "cbSizeBox.h"
 #include "cbFont.h"
 #include "cbText.h"
+#include "cbNumericText.h"
+#include "cbTextLayoutCache.h"
+#include "cbTextMeasurer.h"
+#include "cbTextBatchUpdater.h"
+#include "cbTickList.h"
+#include "cbUtf8.h"
+#include "cbStyleRegistry.h"
 #include "cbImage.h"
 #include "cbSlider.h"
 #include "cbOverlay.h"
@@ -0,0 +1,124 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbArena.h"
+
+namespace cbgui
+{
+	/* Arena of the calling thread, see cbArena::Bind. */
+	static thread_local cbArena* BoundArena = nullptr;
+
+	cbArena::cbArena(const std::size_t InChunkSize)
+		: FreeLists()
+		, Cursor(nullptr)
+		, Remaining(0)
+		, ChunkBytes(((InChunkSize < MaxPooledSize ? MaxPooledSize : InChunkSize) + Granularity - 1) / Granularity * Granularity)
+		, UsedBytes(0)
+		, HeapBytes(0)
+		, AllocationCount(0)
+	{}
+
+	cbArena::~cbArena()
+	{
+		if (BoundArena == this)
+			BoundArena = nullptr;
+
+		for (auto& Chunk : Chunks)
+			::operator delete(Chunk);
+		Chunks.clear();
+	}
+
+	void* cbArena::Allocate(const std::size_t Size, const std::size_t Alignment)
+	{
+		AllocationCount++;
+		if (!IsPooled(Size, Alignment))
+		{
+			HeapBytes += Size;
+			return ::operator new(Size, std::align_val_t(Alignment));
+		}
+
+		const std::size_t Index = GetPoolIndex(Size);
+		const std::size_t BlockSize = (Index + 1) * Granularity;
+		UsedBytes += BlockSize;
+
+		if (cbFreeBlock* Block = FreeLists[Index])
+		{
+			FreeLists[Index] = Block->Next;
+			return Block;
+		}
+
+		if (Remaining < BlockSize)
+		{
+			/* The tail of the previous chunk is given to its pool. */
+			if (Remaining >= Granularity)
+			{
+				cbFreeBlock* Tail = reinterpret_cast<cbFreeBlock*>(Cursor);
+				Tail->Next = FreeLists[GetPoolIndex(Remaining)];
+				FreeLists[GetPoolIndex(Remaining)] = Tail;
+			}
+
+			Cursor = static_cast<unsigned char*>(::operator new(ChunkBytes));
+			Remaining = ChunkBytes;
+			Chunks.push_back(Cursor);
+		}
+
+		void* Block = Cursor;
+		Cursor += BlockSize;
+		Remaining -= BlockSize;
+		return Block;
+	}
+
+	void cbArena::Deallocate(void* Ptr, const std::size_t Size, const std::size_t Alignment)
+	{
+		if (!Ptr)
+			return;
+
+		AllocationCount--;
+		if (!IsPooled(Size, Alignment))
+		{
+			HeapBytes -= Size;
+			::operator delete(Ptr, std::align_val_t(Alignment));
+			return;
+		}
+
+		const std::size_t Index = GetPoolIndex(Size);
+		UsedBytes -= (Index + 1) * Granularity;
+
+		cbFreeBlock* Block = static_cast<cbFreeBlock*>(Ptr);
+		Block->Next = FreeLists[Index];
+		FreeLists[Index] = Block;
+	}
+
+	void cbArena::Bind(cbArena* Arena)
+	{
+		BoundArena = Arena;
+	}
+
+	cbArena* cbArena::GetBound()
+	{
+		return BoundArena;
+	}
+}
@@ -47,6 +47,7 @@ namespace cbgui
 		, Transform(cbTransform(cbDimension(100.0f, 40.0f)))
 		, BorderThickness(cbMargin(5))
 		, Slot(nullptr)
+		, VertexColorStyle(this)
 	{}
 
 	cbBorder::cbBorder(const cbBorder& Widget)
@@ -54,7 +55,7 @@ namespace cbgui
 		, Transform(Widget.Transform)
 		, BorderThickness(Widget.BorderThickness)
 		, Slot(nullptr)
-		, VertexColorStyle(Widget.VertexColorStyle)
+		, VertexColorStyle(this, Widget.VertexColorStyle)
 	{
 		if (Widget.Slot)
 		{
@@ -293,18 +294,12 @@ namespace cbgui
 			for (std::size_t i = 0; i < 8; i++)
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
-			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor(),
+			return cbGeometryFactory::GetAlignedVertexData(Data, TC, *GetVertexColor(true),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.Color : VertexColorStyle.GetDisabledColor();
-		auto Alpha = GetVertexColorAlpha();
-		if (Alpha.has_value())
-			Color.A = *Alpha;
-
 		return cbGeometryFactory::GetAlignedVertexData(cbGeometryFactory::GenerateBorderVertices(Transform.GetDimension(), BorderThickness), 
-			   cbGeometryFactory::GenerateBorderTextureCoordinate(), Color,
+			   cbGeometryFactory::GenerateBorderTextureCoordinate(), *GetVertexColor(),
 			   GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 	}
 
@@ -322,10 +317,28 @@ namespace cbgui
 		return cbGeometryDrawData("Border", 0, 40, 48, 48);
 	};
 
+	std::optional<cbColor> cbBorder::GetVertexColor(const bool LineGeometry) const
+	{
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor() : VertexColorStyle->GetDisabledColor();
+		if (LineGeometry)
+			return Color;
+
+		auto Alpha = GetVertexColorAlpha();
+		if (Alpha.has_value())
+			Color.A = *Alpha;
+		return Color;
+	}
+
 	void cbBorder::SetVertexColorStyle(const cbVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
-		NotifyCanvas_WidgetUpdated();
+		VertexColorStyle.Set(style);
+		NotifyCanvas_ColorUpdated();
+	}
+
+	void cbBorder::SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle)
+	{
+		VertexColorStyle.Bind(Handle);
+		NotifyCanvas_ColorUpdated();
 	}
 
 	void cbBorder::OnSlotVisibilityChanged(cbSlot* Slot)
@@ -39,13 +39,14 @@ namespace cbgui
 		, fOnReleased(nullptr)
 		, fOnHovered(nullptr)
 		, fOnUnhovered(nullptr)
+		, VertexColorStyle(this)
 	{}
 
 	cbButton::cbButton(const cbButton& Other)
 		: Super(Other)
 		, Transform(Other.Transform)
 		, ButtonState(Other.ButtonState)
-		, VertexColorStyle(Other.VertexColorStyle)
+		, VertexColorStyle(this, Other.VertexColorStyle)
 		, fOnClicked(nullptr)
 		, fOnPressed(nullptr)
 		, fOnReleased(nullptr)
@@ -85,6 +86,18 @@ namespace cbgui
 		return HasOwner() ? GetOwner()->GetRotation() + Transform.GetRotation() : Transform.GetRotation();
 	}
 
+	std::optional<cbColor> cbButton::GetVertexColor(const bool LineGeometry) const
+	{
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor(ButtonState) : VertexColorStyle->GetDisabledColor();
+		if (LineGeometry)
+			return Color;
+
+		auto Alpha = GetVertexColorAlpha();
+		if (Alpha.has_value())
+			Color.A = *Alpha;
+		return Color;
+	}
+
 	std::vector<cbGeometryVertexData> cbButton::GetVertexData(const bool LineGeometry) const
 	{
 		float Rotation = GetRotation();
@@ -103,18 +116,12 @@ namespace cbgui
 			for (std::size_t i = 0; i < 4; i++)
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
-			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor(ButtonState) : VertexColorStyle.GetDisabledColor(),
+			return cbGeometryFactory::GetAlignedVertexData(Data, TC, *GetVertexColor(true),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor(ButtonState) : VertexColorStyle.GetDisabledColor();
-		auto Alpha = GetVertexColorAlpha();
-		if (Alpha.has_value())
-			Color.A = *Alpha;
-
 		return cbGeometryFactory::GetAlignedVertexData(cbGeometryFactory::Create4DPlaneVerticesFromRect(GetDimension()),
-			   cbGeometryFactory::GeneratePlaneTextureCoordinate(), Color,
+			   cbGeometryFactory::GeneratePlaneTextureCoordinate(), *GetVertexColor(),
 			   GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 	}
 
@@ -134,14 +141,20 @@ namespace cbgui
 
 	void cbButton::SetVertexColorStyle(const cbButtonVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
-		NotifyCanvas_WidgetUpdated();
+		VertexColorStyle.Set(style);
+		NotifyCanvas_ColorUpdated();
 	}
 
 	void cbButton::SetVertexColorStyle(const eButtonState State, const cbColor& Color)
 	{
-		VertexColorStyle.SetColor(State, Color);
-		NotifyCanvas_WidgetUpdated();
+		VertexColorStyle.Edit([&](cbButtonVertexColorStyle& Style) { Style.SetColor(State, Color); });
+		NotifyCanvas_ColorUpdated();
+	}
+
+	void cbButton::SetVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle)
+	{
+		VertexColorStyle.Bind(Handle);
+		NotifyCanvas_ColorUpdated();
 	}
 
 	eButtonState cbButton::GetState() const
@@ -275,7 +288,7 @@ namespace cbgui
 			return;
 
 		ButtonState = ButtonStatus;
-		NotifyCanvas_WidgetUpdated();
+		NotifyCanvas_ColorUpdated();
 	}
 
 	bool cbButton::OnMouseEnter(const cbMouseInput& Mouse)
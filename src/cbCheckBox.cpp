@@ -37,6 +37,7 @@ namespace cbgui
 		, CheckBoxState(eCheckBoxState::Unchecked)
 		, bIsPressed(false)
 		, bIsHovered(false)
+		, VertexColorStyle(this)
 	{}
 
 	cbCheckBox::cbCheckBox(const cbCheckBox& Other)
@@ -46,7 +47,7 @@ namespace cbgui
 		, CheckBoxState(Other.CheckBoxState)
 		, bIsPressed(Other.bIsPressed)
 		, bIsHovered(Other.bIsHovered)
-		, VertexColorStyle(Other.VertexColorStyle)
+		, VertexColorStyle(this, Other.VertexColorStyle)
 	{}
 
 	cbCheckBox::~cbCheckBox()
@@ -204,7 +205,7 @@ namespace cbgui
 
 		CheckBoxState = InCheckBoxState;
 
-		NotifyCanvas_WidgetUpdated();
+		NotifyCanvas_ColorUpdated();
 
 		if (fOnCheckStateChanged)
 		{
@@ -604,6 +605,18 @@ namespace cbgui
 		}
 	}
 
+	std::optional<cbColor> cbCheckBox::GetVertexColor(const bool LineGeometry) const
+	{
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor(CheckBoxState) : VertexColorStyle->GetDisabledColor(CheckBoxState);
+		if (LineGeometry)
+			return Color;
+
+		auto Alpha = GetVertexColorAlpha();
+		if (Alpha.has_value())
+			Color.A = *Alpha;
+		return Color;
+	}
+
 	std::vector<cbGeometryVertexData> cbCheckBox::GetVertexData(const bool LineGeometry) const
 	{
 		float Rotation = GetRotation();
@@ -622,18 +635,12 @@ namespace cbgui
 			for (std::size_t i = 0; i < 4; i++)
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
-			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor(CheckBoxState) : VertexColorStyle.GetDisabledColor(CheckBoxState),
+			return cbGeometryFactory::GetAlignedVertexData(Data, TC, *GetVertexColor(true),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor(CheckBoxState) : VertexColorStyle.GetDisabledColor(CheckBoxState);
-		auto Alpha = GetVertexColorAlpha();
-		if (Alpha.has_value())
-			Color.A = *Alpha;
-
 		return cbGeometryFactory::GetAlignedVertexData(cbGeometryFactory::Create4DPlaneVerticesFromRect(GetDimension()),
-			cbGeometryFactory::GeneratePlaneTextureCoordinate(), Color,
+			cbGeometryFactory::GeneratePlaneTextureCoordinate(), *GetVertexColor(),
 			GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 	}
 
@@ -653,13 +660,19 @@ namespace cbgui
 
 	void cbCheckBox::SetVertexColorStyle(const cbCheckBoxVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
-		NotifyCanvas_WidgetUpdated();
+		VertexColorStyle.Set(style);
+		NotifyCanvas_ColorUpdated();
 	}
 
 	void cbgui::cbCheckBox::SetVertexColorStyle(const eCheckBoxState State, const cbColor& Color)
 	{
-		VertexColorStyle.SetColor(State, Color);
-		NotifyCanvas_WidgetUpdated();
+		VertexColorStyle.Edit([&](cbCheckBoxVertexColorStyle& Style) { Style.SetColor(State, Color); });
+		NotifyCanvas_ColorUpdated();
+	}
+
+	void cbCheckBox::SetVertexColorStyle(const cbStyleHandle<cbCheckBoxVertexColorStyle>& Handle)
+	{
+		VertexColorStyle.Bind(Handle);
+		NotifyCanvas_ColorUpdated();
 	}
 }
@@ -33,8 +33,12 @@
 #include <fstream>
 #include <algorithm>
 #include <map>
+#include <cstring>
+#include <filesystem>
 
 #include "cbText.h"
+#include "cbTextLayoutCache.h"
+#include "cbUtf8.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -96,6 +100,19 @@ namespace cbgui
 				return nullptr;
 		}
 
+		cbFORCEINLINE void Remove(const std::size_t& Size)
+		{
+			const auto It = Glyphs.find(Size);
+			if (It == Glyphs.end())
+				return;
+
+			delete It->second;
+			Glyphs.erase(It);
+		}
+
+		cbFORCEINLINE constexpr const std::map<std::size_t, cbGlyph*>& GetGlyphs() const { return Glyphs; }
+		cbFORCEINLINE bool IsEmpty() const { return Glyphs.empty(); }
+
 		cbFORCEINLINE const std::optional<cbBounds> GenerateTextureCoordinate(const std::size_t& Size, const cbVector& PenLocation) const
 		{
 			if (Glyphs.find(Size) == Glyphs.end())
@@ -167,6 +184,17 @@ namespace cbgui
 				}
 			}
 
+			cbFORCEINLINE void Remove(const std::size_t& Size)
+			{
+				const auto It = FontTextureGlyphData.find(Size);
+				if (It == FontTextureGlyphData.end())
+					return;
+
+				delete It->second;
+				FontTextureGlyphData.erase(It);
+			}
+
+			cbFORCEINLINE bool IsEmpty() const { return FontTextureGlyphData.empty(); }
 		};
 		struct cbTextureData
 		{
@@ -217,14 +245,30 @@ namespace cbgui
 					TextureData.insert({ Ch, new cbSizedTextureData(Size, pTextureData) });
 				}
 			}
+
+			cbFORCEINLINE void Remove(const char32_t& Ch, const std::size_t& Size)
+			{
+				const auto It = TextureData.find(Ch);
+				if (It == TextureData.end() || !It->second)
+					return;
+
+				It->second->Remove(Size);
+				if (It->second->IsEmpty())
+				{
+					delete It->second;
+					TextureData.erase(It);
+				}
+			}
 		};
 
 	protected:
-		std::map<eFontType, cbTextureData*> TextureMetaData;
+		/* Keyed by the font face id. */
+		std::map<std::size_t, cbTextureData*> TextureMetaData;
 
 	public:
 		cbFORCEINLINE cbFontTextureMetaData(const cbFontDesc& FontDesc)
 			: LastPenPosition(FontDesc.StartPosition)
+			, StartPosition(FontDesc.StartPosition)
 			, Dimension(cbDimension((float)FontDesc.AtlasWidth, (float)FontDesc.AtlasHeight))
 			, SpaceBetweenChars(FontDesc.SpaceBetweenChars)
 			, LastlineMaximumHeight(0.0f)
@@ -240,52 +284,127 @@ namespace cbgui
 		}
 
 		cbVector LastPenPosition;
+		cbVector StartPosition;
 		cbVector SpaceBetweenChars;
 		cbDimension Dimension;
 		float LastlineMaximumHeight;
 
-		cbFORCEINLINE constexpr const std::map<eFontType, cbTextureData*>& GetTextureMetaData() const
+		cbFORCEINLINE constexpr const std::map<std::size_t, cbTextureData*>& GetTextureMetaData() const
 		{
 			return TextureMetaData;
 		}
 
-		cbFORCEINLINE const cbFontTextureGlyphData* Get(const eFontType& FontType, const char32_t& ch, const std::size_t& Size) const
+		cbFORCEINLINE const cbFontTextureGlyphData* Get(const std::size_t FaceId, const char32_t& ch, const std::size_t& Size) const
 		{
-			if (TextureMetaData.find(FontType) != TextureMetaData.end())
+			if (TextureMetaData.find(FaceId) != TextureMetaData.end())
 			{
-				return TextureMetaData.at(FontType)->Get(ch, Size);
+				return TextureMetaData.at(FaceId)->Get(ch, Size);
 			}
 			return nullptr;
 		}
 
-		cbFORCEINLINE cbFontTextureGlyphData* UpdateMetaData(const eFontType& FontType, const char32_t& ch, const std::size_t& FontSize, const FT_GlyphSlot& glyph, bool UseVerticalAligment)
+		cbFORCEINLINE float GetUsage() const
 		{
-			const FT_Bitmap& bmp = glyph->bitmap;
+			return std::min(LastlineMaximumHeight / Dimension.GetHeight(), 1.0f);
+		}
 
-			if (((glyph->metrics.height >> 6) + LastPenPosition.Y) > LastlineMaximumHeight)
+		/* Finds the pen location of the next glyph, moves to the next line if the current line is full. */
+		cbFORCEINLINE bool AllocatePen(const std::size_t Width, const std::size_t Height, cbVector& outPenLocation)
+		{
+			if ((Height + LastPenPosition.Y) > LastlineMaximumHeight)
 			{
-				LastlineMaximumHeight = (glyph->metrics.height >> 6) + LastPenPosition.Y;
+				LastlineMaximumHeight = Height + LastPenPosition.Y;
 			}
 
-			if (LastlineMaximumHeight >= Dimension.GetHeight() || (LastlineMaximumHeight + (glyph->metrics.height >> 6)) >= Dimension.GetWidth())
+			if (LastlineMaximumHeight >= Dimension.GetHeight() || (LastlineMaximumHeight + Height) >= Dimension.GetWidth())
 			{
-				return nullptr;
+				return false;
 			}
 
-			if (LastPenPosition.X + (bmp.width) >= Dimension.GetWidth())
+			if (LastPenPosition.X + Width >= Dimension.GetWidth())
 			{
 				LastPenPosition.X = 0;
 				LastPenPosition.Y = LastlineMaximumHeight + (std::size_t)SpaceBetweenChars.Y;
 			}
 
-			cbFontTextureGlyphData* pTextureData = new cbFontTextureGlyphData(bmp.width, bmp.rows, bmp.pitch, LastPenPosition, false, 0);
+			outPenLocation = LastPenPosition;
+			LastPenPosition.X += Width + (std::size_t)SpaceBetweenChars.X;
+
+			return true;
+		}
+
+		cbFORCEINLINE void Remove(const std::size_t FaceId, const char32_t& ch, const std::size_t& Size)
+		{
+			const auto It = TextureMetaData.find(FaceId);
+			if (It != TextureMetaData.end() && It->second)
+				It->second->Remove(ch, Size);
+		}
+
+		/*
+		* Packs the remaining glyphs from the start position, the tallest first.
+		* The pixels are kept by the glyphs, only the pen locations change.
+		* Returns false and keeps the previous layout if the glyphs do not fit in the new order.
+		*/
+		bool Repack()
+		{
+			std::vector<cbFontTextureGlyphData*> Glyphs;
+			for (const auto& pTextureMetaData : TextureMetaData)
+			{
+				if (!pTextureMetaData.second)
+					continue;
+
+				for (const auto& pTextureData : pTextureMetaData.second->GetSizedTextureGlypheData())
+				{
+					for (const auto& mTextureData : pTextureData.second->GetTextureGlyphData())
+						Glyphs.push_back(mTextureData.second);
+				}
+			}
+
+			std::stable_sort(Glyphs.begin(), Glyphs.end(), [](const cbFontTextureGlyphData* A, const cbFontTextureGlyphData* B)
+			{
+				return A->Height > B->Height;
+			});
+
+			const cbVector PrevPenPosition = LastPenPosition;
+			const float PrevLineMaximumHeight = LastlineMaximumHeight;
+
+			LastPenPosition = StartPosition;
+			LastlineMaximumHeight = 0.0f;
+
+			std::vector<cbVector> PenLocations(Glyphs.size());
+			for (std::size_t i = 0; i < Glyphs.size(); i++)
+			{
+				if (!AllocatePen(Glyphs[i]->Width, Glyphs[i]->Height, PenLocations[i]))
+				{
+					LastPenPosition = PrevPenPosition;
+					LastlineMaximumHeight = PrevLineMaximumHeight;
+					return false;
+				}
+			}
+
+			for (std::size_t i = 0; i < Glyphs.size(); i++)
+				Glyphs[i]->PenLocation = PenLocations[i];
+			return true;
+		}
+
+		cbFORCEINLINE cbFontTextureGlyphData* UpdateMetaData(const std::size_t FaceId, const char32_t& ch, const std::size_t& FontSize, const FT_GlyphSlot& glyph, bool UseVerticalAligment)
+		{
+			const FT_Bitmap& bmp = glyph->bitmap;
+
+			cbVector PenLocation;
+			if (!AllocatePen(bmp.width, glyph->metrics.height >> 6, PenLocation))
+			{
+				return nullptr;
+			}
+
+			cbFontTextureGlyphData* pTextureData = new cbFontTextureGlyphData(bmp.width, bmp.rows, bmp.pitch, PenLocation, false, 0);
 
 			for (std::size_t row = 0; row < bmp.rows; ++row)
 			{
 				for (std::size_t col = 0; col < bmp.width; ++col)
 				{
-					std::size_t x = (std::size_t)LastPenPosition.X + col;
-					std::size_t y = (std::size_t)LastPenPosition.Y + row;
+					std::size_t x = (std::size_t)PenLocation.X + col;
+					std::size_t y = (std::size_t)PenLocation.Y + row;
 					if (UseVerticalAligment && y > (glyph->bitmap_top))
 					{
 						y -= (glyph->bitmap_top);
@@ -302,241 +421,326 @@ namespace cbgui
 					pTextureData->VerticalAligment *= (-1);
 			}
 
-			if (TextureMetaData.find(FontType) != TextureMetaData.end())
+			if (TextureMetaData.find(FaceId) != TextureMetaData.end())
 			{
-				if (!TextureMetaData.at(FontType))
-					TextureMetaData.insert({ FontType, new cbTextureData(ch, FontSize, pTextureData) });
+				if (!TextureMetaData.at(FaceId))
+					TextureMetaData.insert({ FaceId, new cbTextureData(ch, FontSize, pTextureData) });
 				else
-					TextureMetaData[FontType]->Insert(ch, FontSize, pTextureData);
+					TextureMetaData[FaceId]->Insert(ch, FontSize, pTextureData);
 			}
 			else
 			{
-				TextureMetaData.insert({ FontType, new cbTextureData(ch, FontSize, pTextureData) });
+				TextureMetaData.insert({ FaceId, new cbTextureData(ch, FontSize, pTextureData) });
 			}
 
-			LastPenPosition.X += (bmp.width) + (std::size_t)SpaceBetweenChars.X;
-
 			return pTextureData;
 		}
 	};
 
-	class cbFreeTypeFontFamily::FreeTypeFont final
+	/* Font face and its glyphs, shared by the font families that load the same font. */
+	struct FreeTypeFontFace
 	{
 	public:
-		struct FreeTypeFontFace
+		FreeTypeFontFace(const cbFontDesc& InDesc, const FT_Library& FreeTypeLibrary, const std::string& Path, const std::size_t InId)
+			: Id(InId)
+			, Desc(InDesc)
 		{
-		public:
-			FreeTypeFontFace(FreeTypeFont* pOwner, const FT_Library& FreeTypeLibrary, const std::string& Path, const eFontType& pType)
-				: Type(pType)
-				, Owner(pOwner)
-			{
-				FT_New_Face(FreeTypeLibrary, Path.c_str(), 0, &FontFace);
-				FT_Select_Charmap(FontFace, FT_ENCODING_UNICODE);
-			}
-			FreeTypeFontFace(FreeTypeFont* pOwner, const FT_Library& FreeTypeLibrary, unsigned char* pFont, FT_Long file_size, FT_Long face_index, const eFontType& pType)
-				: Type(pType)
-				, Owner(pOwner)
-			{
-				auto Error = FT_New_Memory_Face(FreeTypeLibrary, pFont, file_size, face_index, &FontFace);
-				FT_Select_Charmap(FontFace, FT_ENCODING_UNICODE);
-			}
-			~FreeTypeFontFace()
+			FT_New_Face(FreeTypeLibrary, Path.c_str(), 0, &FontFace);
+			FT_Select_Charmap(FontFace, FT_ENCODING_UNICODE);
+		}
+		FreeTypeFontFace(const cbFontDesc& InDesc, const FT_Library& FreeTypeLibrary, std::vector<unsigned char>&& InData, FT_Long face_index, const std::size_t InId)
+			: Data(std::move(InData))
+			, Id(InId)
+			, Desc(InDesc)
+		{
+			auto Error = FT_New_Memory_Face(FreeTypeLibrary, Data.data(), (FT_Long)Data.size(), face_index, &FontFace);
+			FT_Select_Charmap(FontFace, FT_ENCODING_UNICODE);
+		}
+		~FreeTypeFontFace()
+		{
+			FT_Done_Face(FontFace);
+			for (auto& Glyph : Glyphs)
 			{
-				Owner = nullptr;
-				FT_Done_Face(FontFace);
-				for (auto& Glyph : Glyphs)
-				{
-					delete Glyph.second;
-					Glyph.second = nullptr;
-				}
-				Glyphs.clear();
+				delete Glyph.second;
+				Glyph.second = nullptr;
 			}
+			Glyphs.clear();
+		}
+
+		/* Creates the first characters at the given size, existing characters are skipped. Returns the created character count. */
+		cbFORCEINLINE std::size_t LoadGlyphs(const std::size_t FontSize, const std::size_t Numchars, cbFontTextureMetaData* pTextureMetaData)
+		{
+			FT_Set_Char_Size(
+				FontFace,                  // handle to face object
+				0,                         // char_width in 1/64th of points
+				FONTSIZE(FontSize),        // char_height in 1/64th of points
+				(FT_UInt)Desc.DPI,         // horizontal device resolution
+				(FT_UInt)Desc.DPI);        // vertical device resolution
+
+			FT_Int32 flags = NULL;
+			if (FT_HAS_COLOR(FontFace))
+				flags |= FT_LOAD_COLOR;
+			else
+				flags |= FT_LOAD_DEFAULT;
 
-			cbFORCEINLINE void LoadGlyphs(cbFontTextureMetaData* pTextureMetaData)
+			std::size_t Count = 0;
+			for (int i = 32; i < Numchars + 32; ++i)
 			{
-				const cbFontDesc& Desc = Owner->GetDesc();
+				if (IsCharExist(FontSize, i))
+					continue;
 
-				FT_Set_Char_Size(
-					FontFace,                  // handle to face object
-					0,                         // char_width in 1/64th of points
-					FONTSIZE(Desc.FontSize),   // char_height in 1/64th of points
-					(FT_UInt)Desc.DPI,         // horizontal device resolution
-					(FT_UInt)Desc.DPI);        // vertical device resolution
+				FT_Load_Char(FontFace, i, flags | FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_LIGHT);
+				const FT_GlyphSlot& glyph = FontFace->glyph;
 
-				FT_Int32 flags = NULL;
-				if (FT_HAS_COLOR(FontFace))
-					flags |= FT_LOAD_COLOR;
+				if (Desc.SDF)
+					FT_Render_Glyph(glyph, FT_RENDER_MODE_SDF);
 				else
-					flags |= FT_LOAD_DEFAULT;
+					FT_Render_Glyph(glyph, FT_RENDER_MODE_NORMAL);
 
-				for (int i = 32; i < Desc.Numchars + 32; ++i)
+				if (const auto& MetaData = pTextureMetaData->UpdateMetaData(Id, i, FontSize, glyph, Desc.UseVerticalAligment))
 				{
-					FT_Load_Char(FontFace, i, flags | FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_LIGHT);
-					const FT_GlyphSlot& glyph = FontFace->glyph;
-
-					if (Desc.SDF)
-						FT_Render_Glyph(glyph, FT_RENDER_MODE_SDF);
-					else
-						FT_Render_Glyph(glyph, FT_RENDER_MODE_NORMAL);
-
-					if (const auto& MetaData = pTextureMetaData->UpdateMetaData(Type, i, Desc.FontSize, glyph, Desc.UseVerticalAligment))
-					{
-						cbGlyph* Glyph = new cbGlyph(glyph->metrics.width >> 6, glyph->metrics.height >> 6, glyph->metrics.horiBearingX >> 6,
-							glyph->metrics.horiBearingY >> 6, glyph->metrics.horiAdvance >> 6, glyph->bitmap_left, glyph->bitmap_top, MetaData);
+					cbGlyph* Glyph = new cbGlyph(glyph->metrics.width >> 6, glyph->metrics.height >> 6, glyph->metrics.horiBearingX >> 6,
+						glyph->metrics.horiBearingY >> 6, glyph->metrics.horiAdvance >> 6, glyph->bitmap_left, glyph->bitmap_top, MetaData);
 
-						AddGlyph(i, Desc.FontSize, Glyph);
-					}
+					AddGlyph(i, FontSize, Glyph);
+					Count++;
 				}
 			}
+			return Count;
+		}
+
+		cbFORCEINLINE const cbGlyph* CreateChar(const std::size_t& FontSize, const char32_t& character, cbFontTextureMetaData* pTextureMetaData)
+		{
+			if (IsCharExist(FontSize, character) && character != '\n')
+				return nullptr;
+
+			FT_Set_Char_Size(
+				FontFace,               // handle to face object
+				0,                      // char_width in 1/64th of points
+				FONTSIZE(FontSize),     // char_height in 1/64th of points
+				(FT_UInt)Desc.DPI,      // horizontal device resolution
+				(FT_UInt)Desc.DPI);     // vertical device resolution
+
+			FT_Int32 flags = NULL;
+			if (FT_HAS_COLOR(FontFace))
+				flags |= FT_LOAD_COLOR;
+			else
+				flags |= FT_LOAD_DEFAULT;
 
-			cbFORCEINLINE const cbGlyph* CreateChar(const std::size_t& FontSize, const char32_t& character, cbFontTextureMetaData* pTextureMetaData)
+			auto Error = FT_Load_Char(FontFace, character, flags | FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_LIGHT);
+			if (Error)
+				return nullptr;
+
+			const FT_GlyphSlot& glyph = FontFace->glyph;
+
+			if (Desc.SDF)
+				Error = FT_Render_Glyph(glyph, FT_RENDER_MODE_SDF);
+			else
+				Error = FT_Render_Glyph(glyph, FT_RENDER_MODE_NORMAL);
+			if (Error)
+				return nullptr;
+
+			if (const auto& MetaData = pTextureMetaData->UpdateMetaData(Id, character, FontSize, glyph, Desc.UseVerticalAligment))
 			{
-				if (IsCharExist(FontSize, character) && character != '\n')
-					return nullptr;
+				cbGlyph* Glyph = new cbGlyph(glyph->metrics.width >> 6, glyph->metrics.height >> 6, glyph->metrics.horiBearingX >> 6,
+					glyph->metrics.horiBearingY >> 6, glyph->metrics.horiAdvance >> 6, glyph->bitmap_left, glyph->bitmap_top, MetaData);
 
-				const cbFontDesc& Desc = Owner->GetDesc();
+				AddGlyph(character, FontSize, Glyph);
+				return Glyph;
+			}
 
-				FT_Set_Char_Size(
-					FontFace,               // handle to face object
-					0,                      // char_width in 1/64th of points
-					FONTSIZE(FontSize),     // char_height in 1/64th of points
-					(FT_UInt)Desc.DPI,      // horizontal device resolution
-					(FT_UInt)Desc.DPI);     // vertical device resolution
+			return nullptr;
+		}
 
-				FT_Int32 flags = NULL;
-				if (FT_HAS_COLOR(FontFace))
-					flags |= FT_LOAD_COLOR;
-				else
-					flags |= FT_LOAD_DEFAULT;
+		/* Loads the outline metrics only, the glyph is not rendered or added to the atlas. */
+		std::optional<cbGlyphMetrics> GetGlyphMetrics(const std::size_t& FontSize, const char32_t& character)
+		{
+			if (const cbGlyph* Glyph = GetGlyph(character, FontSize))
+				return cbGlyphMetrics(*Glyph);
 
-				auto Error = FT_Load_Char(FontFace, character, flags | FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_LIGHT);
-				if (Error)
-					return nullptr;
+			const std::uint64_t Key = ((std::uint64_t)FontSize << 32) | (std::uint64_t)character;
+			const auto It = Metrics.find(Key);
+			if (It != Metrics.end())
+				return It->second;
 
-				const FT_GlyphSlot& glyph = FontFace->glyph;
+			FT_Set_Char_Size(
+				FontFace,               // handle to face object
+				0,                      // char_width in 1/64th of points
+				FONTSIZE(FontSize),     // char_height in 1/64th of points
+				(FT_UInt)Desc.DPI,      // horizontal device resolution
+				(FT_UInt)Desc.DPI);     // vertical device resolution
 
-				if (Desc.SDF)
-					Error = FT_Render_Glyph(glyph, FT_RENDER_MODE_SDF);
-				else
-					Error = FT_Render_Glyph(glyph, FT_RENDER_MODE_NORMAL);
-				if (Error)
-					return nullptr;
+			/* Same flags as CreateChar, the metrics must match the created glyph. */
+			FT_Int32 flags = NULL;
+			if (FT_HAS_COLOR(FontFace))
+				flags |= FT_LOAD_COLOR;
+			else
+				flags |= FT_LOAD_DEFAULT;
 
-				if (const auto& MetaData = pTextureMetaData->UpdateMetaData(Type, character, FontSize, glyph, Desc.UseVerticalAligment))
-				{
-					cbGlyph* Glyph = new cbGlyph(glyph->metrics.width >> 6, glyph->metrics.height >> 6, glyph->metrics.horiBearingX >> 6,
-						glyph->metrics.horiBearingY >> 6, glyph->metrics.horiAdvance >> 6, glyph->bitmap_left, glyph->bitmap_top, MetaData);
+			if (FT_Load_Char(FontFace, character, flags | FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_LIGHT))
+				return std::nullopt;
 
-					AddGlyph(character, FontSize, Glyph);
-					return Glyph;
-				}
+			const FT_GlyphSlot& glyph = FontFace->glyph;
+			const cbGlyphMetrics GlyphMetrics(glyph->metrics.width >> 6, glyph->metrics.height >> 6, glyph->metrics.horiBearingX >> 6,
+				glyph->metrics.horiBearingY >> 6, glyph->metrics.horiAdvance >> 6);
 
-				return nullptr;
-			}
+			Metrics.insert({ Key, GlyphMetrics });
+			return GlyphMetrics;
+		}
 
-			inline bool IsKerningSupported() const { return FT_HAS_KERNING(FontFace); }
-			inline int GetAscender() const { return FontFace->ascender >> 6; }
-			inline int GetDescender() const { return FontFace->descender >> 6; }
+		inline bool IsKerningSupported() const { return FT_HAS_KERNING(FontFace); }
+		inline int GetAscender() const { return FontFace->ascender >> 6; }
+		inline int GetDescender() const { return FontFace->descender >> 6; }
 
-			inline std::int32_t GetKerning(const int& ch1, const int& ch2, const std::size_t& Size) const
-			{
-				const cbFontDesc& Desc = Owner->GetDesc();
+		inline std::int32_t GetKerning(const int& ch1, const int& ch2, const std::size_t& Size) const
+		{
+			FT_Set_Char_Size(
+				FontFace,                  // handle to face object
+				0,                         // char_width in 1/64th of points
+				FONTSIZE(Size),            // char_height in 1/64th of points
+				(FT_UInt)Desc.DPI,                  // horizontal device resolution
+				(FT_UInt)Desc.DPI);                 // vertical device resolution
 
-				FT_Set_Char_Size(
-					FontFace,                  // handle to face object
-					0,                         // char_width in 1/64th of points
-					FONTSIZE(Size),            // char_height in 1/64th of points
-					(FT_UInt)Desc.DPI,                  // horizontal device resolution
-					(FT_UInt)Desc.DPI);                 // vertical device resolution
+			FT_Vector delta;
+			FT_Get_Kerning(FontFace, FT_Get_Char_Index(FontFace, ch1), FT_Get_Char_Index(FontFace, ch2), FT_Kerning_Mode_::FT_KERNING_DEFAULT, &delta);
+			return std::int32_t(delta.x >> 6);
+		}
 
-				FT_Vector delta;
-				FT_Get_Kerning(FontFace, FT_Get_Char_Index(FontFace, ch1), FT_Get_Char_Index(FontFace, ch2), FT_Kerning_Mode_::FT_KERNING_DEFAULT, &delta);
-				return std::int32_t(delta.x >> 6);
-			}
+		std::size_t GetLineDistance(const std::size_t& Size)
+		{
+			FT_Set_Char_Size(
+				FontFace,                  // handle to face object
+				0,                         // char_width in 1/64th of points
+				FONTSIZE(Size),            // char_height in 1/64th of points
+				(FT_UInt)Desc.DPI,                  // horizontal device resolution
+				(FT_UInt)Desc.DPI);
+
+			return FontFace->size->metrics.height >> 6;
+		}
 
-			std::size_t GetLineDistance(const std::size_t& Size)
+		bool IsCharExist(const std::size_t& Size, const char32_t& Character) const
+		{
+			if (Glyphs.find(Character) != Glyphs.end())
 			{
-				const cbFontDesc& Desc = Owner->GetDesc();
+				if (Glyphs.at(Character)->Get(Size))
+					return true;
+			}
 
-				FT_Set_Char_Size(
-					FontFace,                  // handle to face object
-					0,                         // char_width in 1/64th of points
-					FONTSIZE(Size),            // char_height in 1/64th of points
-					(FT_UInt)Desc.DPI,                  // horizontal device resolution
-					(FT_UInt)Desc.DPI);
+			return false;
+		}
 
-				return FontFace->size->metrics.height >> 6;
+		inline void AddGlyph(const char32_t& ch, const std::size_t& Size, cbGlyph* Glyph)
+		{
+			if (Glyphs.find(ch) != Glyphs.end())
+			{
+				if (!Glyphs.at(ch))
+					Glyphs.insert({ ch, new SizedGlyphData(Size, Glyph) });
+				else
+					Glyphs.at(ch)->Insert(Size, Glyph);
 			}
-
-			bool IsCharExist(const std::size_t& Size, const char32_t& Character) const
+			else
 			{
-				if (Glyphs.find(Character) != Glyphs.end())
-				{
-					if (Glyphs.at(Character)->Get(Size))
-						return true;
-				}
+				Glyphs.insert({ ch, new SizedGlyphData(Size, Glyph) });
+			}
+		}
+		inline const cbGlyph* GetGlyph(const char32_t& ch, const std::size_t& Size) const
+		{
+			if (Glyphs.find(ch) != Glyphs.end())
+			{
+				return Glyphs.at(ch)->Get(Size);
+			}
+			return nullptr;
+		}
 
-				return false;
+		const std::optional<cbBounds> GenerateTextureCoordinate(const char32_t& Ch, const std::size_t& Size, const cbVector& PenLocation) const
+		{
+			if (Glyphs.find(Ch) != Glyphs.end())
+			{
+				return Glyphs.at(Ch)->GenerateTextureCoordinate(Size, PenLocation);
 			}
+			return std::nullopt;
+		}
 
-			inline void AddGlyph(const char32_t& ch, const std::size_t& Size, cbGlyph* Glyph)
+		/* Removes the glyphs that are not used since the given frame, returns the removed glyph count. */
+		std::size_t EvictGlyphs(const std::uint64_t OldestFrame, cbFontTextureMetaData* pTextureMetaData)
+		{
+			std::size_t Count = 0;
+			for (auto It = Glyphs.begin(); It != Glyphs.end();)
 			{
-				if (Glyphs.find(ch) != Glyphs.end())
+				SizedGlyphData* SizedGlyphs = It->second;
+
+				std::vector<std::size_t> Sizes;
+				for (const auto& Glyph : SizedGlyphs->GetGlyphs())
 				{
-					if (!Glyphs.at(ch))
-						Glyphs.insert({ ch, new SizedGlyphData(Size, Glyph) });
-					else
-						Glyphs.at(ch)->Insert(Size, Glyph);
+					if (Glyph.second->FontTextureGlyphData && Glyph.second->FontTextureGlyphData->LastUsedFrame < OldestFrame)
+						Sizes.push_back(Glyph.first);
 				}
-				else
+
+				for (const auto& Size : Sizes)
 				{
-					Glyphs.insert({ ch, new SizedGlyphData(Size, Glyph) });
+					pTextureMetaData->Remove(Id, It->first, Size);
+					SizedGlyphs->Remove(Size);
+					Count++;
 				}
-			}
-			inline const cbGlyph* GetGlyph(const char32_t& ch, const std::size_t& Size) const
-			{
-				if (Glyphs.find(ch) != Glyphs.end())
+
+				if (SizedGlyphs->IsEmpty())
 				{
-					return Glyphs.at(ch)->Get(Size);
+					delete SizedGlyphs;
+					It = Glyphs.erase(It);
 				}
-				return nullptr;
-			}
-
-			const std::optional<cbBounds> GenerateTextureCoordinate(const char32_t& Ch, const std::size_t& Size, const cbVector& PenLocation) const
-			{
-				if (Glyphs.find(Ch) != Glyphs.end())
+				else
 				{
-					return Glyphs.at(Ch)->GenerateTextureCoordinate(Size, PenLocation);
+					It++;
 				}
-				return std::nullopt;
 			}
+			return Count;
+		}
 
-			const eFontType& GetType() const { return Type; }
-			const FT_Face& Get() const { return FontFace; }
-			const std::map<char32_t, SizedGlyphData*>& GetGlyphs() const { return Glyphs; }
+		inline std::size_t GetId() const { return Id; }
+		inline const std::vector<unsigned char>& GetData() const { return Data; }
+		const FT_Face& Get() const { return FontFace; }
+		const std::map<char32_t, SizedGlyphData*>& GetGlyphs() const { return Glyphs; }
 
-		protected:
-			FT_Face FontFace;
-			std::map<char32_t, SizedGlyphData*> Glyphs;
-			eFontType Type;
-			FreeTypeFont* Owner;
-		};
+	protected:
+		FT_Face FontFace;
+		std::map<char32_t, SizedGlyphData*> Glyphs;
+		/* Metrics of characters that are measured but not created, keyed by size and character. */
+		std::unordered_map<std::uint64_t, cbGlyphMetrics> Metrics;
+		/* Font data of the faces loaded from memory, owned by the face. */
+		std::vector<unsigned char> Data;
+		/* Key of the glyphs on the texture atlas. */
+		std::size_t Id;
+		/* Rasterization settings of the store. */
+		const cbFontDesc& Desc;
+	};
 
+	/*
+	* FreeType library, faces and the texture atlas shared by the font families with the same rasterization settings.
+	* Faces are keyed by the canonical file path or by the hash of the font data.
+	*/
+	class cbFreeTypeFontFamily::FreeTypeFontStore final
+	{
 	public:
-		FreeTypeFont(cbFreeTypeFontFamily* pOwner, const cbFontDesc& FontDesc)
-			: mTextureMetaData(new cbFontTextureMetaData(FontDesc))
-			, Owner(pOwner)
+		FreeTypeFontStore(const cbFontDesc& FontDesc)
+			: Desc(FontDesc)
+			, TextureMetaData(new cbFontTextureMetaData(FontDesc))
+			, FrameIndex(0)
+			, LastEvictionFrame(0)
+			, bIsEvictionPending(false)
 		{
+			/* Only the rasterization settings are kept. */
+			Desc.Fonts.clear();
+			Desc.fFontTextureUpdate_Callback = nullptr;
+
 			FT_Init_FreeType(&FreeTypeLibrary);
 
-			FT_Property_Set(FreeTypeLibrary, "bsdf", "spread", &FontDesc.Spread);
-			FT_Property_Set(FreeTypeLibrary, "sdf", "spread", &FontDesc.Spread);
-			FT_Property_Set(FreeTypeLibrary, "sdf", "overlaps", &FontDesc.Overlaps);
+			FT_Property_Set(FreeTypeLibrary, "bsdf", "spread", &Desc.Spread);
+			FT_Property_Set(FreeTypeLibrary, "sdf", "spread", &Desc.Spread);
+			FT_Property_Set(FreeTypeLibrary, "sdf", "overlaps", &Desc.Overlaps);
 		}
 
-		~FreeTypeFont()
+		~FreeTypeFontStore()
 		{
-			Owner = nullptr;
 			for (auto& FontFace : FontFaces)
 			{
 				delete FontFace.second;
@@ -544,117 +748,155 @@ namespace cbgui
 			}
 			FontFaces.clear();
 
-			delete mTextureMetaData;
-			mTextureMetaData = nullptr;
+			delete TextureMetaData;
+			TextureMetaData = nullptr;
 
 			FT_Done_FreeType(FreeTypeLibrary);
 		}
 
-		inline const cbFontDesc& GetDesc() const { return Owner->GetDesc(); }
-
-		bool LoadFont(const eFontType& FontType, const std::string& Path)
+		/* Returns a store with matching rasterization settings, creates one if there is none. */
+		static FreeTypeFontStore* Acquire(cbFreeTypeFontFamily* Family)
 		{
-			if (FontFaces.find(FontType) == FontFaces.end())
+			const cbFontDesc& FontDesc = Family->GetDesc();
+
+			FreeTypeFontStore* Store = nullptr;
+			if (FontDesc.bShareFontFaces)
 			{
-				FontFaces.insert({ FontType, new FreeTypeFontFace(this, FreeTypeLibrary, Path, FontType) });
-				return true;
+				for (const auto& SharedStore : Stores)
+				{
+					if (SharedStore->IsCompatible(FontDesc))
+					{
+						Store = SharedStore;
+						break;
+					}
+				}
 			}
-			return false;
-		}
 
-		bool LoadFont(const eFontType& FontType, unsigned char* pFont, FT_Long file_size, FT_Long face_index)
-		{
-			if (FontFaces.find(FontType) == FontFaces.end())
+			if (!Store)
 			{
-				FontFaces.insert({ FontType, new FreeTypeFontFace(this, FreeTypeLibrary, pFont, file_size, face_index, FontType) });
-				return true;
+				Store = new FreeTypeFontStore(FontDesc);
+				if (FontDesc.bShareFontFaces)
+					Stores.push_back(Store);
 			}
-			return false;
-		}
 
-		void LoadGlyphs(const eFontType& FontType)
-		{
-			if (IsFontTypeExist(FontType))
-				FontFaces.at(FontType)->LoadGlyphs(mTextureMetaData);
+			Store->Families.push_back(Family);
+			return Store;
 		}
 
-		inline void AddGlyph(const eFontType& FontType, const char32_t& ch, const std::size_t& Size, cbGlyph* Glyph)
+		/* The store is destroyed with its last family. */
+		static void Release(FreeTypeFontStore* Store, cbFreeTypeFontFamily* Family)
 		{
-			if (IsFontTypeExist(FontType))
-				FontFaces.at(FontType)->AddGlyph(ch, Size, Glyph);
-		}
+			Store->Families.erase(std::remove(Store->Families.begin(), Store->Families.end(), Family), Store->Families.end());
+			if (Store->Families.size() > 0)
+				return;
 
-		std::int32_t GetKerning(const int& ch1, const int& ch2, const std::size_t& Size, const eFontType& FontType) const
-		{
-			if (IsFontTypeExist(FontType))
-				return FontFaces.at(FontType)->GetKerning(ch1, ch2, Size);
-			return 0;
+			Stores.erase(std::remove(Stores.begin(), Stores.end(), Store), Stores.end());
+			delete Store;
 		}
 
-		std::size_t GetLineDistance(const std::size_t& Size, const eFontType& FontType)
+		bool IsCompatible(const cbFontDesc& FontDesc) const
 		{
-			if (IsFontTypeExist(FontType))
-				return FontFaces.at(FontType)->GetLineDistance(Size);
-			return 0;
+			return Desc.bShareFontFaces == FontDesc.bShareFontFaces
+				&& Desc.AtlasWidth == FontDesc.AtlasWidth
+				&& Desc.AtlasHeight == FontDesc.AtlasHeight
+				&& Desc.DPI == FontDesc.DPI
+				&& Desc.UseVerticalAligment == FontDesc.UseVerticalAligment
+				&& Desc.StartPosition == FontDesc.StartPosition
+				&& Desc.SpaceBetweenChars == FontDesc.SpaceBetweenChars
+				&& Desc.SDF == FontDesc.SDF
+				&& Desc.Spread == FontDesc.Spread
+				&& Desc.Overlaps == FontDesc.Overlaps;
 		}
 
-		bool IsCharExist(const eFontType& FontType, const std::size_t& Size, const char32_t& Character)
+		FreeTypeFontFace* FindOrLoadFace(const std::string& Path)
 		{
-			if (IsFontTypeExist(FontType))
-				return FontFaces.at(FontType)->IsCharExist(Size, Character);
-			return false;
-		}
+			std::error_code Error;
+			const std::filesystem::path CanonicalPath = std::filesystem::weakly_canonical(std::filesystem::path(Path), Error);
+			const std::string Key = "file:" + (Error ? Path : CanonicalPath.string());
 
-		inline const cbGlyph* GetGlyph(const eFontType& FontType, const char32_t& ch, const std::size_t& Size) const
-		{
-			if (IsFontTypeExist(FontType))
-				return FontFaces.at(FontType)->GetGlyph(ch, Size);
-			return nullptr;
+			const auto It = FontFaces.find(Key);
+			if (It != FontFaces.end())
+				return It->second;
+
+			FreeTypeFontFace* FontFace = new FreeTypeFontFace(Desc, FreeTypeLibrary, Path, FontFaces.size());
+			FontFaces.insert({ Key, FontFace });
+			return FontFace;
 		}
 
-		std::optional<cbBounds> GetTextureCoordinate(const eFontType& FontType, const std::size_t& Size, const char32_t& Character)
+		FreeTypeFontFace* FindOrLoadFace(const unsigned char* pFont, const std::size_t Size, const FT_Long face_index)
 		{
-			if (!IsFontTypeExist(FontType))
-				return std::nullopt;
+			/* FNV-1a */
+			std::uint64_t Hash = 14695981039346656037ULL;
+			for (std::size_t i = 0; i < Size; i++)
+			{
+				Hash ^= pFont[i];
+				Hash *= 1099511628211ULL;
+			}
 
-			if (const auto& pTC = mTextureMetaData->Get(FontType, Character, Size))
-				return pTC->GenerateTextureCoordinate();
+			std::string Key = "data:" + std::to_string(Hash) + ":" + std::to_string(Size) + ":" + std::to_string(face_index);
 
-			return std::nullopt;
+			const auto It = FontFaces.find(Key);
+			if (It != FontFaces.end())
+			{
+				if (std::memcmp(It->second->GetData().data(), pFont, Size) == 0)
+					return It->second;
+				/* Hash collision, the font is not shared. */
+				Key += ":" + std::to_string(FontFaces.size());
+			}
+
+			FreeTypeFontFace* FontFace = new FreeTypeFontFace(Desc, FreeTypeLibrary, std::vector<unsigned char>(pFont, pFont + Size), face_index, FontFaces.size());
+			FontFaces.insert({ Key, FontFace });
+			return FontFace;
 		}
 
+		/* Removes the glyphs that are not used since the given frame from every face. */
+		std::size_t EvictGlyphs(const std::uint64_t OldestFrame)
+		{
+			std::size_t Count = 0;
+			for (auto& FontFace : FontFaces)
+				Count += FontFace.second->EvictGlyphs(OldestFrame, TextureMetaData);
+			return Count;
+		}
 
-		const cbGlyph* CreateChar(const eFontType& FontType, const std::size_t& FontSize, const char32_t& character)
+		inline bool RepackTexture() { return TextureMetaData->Repack(); }
+		inline float GetAtlasUsage() const { return TextureMetaData->GetUsage(); }
+
+		/* Sends the glyph to the texture of every family. */
+		void UploadGlyph(const cbFontTextureGlyphData* FontTextureGlyphData) const
 		{
-			if (IsFontTypeExist(FontType))
+			const cbBounds Rect = FontTextureGlyphData->GenerateTextureCoordinate();
+			for (const auto& Family : Families)
 			{
-				return FontFaces.at(FontType)->CreateChar(FontSize, character, mTextureMetaData);
+				if (Family->GetDesc().fFontTextureUpdate_Callback)
+					Family->GetDesc().fFontTextureUpdate_Callback(&FontTextureGlyphData->Pixels[0], FontTextureGlyphData->Pitch,
+						(std::size_t)Rect.Min.X, (std::size_t)Rect.Min.Y, (std::size_t)Rect.Max.X, (std::size_t)Rect.Max.Y);
 			}
-			return nullptr;
 		}
 
-		const cbGlyph* FindOrAdd(const eFontType& FontType, const std::size_t& Size, const char32_t& character)
+		/* Sends the whole texture to every family except the given one. */
+		void UploadTexture(const cbFreeTypeFontFamily* Except = nullptr) const
 		{
-			if (!IsFontTypeExist(FontType))
-				return nullptr;
-
-			if (const cbGlyph* Glyph = GetGlyph(FontType, character, Size))
-				return Glyph;
+			std::vector<unsigned char> Texture;
+			for (const auto& Family : Families)
+			{
+				if (Family == Except || !Family->GetDesc().fFontTextureUpdate_Callback)
+					continue;
 
-			return CreateChar(FontType, Size, character);
+				if (Texture.size() == 0)
+					Texture = GenerateTexture();
+				Family->GetDesc().fFontTextureUpdate_Callback(&Texture[0], Desc.AtlasWidth, 0, 0, Desc.AtlasWidth, Desc.AtlasHeight);
+			}
 		}
 
-		const bool IsFontTypeExist(const eFontType& FontType) const { return FontFaces.find(FontType) != FontFaces.end(); }
-		const FT_Face& GetFace(const eFontType& FontType) const { return FontFaces.at(FontType)->Get(); }
-		const FreeTypeFontFace* GetFontFace(const eFontType& FontType) const { return FontFaces.at(FontType); }
-		const std::map<eFontType, FreeTypeFontFace*>& GetFontFaces() const { return FontFaces; }
-
-		const std::vector<unsigned char> GenerateTexture(const std::size_t& AtlasWidth, const std::size_t& AtlasHeight, const cbVector& SpaceBetweenChars, const cbMargin& CharPadding)
+		const std::vector<unsigned char> GenerateTexture() const
 		{
+			const std::size_t AtlasWidth = Desc.AtlasWidth;
+			const std::size_t AtlasHeight = Desc.AtlasHeight;
+
 			std::vector<unsigned char> Image;
 			Image.resize(AtlasWidth * AtlasHeight);
 
-			for (const auto& pTextureMetaData : mTextureMetaData->GetTextureMetaData())
+			for (const auto& pTextureMetaData : TextureMetaData->GetTextureMetaData())
 			{
 				for (const auto& pTextureData : pTextureMetaData.second->GetSizedTextureGlypheData())
 				{
@@ -683,8 +925,168 @@ namespace cbgui
 			return Image;
 		}
 
+		inline cbFontTextureMetaData* GetTextureMetaData() const { return TextureMetaData; }
+		inline const std::vector<cbFreeTypeFontFamily*>& GetFamilies() const { return Families; }
+
+		/* The highest frame index of the families. */
+		std::uint64_t FrameIndex;
+		std::uint64_t LastEvictionFrame;
+		/* Set when a glyph is created above the high water mark, the eviction runs in the next BeginFrame. */
+		bool bIsEvictionPending;
+
 	private:
+		/* Shared stores, stores of the families that disable sharing are not listed. */
+		static std::vector<FreeTypeFontStore*> Stores;
+
+		cbFontDesc Desc;
 		FT_Library FreeTypeLibrary;
+		std::map<std::string, FreeTypeFontFace*> FontFaces;
+		cbFontTextureMetaData* TextureMetaData;
+		std::vector<cbFreeTypeFontFamily*> Families;
+	};
+
+	std::vector<cbFreeTypeFontFamily::FreeTypeFontStore*> cbFreeTypeFontFamily::FreeTypeFontStore::Stores;
+
+	/* Font faces of a family, a view of the shared store. */
+	class cbFreeTypeFontFamily::FreeTypeFont final
+	{
+
+	public:
+		FreeTypeFont(cbFreeTypeFontFamily* pOwner)
+			: Store(FreeTypeFontStore::Acquire(pOwner))
+			, mTextureMetaData(Store->GetTextureMetaData())
+			, Owner(pOwner)
+		{}
+
+		~FreeTypeFont()
+		{
+			/* The faces are owned by the store. */
+			FontFaces.clear();
+			mTextureMetaData = nullptr;
+
+			FreeTypeFontStore::Release(Store, Owner);
+			Store = nullptr;
+			Owner = nullptr;
+		}
+
+		inline const cbFontDesc& GetDesc() const { return Owner->GetDesc(); }
+
+		bool LoadFont(const eFontType& FontType, const std::string& Path)
+		{
+			if (FontFaces.find(FontType) == FontFaces.end())
+			{
+				FontFaces.insert({ FontType, Store->FindOrLoadFace(Path) });
+				return true;
+			}
+			return false;
+		}
+
+		bool LoadFont(const eFontType& FontType, unsigned char* pFont, FT_Long file_size, FT_Long face_index)
+		{
+			if (FontFaces.find(FontType) == FontFaces.end())
+			{
+				FontFaces.insert({ FontType, Store->FindOrLoadFace(pFont, (std::size_t)file_size, face_index) });
+				return true;
+			}
+			return false;
+		}
+
+		std::size_t LoadGlyphs(const eFontType& FontType)
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->LoadGlyphs(GetDesc().FontSize, GetDesc().Numchars, mTextureMetaData);
+			return 0;
+		}
+
+		inline void AddGlyph(const eFontType& FontType, const char32_t& ch, const std::size_t& Size, cbGlyph* Glyph)
+		{
+			if (IsFontTypeExist(FontType))
+				FontFaces.at(FontType)->AddGlyph(ch, Size, Glyph);
+		}
+
+		std::int32_t GetKerning(const int& ch1, const int& ch2, const std::size_t& Size, const eFontType& FontType) const
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->GetKerning(ch1, ch2, Size);
+			return 0;
+		}
+
+		std::size_t GetLineDistance(const std::size_t& Size, const eFontType& FontType)
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->GetLineDistance(Size);
+			return 0;
+		}
+
+		bool IsCharExist(const eFontType& FontType, const std::size_t& Size, const char32_t& Character)
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->IsCharExist(Size, Character);
+			return false;
+		}
+
+		inline const cbGlyph* GetGlyph(const eFontType& FontType, const char32_t& ch, const std::size_t& Size) const
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->GetGlyph(ch, Size);
+			return nullptr;
+		}
+
+		std::optional<cbGlyphMetrics> GetGlyphMetrics(const eFontType& FontType, const std::size_t& Size, const char32_t& Character)
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->GetGlyphMetrics(Size, Character);
+			return std::nullopt;
+		}
+
+		std::optional<cbBounds> GetTextureCoordinate(const eFontType& FontType, const std::size_t& Size, const char32_t& Character)
+		{
+			if (!IsFontTypeExist(FontType))
+				return std::nullopt;
+
+			if (const auto& pTC = mTextureMetaData->Get(FontFaces.at(FontType)->GetId(), Character, Size))
+				return pTC->GenerateTextureCoordinate();
+
+			return std::nullopt;
+		}
+
+
+		const cbGlyph* CreateChar(const eFontType& FontType, const std::size_t& FontSize, const char32_t& character)
+		{
+			if (IsFontTypeExist(FontType))
+			{
+				return FontFaces.at(FontType)->CreateChar(FontSize, character, mTextureMetaData);
+			}
+			return nullptr;
+		}
+
+		const cbGlyph* FindOrAdd(const eFontType& FontType, const std::size_t& Size, const char32_t& character)
+		{
+			if (!IsFontTypeExist(FontType))
+				return nullptr;
+
+			if (const cbGlyph* Glyph = GetGlyph(FontType, character, Size))
+				return Glyph;
+
+			return CreateChar(FontType, Size, character);
+		}
+
+		bool IsKerningSupported(const eFontType& FontType) const
+		{
+			if (IsFontTypeExist(FontType))
+				return FontFaces.at(FontType)->IsKerningSupported();
+			return false;
+		}
+
+		const bool IsFontTypeExist(const eFontType& FontType) const { return FontFaces.find(FontType) != FontFaces.end(); }
+		const FT_Face& GetFace(const eFontType& FontType) const { return FontFaces.at(FontType)->Get(); }
+		const FreeTypeFontFace* GetFontFace(const eFontType& FontType) const { return FontFaces.at(FontType); }
+		const std::map<eFontType, FreeTypeFontFace*>& GetFontFaces() const { return FontFaces; }
+
+		inline FreeTypeFontStore* GetStore() const { return Store; }
+
+	private:
+		FreeTypeFontStore* Store;
 		std::map<eFontType, FreeTypeFontFace*> FontFaces;
 		cbFontTextureMetaData* mTextureMetaData;
 		cbFreeTypeFontFamily* Owner;
@@ -692,21 +1094,27 @@ namespace cbgui
 
 	cbFreeTypeFontFamily::cbFreeTypeFontFamily(const cbFontDesc& FontDesc)
 		: Desc(FontDesc)
-		, FreeTypeFontManager(new FreeTypeFont(this, FontDesc))
+		, FreeTypeFontManager(new FreeTypeFont(this))
+		, FrameIndex(0)
 	{
+		std::size_t Count = 0;
 		for (const auto& Font : Desc.Fonts)
 		{
 			if (Font.second.pFont)
 			{
 				FreeTypeFontManager->LoadFont(Font.first, Font.second.pFont, (FT_Long)Font.second.pFontSize, 0);
-				FreeTypeFontManager->LoadGlyphs(Font.first);
+				Count += FreeTypeFontManager->LoadGlyphs(Font.first);
 			}
 			else
 			{
 				FreeTypeFontManager->LoadFont(Font.first, Desc.DefaultFontLocation + Font.second.FontPath);
-				FreeTypeFontManager->LoadGlyphs(Font.first);
+				Count += FreeTypeFontManager->LoadGlyphs(Font.first);
 			}
 		}
+
+		/* The other families of the shared store read the new glyphs from the texture. */
+		if (Count > 0)
+			FreeTypeFontManager->GetStore()->UploadTexture(this);
 	}
 
 	inline std::size_t cbFreeTypeFontFamily::GetLineDistance(const std::size_t& Size, const eFontType& FontType)
@@ -716,17 +1124,160 @@ namespace cbgui
 
 	cbFreeTypeFontFamily::~cbFreeTypeFontFamily()
 	{
+		cbTextLayoutCache::Get().Invalidate(this);
+
+		for (auto& Geometry : Geometries)
+			Geometry->FontFamily = nullptr;
+		Geometries.clear();
+
 		delete FreeTypeFontManager;
 		FreeTypeFontManager = nullptr;
 	}
 
 	const std::vector<unsigned char> cbFreeTypeFontFamily::GetTexture() const
 	{
-		return FreeTypeFontManager->GenerateTexture(Desc.AtlasWidth, Desc.AtlasHeight, Desc.SpaceBetweenChars, Desc.CharPadding);
+		return FreeTypeFontManager->GetStore()->GenerateTexture();
+	}
+
+	void cbFreeTypeFontFamily::BeginFrame()
+	{
+		FrameIndex++;
+
+		FreeTypeFontStore* Store = FreeTypeFontManager->GetStore();
+		Store->FrameIndex = std::max(Store->FrameIndex, FrameIndex);
+
+		/* Runs between frames, no text is being built while the atlas is compacted. */
+		if (Desc.bEnableGlyphEviction && Store->bIsEvictionPending && Store->LastEvictionFrame != Store->FrameIndex)
+		{
+			Store->bIsEvictionPending = false;
+			EvictUnusedGlyphs();
+		}
+	}
+
+	std::uint64_t cbFreeTypeFontFamily::GetFrameIndex() const
+	{
+		return FreeTypeFontManager->GetStore()->FrameIndex;
+	}
+
+	float cbFreeTypeFontFamily::GetAtlasUsage() const
+	{
+		return FreeTypeFontManager->GetStore()->GetAtlasUsage();
+	}
+
+	std::size_t cbFreeTypeFontFamily::EvictUnusedGlyphs()
+	{
+		FreeTypeFontStore* Store = FreeTypeFontManager->GetStore();
+		Store->LastEvictionFrame = Store->FrameIndex;
+
+		if (Store->FrameIndex < Desc.GlyphEvictionAge)
+			return 0;
+
+		/* The atlas is shared, the texts of every family of the store keep their glyphs. */
+		for (const auto& Family : Store->GetFamilies())
+		{
+			for (const auto& Geometry : Family->Geometries)
+				Geometry->MarkUsedGlyphs(Store->FrameIndex);
+		}
+
+		const std::size_t Count = Store->EvictGlyphs(Store->FrameIndex - Desc.GlyphEvictionAge);
+		if (Count > 0)
+			CompactAtlas();
+
+		return Count;
+	}
+
+	void cbFreeTypeFontFamily::CompactAtlas()
+	{
+		FreeTypeFontStore* Store = FreeTypeFontManager->GetStore();
+		/* The evicted glyphs leave holes, the remaining glyphs keep their places. */
+		if (!Store->RepackTexture())
+			return;
+
+		for (const auto& Family : Store->GetFamilies())
+		{
+			/* Cached layouts hold the old texture coordinates. */
+			cbTextLayoutCache::Get().Invalidate(Family);
+
+			for (const auto& Geometry : Family->Geometries)
+				Geometry->FontAtlasRemapped();
+		}
+
+		Store->UploadTexture();
+	}
+
+	void cbFreeTypeFontFamily::AddGeometry(cbFontGeometry* Geometry)
+	{
+		Geometries.insert(Geometry);
+	}
+
+	void cbFreeTypeFontFamily::RemoveGeometry(cbFontGeometry* Geometry)
+	{
+		Geometries.erase(Geometry);
+	}
+
+	/* Request list of the calling thread, see BindRequests. */
+	static thread_local cbFontRequests* BoundRequests = nullptr;
+
+	static std::uint64_t GetMetricsKey(const std::size_t Size, const eFontType Type)
+	{
+		return ((std::uint64_t)Type << 32) | (std::uint64_t)Size;
+	}
+
+	/* 4 bits type, 18 bits size and 21 bits for each character. */
+	static std::optional<std::uint64_t> GetKerningKey(const int ch1, const int ch2, const std::size_t Size, const eFontType Type)
+	{
+		if (ch1 < 0 || ch2 < 0 || ch1 > 0x1FFFFF || ch2 > 0x1FFFFF || Size > 0x3FFFF || (std::uint64_t)Type > 0xF)
+			return std::nullopt;
+		return ((std::uint64_t)Type << 60) | ((std::uint64_t)Size << 42) | ((std::uint64_t)ch1 << 21) | (std::uint64_t)ch2;
+	}
+
+	void cbFreeTypeFontFamily::BindRequests(cbFontRequests* Requests)
+	{
+		BoundRequests = Requests;
+	}
+
+	cbFontRequests* cbFreeTypeFontFamily::GetBoundRequests()
+	{
+		return BoundRequests;
+	}
+
+	void cbFreeTypeFontFamily::ResolveRequests(const cbFontRequests& Requests)
+	{
+		for (const auto& Glyph : Requests.Glyphs)
+		{
+			if (!IsCharExist(Glyph.FontType, Glyph.FontSize, Glyph.Character))
+				CreateChar(Glyph.FontType, Glyph.FontSize, Glyph.Character);
+		}
+
+		/* Fills the metrics cache. */
+		for (const auto& Metrics : Requests.Metrics)
+		{
+			GetAscender(Metrics.FontSize, Metrics.FontType);
+			GetDescender(Metrics.FontSize, Metrics.FontType);
+		}
+
+		for (const auto& Kerning : Requests.Kernings)
+		{
+			const auto Key = GetKerningKey(Kerning.First, Kerning.Second, Kerning.FontSize, Kerning.FontType);
+			if (!Key.has_value() || Kernings.find(Key.value()) != Kernings.end())
+				continue;
+
+			Kernings.insert({ Key.value(), FreeTypeFontManager->GetKerning(Kerning.First, Kerning.Second, Kerning.FontSize, Kerning.FontType) });
+		}
 	}
 
 	bool cbFreeTypeFontFamily::CreateChar(const eFontType& FontType, const std::size_t& FontSize, const char32_t& character)
 	{
+		if (BoundRequests)
+		{
+			BoundRequests->Glyphs.push_back(cbFontRequests::cbGlyphRequest(FontType, FontSize, character));
+			return false;
+		}
+
+		/* The text may be half built, the eviction is deferred to BeginFrame. */
+		if (Desc.bEnableGlyphEviction && GetAtlasUsage() >= Desc.AtlasHighWaterMark)
+			FreeTypeFontManager->GetStore()->bIsEvictionPending = true;
+
 		auto Result = FreeTypeFontManager->CreateChar(FontType, FontSize, character);
 		if (!Result)
 			return false;
@@ -744,12 +1295,11 @@ namespace cbgui
 			if (!FontTextureGlyphData->IsValid())
 				return false;
 
+			/* Every family of the store gets the glyph. */
+			FreeTypeFontManager->GetStore()->UploadGlyph(FontTextureGlyphData);
+
 			if (Desc.fFontTextureUpdate_Callback)
-			{
-				const cbBounds Rect = FontTextureGlyphData->GenerateTextureCoordinate();
-				Desc.fFontTextureUpdate_Callback(&FontTextureGlyphData->Pixels[0], FontTextureGlyphData->Pitch, (std::size_t)Rect.Min.X, (std::size_t)Rect.Min.Y, (std::size_t)Rect.Max.X, (std::size_t)Rect.Max.Y);
 				return true;
-			}
 		}
 		return false;
 	}
@@ -775,6 +1325,17 @@ namespace cbgui
 				return Desc.DefaultAscender.at(Size);
 		}
 
+		const std::uint64_t Key = GetMetricsKey(Size, Type);
+		const auto It = Ascenders.find(Key);
+		if (It != Ascenders.end())
+			return It->second;
+
+		if (BoundRequests)
+		{
+			BoundRequests->Metrics.push_back(cbFontRequests::cbMetricsRequest(Type, Size));
+			return 0;
+		}
+
 		const FT_Face& Face = FreeTypeFontManager->GetFace(Type);
 
 		FT_Set_Char_Size(
@@ -784,7 +1345,9 @@ namespace cbgui
 			(FT_UInt)Desc.DPI,                       // horizontal device resolution
 			(FT_UInt)Desc.DPI);
 
-		return Face->size->metrics.ascender >> 6;
+		const int Ascender = Face->size->metrics.ascender >> 6;
+		Ascenders.insert({ Key, Ascender });
+		return Ascender;
 	}
 
 	int cbFreeTypeFontFamily::GetDescender(const std::size_t& Size, const eFontType& Type) const
@@ -798,6 +1361,17 @@ namespace cbgui
 				return Desc.DefaultDescender.at(Size);
 		}
 
+		const std::uint64_t Key = GetMetricsKey(Size, Type);
+		const auto It = Descenders.find(Key);
+		if (It != Descenders.end())
+			return It->second;
+
+		if (BoundRequests)
+		{
+			BoundRequests->Metrics.push_back(cbFontRequests::cbMetricsRequest(Type, Size));
+			return 0;
+		}
+
 		const FT_Face& Face = FreeTypeFontManager->GetFace(Type);
 
 		FT_Set_Char_Size(
@@ -807,7 +1381,9 @@ namespace cbgui
 			(FT_UInt)Desc.DPI,                       // horizontal device resolution
 			(FT_UInt)Desc.DPI);
 
-		return Face->size->metrics.descender >> 6;
+		const int Descender = Face->size->metrics.descender >> 6;
+		Descenders.insert({ Key, Descender });
+		return Descender;
 	}
 
 	const cbGlyph* cbFreeTypeFontFamily::FindOrAdd(const eFontType& FontType, const std::size_t& FontSize, const char32_t& character)
@@ -820,8 +1396,31 @@ namespace cbgui
 		return FreeTypeFontManager->GetGlyph(Type, ch, Size);
 	}
 
+	std::optional<cbGlyphMetrics> cbFreeTypeFontFamily::GetGlyphMetrics(const eFontType& FontType, const std::size_t& Size, const char32_t& Character)
+	{
+		return FreeTypeFontManager->GetGlyphMetrics(FontType, Size, Character);
+	}
+
 	std::int32_t cbFreeTypeFontFamily::GetKerning(const int& ch1, const int& ch2, const std::size_t& Size, const eFontType& Type) const
 	{
+		if (!FreeTypeFontManager->IsKerningSupported(Type))
+			return 0;
+
+		/* Pairs are cached by ResolveRequests only. */
+		const auto Key = GetKerningKey(ch1, ch2, Size, Type);
+		if (Key.has_value())
+		{
+			const auto It = Kernings.find(Key.value());
+			if (It != Kernings.end())
+				return It->second;
+		}
+
+		if (BoundRequests)
+		{
+			BoundRequests->Kernings.push_back(cbFontRequests::cbKerningRequest(Type, Size, ch1, ch2));
+			return 0;
+		}
+
 		return FreeTypeFontManager->GetKerning(ch1, ch2, Size, Type);
 	}
 
@@ -830,6 +1429,224 @@ namespace cbgui
 		return new cbFreeTypeFontFamily(FontDesc);
 	}
 
+	void cbTextMetrics::cbCharacterArray::Reserve(const std::size_t Size)
+	{
+		Codepoints.reserve(Size);
+		WordOrders.reserve(Size);
+		LineOrders.reserve(Size);
+		CharacterSizes.reserve(Size);
+		Types.reserve(Size);
+		Ascenders.reserve(Size);
+		Descenders.reserve(Size);
+		XAdvances.reserve(Size);
+		BearingXs.reserve(Size);
+		Bounds.reserve(Size);
+		TextureCoordinates.reserve(Size);
+		Kernings.reserve(Size);
+		AlignedKernings.reserve(Size);
+		Ignored.reserve(Size);
+		ColorIndices.reserve(Size);
+	}
+
+	void cbTextMetrics::cbCharacterArray::Clear()
+	{
+		Codepoints.clear();
+		WordOrders.clear();
+		LineOrders.clear();
+		CharacterSizes.clear();
+		Types.clear();
+		Ascenders.clear();
+		Descenders.clear();
+		XAdvances.clear();
+		BearingXs.clear();
+		Bounds.clear();
+		TextureCoordinates.clear();
+		Kernings.clear();
+		AlignedKernings.clear();
+		Ignored.clear();
+		ColorIndices.clear();
+		Colors.clear();
+
+		NewLineCount = 0;
+		FilteredCount = 0;
+		IgnoredCount = 0;
+	}
+
+	void cbTextMetrics::cbCharacterArray::Assign(std::u32string&& InCodepoints, const std::size_t CharacterSize, const eFontType Type)
+	{
+		Clear();
+
+		Codepoints = std::move(InCodepoints);
+		const std::size_t Size = Codepoints.size();
+
+		WordOrders.assign(Size, 0);
+		LineOrders.assign(Size, 0);
+		CharacterSizes.assign(Size, (std::uint16_t)CharacterSize);
+		Types.assign(Size, Type);
+		Ascenders.assign(Size, 0);
+		Descenders.assign(Size, 0);
+		XAdvances.assign(Size, 0);
+		BearingXs.assign(Size, 0);
+		Bounds.assign(Size, cbBounds());
+		TextureCoordinates.assign(Size, cbBounds());
+		Kernings.assign(Size, 0.0f);
+		AlignedKernings.assign(Size, 0.0f);
+		Ignored.resize(Size);
+		ColorIndices.assign(Size, NoColor);
+
+		for (std::size_t i = 0; i < Size; i++)
+		{
+			const char32_t Char = Codepoints[i];
+			Ignored[i] = (Char == '\n' || Char < 32) ? 1 : 0;
+			AddToCounters(i);
+		}
+	}
+
+	void cbTextMetrics::cbCharacterArray::PushBack(const cbCharacter& Character)
+	{
+		Insert(size(), Character);
+	}
+
+	void cbTextMetrics::cbCharacterArray::Insert(const std::size_t i, const cbCharacter& Character)
+	{
+		Codepoints.insert(Codepoints.begin() + i, Character.Character);
+		WordOrders.insert(WordOrders.begin() + i, 0);
+		LineOrders.insert(LineOrders.begin() + i, 0);
+		CharacterSizes.insert(CharacterSizes.begin() + i, 0);
+		Types.insert(Types.begin() + i, eFontType::Regular);
+		Ascenders.insert(Ascenders.begin() + i, 0);
+		Descenders.insert(Descenders.begin() + i, 0);
+		XAdvances.insert(XAdvances.begin() + i, 0);
+		BearingXs.insert(BearingXs.begin() + i, 0);
+		Bounds.insert(Bounds.begin() + i, cbBounds());
+		TextureCoordinates.insert(TextureCoordinates.begin() + i, cbBounds());
+		Kernings.insert(Kernings.begin() + i, 0.0f);
+		AlignedKernings.insert(AlignedKernings.begin() + i, 0.0f);
+		Ignored.insert(Ignored.begin() + i, 0);
+		ColorIndices.insert(ColorIndices.begin() + i, NoColor);
+
+		Write(i, Character);
+		AddToCounters(i);
+	}
+
+	void cbTextMetrics::cbCharacterArray::Erase(const std::size_t i)
+	{
+		RemoveFromCounters(i);
+
+		Codepoints.erase(Codepoints.begin() + i);
+		WordOrders.erase(WordOrders.begin() + i);
+		LineOrders.erase(LineOrders.begin() + i);
+		CharacterSizes.erase(CharacterSizes.begin() + i);
+		Types.erase(Types.begin() + i);
+		Ascenders.erase(Ascenders.begin() + i);
+		Descenders.erase(Descenders.begin() + i);
+		XAdvances.erase(XAdvances.begin() + i);
+		BearingXs.erase(BearingXs.begin() + i);
+		Bounds.erase(Bounds.begin() + i);
+		TextureCoordinates.erase(TextureCoordinates.begin() + i);
+		Kernings.erase(Kernings.begin() + i);
+		AlignedKernings.erase(AlignedKernings.begin() + i);
+		Ignored.erase(Ignored.begin() + i);
+		ColorIndices.erase(ColorIndices.begin() + i);
+	}
+
+	cbTextMetrics::cbCharacter cbTextMetrics::cbCharacterArray::Get(const std::size_t i) const
+	{
+		cbCharacter Character(Codepoints[i], i, WordOrders[i], LineOrders[i], CharacterSizes[i], Types[i], Ascenders[i], Descenders[i], XAdvances[i], BearingXs[i],
+			Bounds[i], TextureCoordinates[i], Ignored[i] != 0, Kernings[i], GetColor(i));
+		Character.AlignedKerning = AlignedKernings[i];
+		return Character;
+	}
+
+	void cbTextMetrics::cbCharacterArray::Set(const std::size_t i, const cbCharacter& Character)
+	{
+		RemoveFromCounters(i);
+		Write(i, Character);
+		AddToCounters(i);
+	}
+
+	void cbTextMetrics::cbCharacterArray::Write(const std::size_t i, const cbCharacter& Character)
+	{
+		Codepoints[i] = Character.Character;
+		WordOrders[i] = (std::uint32_t)Character.WordOrder;
+		LineOrders[i] = (std::uint32_t)Character.LineOrder;
+		CharacterSizes[i] = (std::uint16_t)Character.CharacterSize;
+		Types[i] = Character.Type;
+		Ascenders[i] = (std::int16_t)Character.Ascender;
+		Descenders[i] = (std::int16_t)Character.Descender;
+		XAdvances[i] = (std::int16_t)Character.xadvance;
+		BearingXs[i] = (std::int16_t)Character.BearingX;
+		Bounds[i] = Character.Bounds;
+		TextureCoordinates[i] = Character.TextureCoordinates;
+		Kernings[i] = Character.Kerning;
+		AlignedKernings[i] = Character.AlignedKerning;
+		Ignored[i] = Character.ignore ? 1 : 0;
+		SetColor(i, Character.Color);
+	}
+
+	void cbTextMetrics::cbCharacterArray::CompactColors(const std::size_t Skipped)
+	{
+		std::vector<std::uint16_t> Remap(Colors.size(), NoColor);
+		std::vector<cbColor> Used;
+		Used.reserve(Colors.size() < size() ? Colors.size() : size());
+
+		for (std::size_t i = 0; i < ColorIndices.size(); i++)
+		{
+			std::uint16_t& Index = ColorIndices[i];
+			if (Index == NoColor)
+				continue;
+			if (i == Skipped)
+			{
+				Index = NoColor;
+				continue;
+			}
+
+			if (Remap[Index] == NoColor)
+			{
+				Remap[Index] = static_cast<std::uint16_t>(Used.size());
+				Used.push_back(Colors[Index]);
+			}
+			Index = Remap[Index];
+		}
+
+		Colors = std::move(Used);
+	}
+
+	std::uint16_t cbTextMetrics::cbCharacterArray::GetNearestColor(const cbColor& Value) const
+	{
+		std::uint16_t Nearest = 0;
+		float NearestDistance = std::numeric_limits<float>::max();
+		for (std::size_t j = 0; j < Colors.size(); j++)
+		{
+			const float R = Colors[j].R - Value.R;
+			const float G = Colors[j].G - Value.G;
+			const float B = Colors[j].B - Value.B;
+			const float A = Colors[j].A - Value.A;
+			const float Distance = (R * R) + (G * G) + (B * B) + (A * A);
+			if (Distance < NearestDistance)
+			{
+				Nearest = static_cast<std::uint16_t>(j);
+				NearestDistance = Distance;
+			}
+		}
+		return Nearest;
+	}
+
+	std::size_t cbTextMetrics::cbCharacterArray::GetMemorySize() const
+	{
+		return (Codepoints.capacity() * sizeof(char32_t))
+			+ (WordOrders.capacity() * sizeof(std::uint32_t))
+			+ (LineOrders.capacity() * sizeof(std::uint32_t))
+			+ (CharacterSizes.capacity() * sizeof(std::uint16_t))
+			+ (Types.capacity() * sizeof(eFontType))
+			+ ((Ascenders.capacity() + Descenders.capacity() + XAdvances.capacity() + BearingXs.capacity()) * sizeof(std::int16_t))
+			+ ((Bounds.capacity() + TextureCoordinates.capacity()) * sizeof(cbBounds))
+			+ ((Kernings.capacity() + AlignedKernings.capacity()) * sizeof(float))
+			+ (Ignored.capacity() * sizeof(std::uint8_t))
+			+ (ColorIndices.capacity() * sizeof(std::uint16_t))
+			+ (Colors.capacity() * sizeof(cbColor));
+	}
+
 	cbFontGeometry::cbFontGeometry(cbText* pOwner, cbIFontFamily* FontFamily)
 		: Owner(pOwner)
 		, bAutoWrapText(false)
@@ -837,8 +1654,13 @@ namespace cbgui
 		, FontFamily(static_cast<cbFreeTypeFontFamily*>(FontFamily))
 		, LineHeightPercentage(1.0f)
 		, TextDesc(cbTextDesc())
+		, Style(pOwner)
+		, Data(std::make_shared<cbGeometryData>())
+		, bIsLayoutCacheEnabled(true)
+		, TabularAdvance(0)
 	{
-		TextMetrics.FontName = FontFamily->GetFontFamilyName();
+		this->FontFamily->AddGeometry(this);
+		TextMetrics().FontName = FontFamily->GetFontFamilyName();
 	}
 
 	cbFontGeometry::cbFontGeometry(cbText* pOwner, const std::u32string& inText, const cbTextDesc& InTextDesc, cbIFontFamily* FontFamily)
@@ -848,76 +1670,185 @@ namespace cbgui
 		, FontFamily(static_cast<cbFreeTypeFontFamily*>(FontFamily))
 		, LineHeightPercentage(1.0f)
 		, TextDesc(InTextDesc)
+		, Style(pOwner)
+		, Data(std::make_shared<cbGeometryData>())
+		, bIsLayoutCacheEnabled(true)
+		, TabularAdvance(0)
 	{
-		TextMetrics.FontName = FontFamily->GetFontFamilyName();
+		this->FontFamily->AddGeometry(this);
+		TextMetrics().FontName = FontFamily->GetFontFamilyName();
 		SetText(inText, TextDesc);
 	}
 
-	cbFontGeometry::cbFontGeometry(const cbFontGeometry& Other, cbText* pOwner)
-		: Owner(pOwner)
-		, bAutoWrapText(Other.bAutoWrapText)
-		, CustomWrapSize(Other.CustomWrapSize)
-		, FontFamily(Other.FontFamily)
-		, LineHeightPercentage(Other.LineHeightPercentage)
-		, TextDesc(Other.TextDesc)
-		, Style(Other.Style)
-		, TextMetrics(Other.TextMetrics)
-		, DefaultSpaceWidth(Other.DefaultSpaceWidth)
-		, Vertices(Other.Vertices)
-		, VertexColors(Other.VertexColors)
-		, TextureCoordinates(Other.TextureCoordinates)
-		, CachedBounds(Other.CachedBounds)
-	{}
+	cbFontGeometry::cbFontGeometry(const cbFontGeometry& Other, cbText* pOwner)
+		: Owner(pOwner)
+		, bAutoWrapText(Other.bAutoWrapText)
+		, CustomWrapSize(Other.CustomWrapSize)
+		, FontFamily(Other.FontFamily)
+		, LineHeightPercentage(Other.LineHeightPercentage)
+		, TextDesc(Other.TextDesc)
+		, Style(pOwner, Other.Style)
+		, Data(cbWidget::IsInstantiating() ? Other.Data : std::make_shared<cbGeometryData>(*Other.Data))
+		, DefaultSpaceWidth(Other.DefaultSpaceWidth)
+		, bIsLayoutCacheEnabled(Other.bIsLayoutCacheEnabled)
+		, TabularCharacters(Other.TabularCharacters)
+		, TabularAdvance(Other.TabularAdvance)
+	{
+		if (FontFamily)
+			FontFamily->AddGeometry(this);
+	}
+
+	cbFontGeometry::~cbFontGeometry()
+	{
+		if (FontFamily)
+			FontFamily->RemoveGeometry(this);
+		Owner = nullptr;
+		FontFamily = nullptr;
+	}
+
+	void cbFontGeometry::Detach()
+	{
+		Data = std::make_shared<cbGeometryData>(*Data);
+	}
+
+	std::size_t cbFontGeometry::cbGeometryData::GetMemorySize() const
+	{
+		return sizeof(cbGeometryData)
+			+ TextMetrics.Characters.GetMemorySize()
+			+ (TextMetrics.LineMetaData.capacity() * sizeof(cbTextMetrics::cbLineMetaData))
+			+ (TextMetrics.WordMetaData.capacity() * sizeof(cbTextMetrics::cbWordMetaData))
+			+ (TextMetrics.TextStyles.capacity() * sizeof(cbTextStyle))
+			+ (TextMetrics.StyleRuns.capacity() * sizeof(cbTextStyleRun))
+			+ (Vertices.capacity() * sizeof(cbVector4))
+			+ (VertexColors.capacity() * sizeof(cbColor))
+			+ (TextureCoordinates.capacity() * sizeof(cbVector))
+			+ (LineGlyphOffsets.capacity() * sizeof(std::size_t));
+	}
+
+	void cbFontGeometry::SetText(const std::u32string& Text, const std::optional<cbTextDesc> Desc)
+	{
+		SetText(std::u32string(Text), Desc);
+	}
+
+	void cbFontGeometry::SetTextUtf8(const std::string_view& Text, const std::optional<cbTextDesc> Desc)
+	{
+		/* Reuses the capacity of the character storage, the code points are moved back by ParseCharacters. A shared layout is not copied for it. */
+		std::u32string Codepoints;
+		if (Data.use_count() == 1)
+			Codepoints = std::move(Data->TextMetrics.Characters.Codepoints);
+		Codepoints.clear();
+		DecodeUtf8(Text, Codepoints);
+		SetText(std::move(Codepoints), Desc);
+	}
+
+	void cbFontGeometry::SetText(std::u32string&& Text, const std::optional<cbTextDesc> Desc)
+	{
+		/* The settings are read through the const data, a layout shared with the cache is only copied when it changes. */
+		if (Desc.has_value())
+		{
+			TextDesc = Desc.value();
+
+			if (Data->TextMetrics.FontSize != TextDesc.CharSize || Data->TextMetrics.FontType != TextDesc.FontType)
+			{
+				TextMetrics().FontSize = TextDesc.CharSize;
+				TextMetrics().FontType = TextDesc.FontType;
+			}
+		}
+
+		if (Data->TextMetrics.bIsStyleRunsPrecompiled)
+			TextMetrics().bIsStyleRunsPrecompiled = false;
+
+		cbTextLayoutKey Key;
+		const bool bUseLayoutCache = bIsLayoutCacheEnabled && cbTextLayoutCache::Get().IsEnabled();
+		if (bUseLayoutCache)
+		{
+			const cbTextMetrics& Metrics = Data->TextMetrics;
+			Key.Text = Text;
+			Key.FontFamily = FontFamily;
+			Key.FontType = Metrics.FontType;
+			Key.FontSize = Metrics.FontSize;
+			Key.bIsTextStylingEnabled = Metrics.bIsTextStylingEnabled;
+			Key.TextStyles = Metrics.TextStyles;
+			Key.WrapWidth = bAutoWrapText ? GetAutoWrapWidth() : -1.0f;
+			Key.TextJustify = TextDesc.TextJustify;
+			Key.DefaultSpaceWidth = DefaultSpaceWidth;
+			Key.LineHeightPercentage = LineHeightPercentage;
+			Key.bIsAscenderDescenderPowerOfTwo = Metrics.bIsAscenderDescenderPowerOfTwo;
+			Key.TabularCharacters = TabularCharacters;
+			Key.GenerateHash();
+
+			if (auto Layout = cbTextLayoutCache::Get().Find(Key))
+			{
+				/* The text references the cached layout, the vertex colors and the grow size copy it only if they differ. */
+				Data = std::move(Layout);
+
+				UpdateTabularAdvance();
+				UpdateVertexColors();
+				GrowTextGeometryData();
+				return;
+			}
+		}
+
+		ParseCharacters(std::move(Text));
+		UpdateAlignments();
 
-	cbFontGeometry::~cbFontGeometry()
-	{
-		Owner = nullptr;
-		FontFamily = nullptr;
+		UpdateVertices();
+		UpdateTextureCoordinates();
+		UpdateVertexColors();
+		GrowTextGeometryData();
+
+		/* Layouts shaped with missing font data are not cached. The cache references the data, the next write of this text copies it. */
+		const cbFontRequests* Requests = cbFreeTypeFontFamily::GetBoundRequests();
+		if (bUseLayoutCache && (!Requests || Requests->IsEmpty()))
+			cbTextLayoutCache::Get().Add(Key, Data);
 	}
 
-	void cbFontGeometry::SetText(const std::u32string& Text, const std::optional<cbTextDesc> Desc)
+	void cbFontGeometry::SetStyledText(const std::u32string& Text, const std::vector<cbTextStyleRun>& Runs, const std::optional<cbTextDesc> Desc)
 	{
 		if (Desc.has_value())
 		{
 			TextDesc = Desc.value();
 
-			TextMetrics.FontSize = TextDesc.CharSize;
-			TextMetrics.FontType = TextDesc.FontType;
+			TextMetrics().FontSize = TextDesc.CharSize;
+			TextMetrics().FontType = TextDesc.FontType;
 		}
 
-		ParseCharacters(Text);
+		TextMetrics().StyleRuns = Runs;
+		TextMetrics().bIsStyleRunsPrecompiled = true;
+
+		ParseCharacters(std::u32string(Text));
 		UpdateAlignments();
 		UpdateGeometry();
 	}
 
 	void cbFontGeometry::AppendText(const std::u32string& Text)
 	{
-		std::size_t i = 0;
-		for (const auto& Char : Text)
-		{
-			cbTextMetrics::cbCharacter Character(Char, TextMetrics.FontSize, TextMetrics.FontType, i, !((Char != '\n') && Char >= 32));
-			BuildCharacter(&Character);
-			TextMetrics.Characters.push_back(Character);
-			i++;
-		}
+		std::u32string Codepoints = std::move(TextMetrics().Characters.Codepoints);
+		Codepoints += Text;
+		ParseCharacters(std::move(Codepoints));
+		UpdateAlignments();
+		UpdateGeometry();
+	}
 
-		ParseCharacters(TextMetrics.GetText());
+	void cbFontGeometry::AppendTextUtf8(const std::string_view& Text)
+	{
+		std::u32string Codepoints = std::move(TextMetrics().Characters.Codepoints);
+		DecodeUtf8(Text, Codepoints);
+		ParseCharacters(std::move(Codepoints));
 		UpdateAlignments();
 		UpdateGeometry();
 	}
 
 	void cbFontGeometry::Clear()
 	{
-		TextMetrics.Characters.clear();
-		TextMetrics.LineMetaData.clear();
-		TextMetrics.WordMetaData.clear();
+		TextMetrics().Release();
 		UpdateAlignments();
 		UpdateGeometry();
 	}
 
 	void cbFontGeometry::RebuildText()
 	{
-		ParseCharacters(TextMetrics.GetText());
+		ParseCharacters(TextMetrics().GetText());
 		UpdateAlignments();
 		UpdateGeometry();
 	}
@@ -929,251 +1860,304 @@ namespace cbgui
 		UpdateBounds();
 	}
 
+	void cbFontGeometry::GetAscenderDescender(const std::size_t Size, const eFontType Type, int& outAscender, int& outDescender) const
+	{
+		outAscender = FontFamily->GetAscender(Size, Type);
+		outDescender = FontFamily->GetDescender(Size, Type);
+		if (TextMetrics().bIsAscenderDescenderPowerOfTwo && outAscender % 2)
+			outAscender += 1;
+		if (TextMetrics().bIsAscenderDescenderPowerOfTwo && outDescender % 2)
+			outDescender -= 1;
+	}
+
 	void cbFontGeometry::UpdateHorizontalAlignment()
 	{
-		TextMetrics.WordMetaData.clear();
+		TextMetrics().WordMetaData.clear();
+
+		auto& Characters = TextMetrics().Characters;
 
-		std::optional<cbTextMetrics::cbCharacter> PastChar;
+		std::optional<char32_t> PastChar;
 		float X = 0.0f;
 		std::size_t WordCounter = 0;
+		std::size_t WordStartIndex = 0;
 		float TotalWidth = 0.0f;
 		float WordWidth = 0.0f;
+		std::optional<float> WordStart;
+		int WordAscender = 0;
+		int WordDescender = 0;
 
-		for (std::size_t i = 0; i < TextMetrics.Characters.size(); i++)
+		const auto PushWord = [&](const std::size_t LastIndex, const bool bEndsWithNewLine)
 		{
-			auto& Character = TextMetrics.Characters.at(i);
+			TextMetrics().WordMetaData.push_back(cbTextMetrics::cbWordMetaData(WordCounter, TotalWidth - WordWidth, WordWidth + ((TotalWidth - WordWidth) / 2.0f),
+				WordStartIndex, LastIndex, WordStart.has_value() ? WordStart.value() : X, WordAscender, WordDescender, bEndsWithNewLine));
 
-			if (Character.ignore && !Character.IsNewLine())
-			{
-				if (i == (TextMetrics.Characters.size() - 1))
-				{
-					TextMetrics.WordMetaData.push_back(cbTextMetrics::cbWordMetaData(WordCounter, TotalWidth - WordWidth, WordWidth + ((TotalWidth - WordWidth) / 2.0f)));
+			WordWidth = TotalWidth;
+			WordStartIndex = LastIndex + 1;
+			WordStart = std::nullopt;
+			WordAscender = 0;
+			WordDescender = 0;
+			WordCounter++;
+		};
 
-					WordWidth = TotalWidth;
-					WordCounter++;
-				}
+		for (std::size_t i = 0; i < Characters.size(); i++)
+		{
+			const char32_t Character = Characters.Codepoints[i];
+			const bool bIsNewLine = Characters.IsNewLine(i);
+
+			if (Characters.IsIgnored(i) && !bIsNewLine)
+			{
+				Characters.WordOrders[i] = (std::uint32_t)WordCounter;
+				if (i == (Characters.size() - 1))
+					PushWord(i, false);
 				continue;
 			}
 
-			if (PastChar.has_value())
-				X += FontFamily->GetKerning(PastChar->Character, Character.Character, Character.CharacterSize, Character.Type);
-
-			Character.WordOrder = WordCounter;
-			Character.Kerning = X;
-			Character.AlignedKerning = Character.Kerning;
+			if (PastChar.has_value() && TabularCharacters.size() == 0)
+				X += FontFamily->GetKerning(PastChar.value(), Character, Characters.CharacterSizes[i], Characters.Types[i]);
 
-			TotalWidth = Character.Bounds.Max.X + Character.AlignedKerning;
+			Characters.WordOrders[i] = (std::uint32_t)WordCounter;
+			Characters.Kernings[i] = X;
+			Characters.AlignedKernings[i] = X;
 
-			X += Character.xadvance;
+			X += Characters.XAdvances[i];
 
 			PastChar = Character;
 
-			if (Character.IsSpace() || i == (TextMetrics.Characters.size() - 1))
+			if (!bIsNewLine)
 			{
-				TextMetrics.WordMetaData.push_back(cbTextMetrics::cbWordMetaData(WordCounter, TotalWidth - WordWidth, WordWidth + ((TotalWidth - WordWidth) / 2.0f)));
+				TotalWidth = Characters.Bounds[i].Max.X + Characters.Kernings[i];
+
+				if (!WordStart.has_value())
+					WordStart = Characters.Kernings[i];
+
+				/* Ascender/Descender is cached in the character by BuildCharacter. */
+				int Asc = Characters.Ascenders[i];
+				int Desc = Characters.Descenders[i];
+				if (Asc == 0 && Desc == 0)
+				{
+					GetAscenderDescender(Characters.CharacterSizes[i], Characters.Types[i], Asc, Desc);
+				}
+				else
+				{
+					if (TextMetrics().bIsAscenderDescenderPowerOfTwo && Asc % 2)
+						Asc += 1;
+					if (TextMetrics().bIsAscenderDescenderPowerOfTwo && Desc % 2)
+						Desc -= 1;
+				}
 
-				WordWidth = TotalWidth;
-				WordCounter++;
+				WordAscender = WordAscender < Asc ? Asc : WordAscender;
+				WordDescender = WordDescender > Desc ? Desc : WordDescender;
 			}
+
+			if (bIsNewLine || Characters.IsSpace(i) || i == (Characters.size() - 1))
+				PushWord(i, bIsNewLine);
 		}
 	}
 
 	void cbFontGeometry::UpdateVerticalAlignment()
 	{
-		TextMetrics.LineMetaData.clear();
+		TextMetrics().LineMetaData.clear();
+
+		auto& Characters = TextMetrics().Characters;
 
 		int Ascender = 0;
 		int Descender = 0;
 		float PrevLineDescender = 0.0f;
 		float Baseline = 0.0f;
 		std::size_t Linecounter = 0;
-		float TotalKerning = 0.0f;
-		float KerningOffset = 0.0f;
-		float TotalWidth = 0.0f;
-		float LineWidth = 0.0f;
-		std::size_t CurrentWordIndex = 0;
-		cbTextMetrics::cbCharacter PastChar;
+		float LineStart = 0.0f;
+		float LineEnd = 0.0f;
+		bool bIsLineEmpty = true;
 
 		const float WrapWith = bAutoWrapText ? GetAutoWrapWidth() : 0.0f;
 
-		for (std::size_t i = 0; i < TextMetrics.Characters.size(); i++)
+		const auto PushLine = [&]()
 		{
-			auto& Character = TextMetrics.Characters.at(i);
-
-			if (Character.ignore && !Character.IsNewLine())
-			{
-				Character.LineOrder = Linecounter;
-				if (i == (TextMetrics.Characters.size() - 1))
-				{
-					Baseline += Linecounter != 0 ? (Ascender * LineHeightPercentage) - PrevLineDescender : Ascender - PrevLineDescender;
-					TextMetrics.LineMetaData.push_back(cbTextMetrics::cbLineMetaData(Linecounter, TotalWidth - LineWidth, Ascender, Descender, Baseline, 0.0f));
-
-					CurrentWordIndex = Character.WordOrder;
-					PrevLineDescender = Descender * LineHeightPercentage;
-					Ascender = 0;
-					Descender = 0;
+			Baseline += Linecounter != 0 ? (Ascender * LineHeightPercentage) - PrevLineDescender : Ascender - PrevLineDescender;
+			TextMetrics().LineMetaData.push_back(cbTextMetrics::cbLineMetaData(Linecounter, LineEnd - LineStart, Ascender, Descender, Baseline, 0.0f));
 
-					LineWidth = TotalWidth;
-					KerningOffset = TotalKerning;
+			PrevLineDescender = Descender * LineHeightPercentage;
+			Ascender = 0;
+			Descender = 0;
+			bIsLineEmpty = true;
 
-					Linecounter++;
-				}
-				continue;
-			}
-
-			Character.AlignedKerning = Character.Kerning;
-			TotalWidth = Character.Bounds.Max.X + Character.AlignedKerning;
-
-			TotalKerning = Character.AlignedKerning;
-			Character.AlignedKerning -= KerningOffset;
+			Linecounter++;
+		};
 
-			Character.LineOrder = Linecounter;
+		/*
+		* Single pass over the words. Kerning is absolute and computed once in UpdateHorizontalAlignment,
+		* a word keeps its relative character positions and only the line offset changes.
+		*/
+		for (const auto& Word : TextMetrics().WordMetaData)
+		{
+			const float WordEnd = Word.GetLeft();
 
-			PastChar = Character;
+			if (bAutoWrapText && !bIsLineEmpty && (WordEnd - LineStart) > WrapWith)
+				PushLine();
 
-			if (!Character.IsNewLine() || (Character.IsNewLine() && (Ascender == 0 && Descender == 0)))
+			if (bIsLineEmpty)
 			{
-				int Asc = FontFamily->GetAscender(Character.CharacterSize, Character.Type);
-				int Desc = FontFamily->GetDescender(Character.CharacterSize, Character.Type);
-				if (TextMetrics.bIsAscenderDescenderPowerOfTwo && Asc % 2)
-					Asc += 1;
-				if (TextMetrics.bIsAscenderDescenderPowerOfTwo && Desc % 2)
-					Desc -= 1;
-
-				Ascender = Ascender < Asc ? Asc : Ascender;
-				Descender = Descender > Desc ? Desc : Descender;
+				LineStart = Word.Start;
+				LineEnd = Word.Start;
+				bIsLineEmpty = false;
 			}
 
-			if (Character.IsNewLine() || i == (TextMetrics.Characters.size() - 1))
+			for (std::size_t i = Word.FirstCharacter; i <= Word.LastCharacter && i < Characters.size(); i++)
 			{
-				Baseline += Linecounter != 0 ? (Ascender * LineHeightPercentage) - PrevLineDescender : Ascender - PrevLineDescender;
-				TextMetrics.LineMetaData.push_back(cbTextMetrics::cbLineMetaData(Linecounter, TotalWidth - LineWidth, Ascender, Descender, Baseline, 0.0f));
-
-				CurrentWordIndex = Character.WordOrder;
-				PrevLineDescender = Descender * LineHeightPercentage;
-				Ascender = 0;
-				Descender = 0;
-
-				LineWidth = TotalWidth;
-				KerningOffset = TotalKerning;
-
-				Linecounter++;
+				Characters.LineOrders[i] = (std::uint32_t)Linecounter;
+				if (!Characters.IsIgnored(i) || Characters.IsNewLine(i))
+					Characters.AlignedKernings[i] = Characters.Kernings[i] - LineStart;
 			}
-			else if ((bAutoWrapText &&
-				Character.WordOrder != CurrentWordIndex && Character.WordOrder != 0 && (TextMetrics.WordMetaData.at(Character.WordOrder).GetLeft() - KerningOffset) > WrapWith))
-				//((Character.Bounds.Min.X + Character.AlignedKerning) > TextMetrics.AutoWrapWidth)))
-			{
-				Character.AlignedKerning = 0;
-
-				Baseline += Linecounter != 0 ? (Ascender * LineHeightPercentage) - PrevLineDescender : Ascender - PrevLineDescender;
-				TextMetrics.LineMetaData.push_back(cbTextMetrics::cbLineMetaData(Linecounter, TotalWidth - LineWidth, Ascender, Descender, Baseline, 0.0f));
 
-				CurrentWordIndex = Character.WordOrder;
-				PrevLineDescender = Descender * LineHeightPercentage;
-				Ascender = 0;
-				Descender = 0;
+			LineEnd = LineEnd < WordEnd ? WordEnd : LineEnd;
+			Ascender = Ascender < Word.Ascender ? Word.Ascender : Ascender;
+			Descender = Descender > Word.Descender ? Word.Descender : Descender;
 
-				LineWidth = TotalWidth;
-				KerningOffset = TotalKerning;
-
-				Linecounter++;
-				Character.LineOrder = Linecounter;
+			if (Word.bEndsWithNewLine)
+			{
+				if (Ascender == 0 && Descender == 0)
+					GetAscenderDescender(Characters.CharacterSizes[Word.LastCharacter], Characters.Types[Word.LastCharacter], Ascender, Descender);
+				PushLine();
 			}
 		}
 
-		if (PastChar.IsNewLine())
+		if (!bIsLineEmpty)
+			PushLine();
+
+		if (Characters.size() > 0 && Characters.IsNewLine(Characters.size() - 1))
 		{
-			int Asc = FontFamily->GetAscender(TextMetrics.FontSize, TextMetrics.FontType);
-			int Desc = FontFamily->GetDescender(TextMetrics.FontSize, TextMetrics.FontType);
-			if (TextMetrics.bIsAscenderDescenderPowerOfTwo && Asc % 2)
-				Asc += 1;
-			if (TextMetrics.bIsAscenderDescenderPowerOfTwo && Desc % 2)
-				Desc -= 1;
+			int Asc = 0;
+			int Desc = 0;
+			GetAscenderDescender(TextMetrics().FontSize, TextMetrics().FontType, Asc, Desc);
 
 			Baseline += Linecounter != 0 ? (Asc * LineHeightPercentage) - PrevLineDescender : Asc - PrevLineDescender;
-			TextMetrics.LineMetaData.push_back(cbTextMetrics::cbLineMetaData(Linecounter, TotalWidth - LineWidth, Asc, Desc, Baseline, 0.0f));
+			TextMetrics().LineMetaData.push_back(cbTextMetrics::cbLineMetaData(Linecounter, 0.0f, Asc, Desc, Baseline, 0.0f));
 		}
 	}
 
-	void cbFontGeometry::ParseCharacters(const std::u32string& pText)
+	void cbFontGeometry::ReWrap()
+	{
+		UpdateVerticalAlignment();
+		UpdateBounds();
+		UpdateGeometry();
+	}
+
+	void cbFontGeometry::ParseCharacters(std::u32string&& pText)
 	{
-		std::vector<std::size_t> CharsToSkip;
-		std::map<std::size_t, std::size_t> CharStyles;
+		TextMetrics().Characters.Assign(std::move(pText), TextMetrics().FontSize, TextMetrics().FontType);
 
-		if (TextMetrics.bIsTextStylingEnabled)
+		if (!TextMetrics().bIsStyleRunsPrecompiled)
 		{
-			std::size_t StyleTagStart = 0;
-			std::size_t StyleTagEnd = 0;
-			std::size_t StyleIndex = 0;
+			TextMetrics().StyleRuns.clear();
+			if (TextMetrics().bIsTextStylingEnabled)
+				ParseStyleTags(TextMetrics().Characters.Codepoints);
+		}
 
-			while (true)
-			{
-				if (TextMetrics.TextStyles.size() == 0)
-					break;
+		ApplyStyleRuns();
+		BuildText();
+	}
 
-				StyleTagStart = pText.find(TextMetrics.TextStyles[StyleIndex].GetStyleStartTag(), StyleTagStart);
-				StyleTagEnd = pText.find(TextMetrics.TextStyles[StyleIndex].GetStyleEndTag(), StyleTagStart);
+	void cbFontGeometry::ParseStyleTags(const std::u32string& pText)
+	{
+		if (TextMetrics().TextStyles.size() == 0)
+			return;
 
-				if ((StyleTagStart == std::wstring::npos) || (StyleTagEnd == std::wstring::npos))
-				{
-					StyleTagStart = 0;
-					StyleTagEnd = 0;
+		/* If two styles have the same name, the first one is used. The keys view the names of the text styles. */
+		std::unordered_map<std::u32string_view, std::size_t> StyleNames;
+		std::size_t MaxNameLength = 0;
+		for (std::size_t i = 0; i < TextMetrics().TextStyles.size(); i++)
+		{
+			const auto& Name = TextMetrics().TextStyles[i].Name;
+			StyleNames.insert({ Name, i });
+			MaxNameLength = std::max(MaxNameLength, Name.size());
+		}
 
-					StyleIndex++;
-					if (StyleIndex >= TextMetrics.TextStyles.size())
-						break;
+		struct cbOpenTag
+		{
+			std::size_t StyleIndex;
+			std::size_t TagStart;
+			std::size_t ContentStart;
+		};
+		std::vector<cbOpenTag> OpenTags;
 
-					continue;
-				}
+		const std::u32string_view Text(pText);
+		const std::u32string_view EndTag = U"</>";
+
+		/*
+		* Single pass. Start tags are pushed and popped by the end tag "</>", a run is emitted when the tag is closed.
+		* Tags that are never closed stay as visible text.
+		*/
+		std::size_t i = 0;
+		while (i < pText.size())
+		{
+			if (pText[i] != '<')
+			{
+				i++;
+				continue;
+			}
 
-				StyleTagStart += TextMetrics.TextStyles[StyleIndex].GetStyleStartTag().size();
+			if (OpenTags.size() > 0 && Text.substr(i, EndTag.size()) == EndTag)
+			{
+				const cbOpenTag Tag = OpenTags.back();
+				OpenTags.pop_back();
 
-				std::u32string substring(pText.substr(StyleTagStart, StyleTagEnd - StyleTagStart));
+				TextMetrics().StyleRuns.push_back(cbTextStyleRun(Tag.ContentStart, i - Tag.ContentStart, Tag.StyleIndex));
 
-				for (std::size_t i = StyleTagStart - TextMetrics.TextStyles[StyleIndex].GetStyleStartTag().size(); i < StyleTagStart; i++)
-				{
-					CharsToSkip.push_back(i);
-				}
+				for (std::size_t j = Tag.TagStart; j < Tag.ContentStart; j++)
+					TextMetrics().Characters.SetIgnored(j, true);
+				for (std::size_t j = i; j < i + EndTag.size(); j++)
+					TextMetrics().Characters.SetIgnored(j, true);
 
-				for (std::size_t i = StyleTagEnd; i < StyleTagEnd + TextMetrics.TextStyles[StyleIndex].GetStyleEndTag().size(); i++)
-				{
-					CharsToSkip.push_back(i);
-				}
+				i += EndTag.size();
+				continue;
+			}
 
-				for (std::size_t i = StyleTagStart; i < StyleTagEnd; i++)
+			/* Names are not longer than MaxNameLength, the search stops after the longest possible tag. */
+			const std::size_t TagEnd = Text.substr(0, std::min(Text.size(), i + MaxNameLength + 2)).find('>', i + 1);
+			if (TagEnd != std::u32string_view::npos)
+			{
+				const auto Style = StyleNames.find(Text.substr(i + 1, TagEnd - i - 1));
+				if (Style != StyleNames.end())
 				{
-					CharStyles.insert({ i, StyleIndex });
+					OpenTags.push_back(cbOpenTag{ Style->second, i, TagEnd + 1 });
+					i = TagEnd + 1;
+					continue;
 				}
 			}
+
+			i++;
 		}
+	}
 
-		TextMetrics.Characters.clear();
-		std::size_t i = 0;
-		for (const auto& Char : pText)
+	void cbFontGeometry::ApplyStyleRuns()
+	{
+		auto& Characters = TextMetrics().Characters;
+
+		/* Runs are ordered from inner to outer, the innermost style wins. */
+		for (auto Run = TextMetrics().StyleRuns.rbegin(); Run != TextMetrics().StyleRuns.rend(); Run++)
 		{
-			cbTextMetrics::cbCharacter Character(Char, TextMetrics.FontSize, TextMetrics.FontType, i, !((Char != '\n') && Char >= 32));
-			if (CharStyles.find(i) != CharStyles.end())
+			if (Run->StyleIndex >= TextMetrics().TextStyles.size())
+				continue;
+
+			const auto& TextStyle = TextMetrics().TextStyles[Run->StyleIndex];
+			const std::size_t End = std::min(Run->Start + Run->Length, Characters.size());
+			for (std::size_t i = Run->Start; i < End; i++)
 			{
-				const auto& TextStyle = TextMetrics.GetTextStyle(CharStyles[i]);
-				Character.CharacterSize = TextStyle->FontSize;
-				Character.Type = TextStyle->FontType;
-				if (TextStyle->Color.has_value())
-					Character.Color = TextStyle->Color.value();
+				Characters.CharacterSizes[i] = (std::uint16_t)TextStyle.FontSize;
+				Characters.Types[i] = TextStyle.FontType;
+				if (TextStyle.Color.has_value())
+					Characters.SetColor(i, TextStyle.Color);
 			}
-			if (std::find(CharsToSkip.begin(), CharsToSkip.end(), i) != CharsToSkip.end())
-				Character.ignore = true;
-
-			BuildCharacter(&Character);
-			TextMetrics.Characters.push_back(Character);
-			i++;
 		}
 	}
 
 	void cbFontGeometry::BuildText()
 	{
-		for (auto& Character : TextMetrics.Characters)
+		UpdateTabularAdvance();
+
+		for (std::size_t i = 0; i < TextMetrics().Characters.size(); i++)
 		{
-			BuildCharacter(&Character);
+			BuildCharacter(i);
 		}
 	}
 
@@ -1182,23 +2166,37 @@ namespace cbgui
 		return FontFamily->GetGlyph(Type, Size, ch);
 	}
 
-	bool cbFontGeometry::BuildCharacter(cbTextMetrics::cbCharacter* Character)
+	bool cbFontGeometry::BuildCharacter(const std::size_t Index)
 	{
-		if (!Character->IsValid())
+		auto& Characters = TextMetrics().Characters;
+
+		if (!Characters.IsValid(Index))
 			return false;
 
-		if (!FontFamily->IsCharExist(Character->Type, Character->CharacterSize, Character->Character))
-			if (!FontFamily->CreateChar(Character->Type, Character->CharacterSize, Character->Character))
+		const char32_t Character = Characters.Codepoints[Index];
+		const std::size_t CharacterSize = Characters.CharacterSizes[Index];
+		const eFontType Type = Characters.Types[Index];
+
+		if (!FontFamily->IsCharExist(Type, CharacterSize, Character))
+			if (!FontFamily->CreateChar(Type, CharacterSize, Character))
 				return false;
 
-		if (const cbGlyph* Glyph = GetGlyph(Character->Type, Character->CharacterSize, Character->Character))
+		if (const cbGlyph* Glyph = GetGlyph(Type, CharacterSize, Character))
 		{
 			const float X = 0.0f;
 			const float Y = 0.0f;
 
 			cbBounds CharRect(cbVector(X + Glyph->BearingX, Y - Glyph->BearingY), cbVector(X + Glyph->BearingX + Glyph->Width, Y + Glyph->Height - Glyph->BearingY));
 
-			const int xadvance = DefaultSpaceWidth.has_value() && (Character->Character == 32) ? (int)DefaultSpaceWidth.value() : Glyph->xadvance;
+			int xadvance = DefaultSpaceWidth.has_value() && (Character == 32) ? (int)DefaultSpaceWidth.value() : Glyph->xadvance;
+
+			if (TabularCharacters.size() > 0)
+			{
+				const float CellOffset = std::floor((TabularAdvance - xadvance) / 2.0f);
+				CharRect.Min.X += CellOffset;
+				CharRect.Max.X += CellOffset;
+				xadvance = TabularAdvance;
+			}
 
 			if (CharRect.Min.X == CharRect.Max.X)
 				CharRect.Max.X += xadvance;
@@ -1211,126 +2209,318 @@ namespace cbgui
 			CharRect.Max.Y += FontFamily->GetDesc().CharPadding.Bottom;
 			CharRect.Max.X += FontFamily->GetDesc().CharPadding.Right;
 
-			Character->Bounds = CharRect;
+			Characters.Bounds[Index] = CharRect;
+
+			Characters.Ascenders[Index] = (std::int16_t)FontFamily->GetAscender(CharacterSize, Type);
+			Characters.Descenders[Index] = (std::int16_t)FontFamily->GetDescender(CharacterSize, Type);
+
+			Characters.XAdvances[Index] = (std::int16_t)xadvance;
+			Characters.BearingXs[Index] = (std::int16_t)Glyph->BearingX;
+
+			/* Glyphs are shared between threads while a request list is bound. */
+			if (!cbFreeTypeFontFamily::GetBoundRequests())
+				Glyph->FontTextureGlyphData->LastUsedFrame = FontFamily->GetFrameIndex();
+			Characters.TextureCoordinates[Index] = GetCharacterTextureCoordinate(Glyph);
+		}
+
+		return true;
+	}
+
+	cbBounds cbFontGeometry::GetCharacterTextureCoordinate(const cbGlyph* Glyph) const
+	{
+		const cbBounds& TextureCoordinate = Glyph->FontTextureGlyphData->GenerateTextureCoordinate();
 
-			Character->Ascender = FontFamily->GetAscender(Character->CharacterSize, Character->Type);
-			Character->Descender = FontFamily->GetDescender(Character->CharacterSize, Character->Type);
+		const cbMargin& Padding = FontFamily->GetDesc().CharPadding;
 
-			Character->xadvance = xadvance;
-			Character->BearingX = Glyph->BearingX;
+		const unsigned int mip = 0;
+		int32_t mipWidth = std::max(1U, (unsigned int)(FontFamily->GetDesc().AtlasWidth >> mip));
+		uint32_t mipHeight = std::max(1U, (unsigned int)(FontFamily->GetDesc().AtlasHeight >> mip));
 
+		const float invWidth = 1.0f / mipWidth;
+		const float invHeight = 1.0f / mipHeight;
+
+		return cbBounds(cbVector((TextureCoordinate.Min.X - Padding.Left) * invWidth, (TextureCoordinate.Min.Y - Padding.Top) * invHeight),
+			cbVector((TextureCoordinate.Max.X - Padding.Right) * invWidth, (TextureCoordinate.Max.Y - Padding.Bottom) * invHeight));
+	}
+
+	void cbFontGeometry::MarkUsedGlyphs(const std::uint64_t FrameIndex) const
+	{
+		const auto& Characters = TextMetrics().Characters;
+		for (std::size_t i = 0; i < Characters.size(); i++)
+		{
+			if (const cbGlyph* Glyph = GetGlyph(Characters.Types[i], Characters.CharacterSizes[i], Characters.Codepoints[i]))
 			{
-				const cbBounds& TextureCoordinate = Glyph->FontTextureGlyphData->GenerateTextureCoordinate();
+				if (Glyph->FontTextureGlyphData)
+					Glyph->FontTextureGlyphData->LastUsedFrame = FrameIndex;
+			}
+		}
+	}
+
+	void cbFontGeometry::FontAtlasRemapped()
+	{
+		/* Every geometry that shares the data gets the same coordinates, the data is patched without copying it. */
+		cbGeometryData& Geometry = *Data;
+		auto& Characters = Geometry.TextMetrics.Characters;
+
+		std::size_t Vertex = 0;
+		for (std::size_t i = 0; i < Characters.size(); i++)
+		{
+			if (!Characters.IsValid(i))
+				continue;
+
+			if (const cbGlyph* Glyph = GetGlyph(Characters.Types[i], Characters.CharacterSizes[i], Characters.Codepoints[i]))
+				Characters.TextureCoordinates[i] = GetCharacterTextureCoordinate(Glyph);
+
+			/* Same order as UpdateTextureCoordinates, the vertex layout does not change. */
+			if (!Characters.IsVisible(i) || Characters.LineOrders[i] >= Geometry.TextMetrics.LineMetaData.size())
+				continue;
+
+			if (Vertex + 4 > Geometry.TextureCoordinates.size())
+				break;
+
+			const cbBounds& Char = Characters.TextureCoordinates[i];
+			Geometry.TextureCoordinates[Vertex] = cbVector(Char.Min.X, Char.Min.Y);
+			Geometry.TextureCoordinates[Vertex + 1] = cbVector(Char.Max.X, Char.Min.Y);
+			Geometry.TextureCoordinates[Vertex + 2] = cbVector(Char.Max.X, Char.Max.Y);
+			Geometry.TextureCoordinates[Vertex + 3] = cbVector(Char.Min.X, Char.Max.Y);
+			Vertex += 4;
+		}
+
+		if (Owner)
+			Owner->NotifyCanvas_WidgetUpdated();
+	}
+
+	void cbFontGeometry::UpdateTabularAdvance()
+	{
+		TabularAdvance = 0;
+		const eFontType FontType = Data->TextMetrics.FontType;
+		const std::size_t FontSize = Data->TextMetrics.FontSize;
+		for (const char32_t Character : TabularCharacters)
+		{
+			if (!FontFamily->IsCharExist(FontType, FontSize, Character))
+				if (!FontFamily->CreateChar(FontType, FontSize, Character))
+					continue;
+
+			if (const cbGlyph* Glyph = GetGlyph(FontType, FontSize, Character))
+				TabularAdvance = std::max(TabularAdvance, (int)Glyph->xadvance);
+		}
+	}
 
-				const cbMargin& Padding = FontFamily->GetDesc().CharPadding;
+	void cbFontGeometry::SetTabularCharacters(const std::u32string& Characters)
+	{
+		if (TabularCharacters == Characters)
+			return;
+
+		TabularCharacters = Characters;
+		RebuildText();
+	}
+
+	bool cbFontGeometry::ReplaceChar(const std::size_t Index, const char32_t Character)
+	{
+		auto& Characters = TextMetrics().Characters;
+		const std::size_t LineCount = TextMetrics().LineMetaData.size();
+
+		if (Index >= Characters.size() || !Characters.IsVisible(Index) || Characters.LineOrders[Index] >= LineCount)
+			return false;
 
-				const unsigned int mip = 0;
-				int32_t mipWidth = std::max(1U, (unsigned int)(FontFamily->GetDesc().AtlasWidth >> mip));
-				uint32_t mipHeight = std::max(1U, (unsigned int)(FontFamily->GetDesc().AtlasHeight >> mip));
+		/* The new character must have a quad as well, otherwise the vertex layout changes. */
+		if (Character == '\n' || Character <= 32)
+			return false;
+
+		if (Characters.Codepoints[Index] == Character)
+			return true;
 
-				const float invWidth = 1.0f / mipWidth;
-				const float invHeight = 1.0f / mipHeight;
+		Characters.Codepoints[Index] = Character;
+		if (!BuildCharacter(Index))
+		{
+			Characters.Bounds[Index] = cbBounds(cbVector::Zero(), cbVector::Zero());
+			Characters.TextureCoordinates[Index] = cbBounds(cbVector::Zero(), cbVector::Zero());
+		}
 
-				Character->TextureCoordinates = cbBounds(cbVector((TextureCoordinate.Min.X - Padding.Left) * invWidth, (TextureCoordinate.Min.Y - Padding.Top) * invHeight),
-														 cbVector((TextureCoordinate.Max.X - Padding.Right) * invWidth, (TextureCoordinate.Max.Y - Padding.Bottom) * invHeight));
+		std::size_t Quad = Index;
+		if (Characters.GetFilteredSize() != Characters.size())
+		{
+			Quad = 0;
+			for (std::size_t i = 0; i < Index; i++)
+			{
+				if (Characters.IsVisible(i) && Characters.LineOrders[i] < LineCount)
+					Quad++;
 			}
 		}
 
+		const std::size_t Vertex = Quad * 4;
+		if (Vertex + 4 > Vertices().size() || Vertex + 4 > TextureCoordinates().size())
+			return false;
+
+		const float Baseline = TextMetrics().LineMetaData[Characters.LineOrders[Index]].Baseline;
+		const float Kerning = Characters.AlignedKernings[Index];
+		const cbBounds& Bounds = Characters.Bounds[Index];
+		Vertices()[Vertex] = cbVector4(Bounds.Min.X + Kerning, Bounds.Min.Y + Baseline, 0.0f);
+		Vertices()[Vertex + 1] = cbVector4(Bounds.Max.X + Kerning, Bounds.Min.Y + Baseline, 0.0f);
+		Vertices()[Vertex + 2] = cbVector4(Bounds.Max.X + Kerning, Bounds.Max.Y + Baseline, 0.0f);
+		Vertices()[Vertex + 3] = cbVector4(Bounds.Min.X + Kerning, Bounds.Max.Y + Baseline, 0.0f);
+
+		const cbBounds& UV = Characters.TextureCoordinates[Index];
+		TextureCoordinates()[Vertex] = cbVector(UV.Min.X, UV.Min.Y);
+		TextureCoordinates()[Vertex + 1] = cbVector(UV.Max.X, UV.Min.Y);
+		TextureCoordinates()[Vertex + 2] = cbVector(UV.Max.X, UV.Max.Y);
+		TextureCoordinates()[Vertex + 3] = cbVector(UV.Min.X, UV.Max.Y);
+
+		return true;
+	}
+
+	bool cbFontGeometry::IsVertexColorsUpToDate() const
+	{
+		const auto& Characters = Data->TextMetrics.Characters;
+		const auto& VertexColors = Data->VertexColors;
+
+		std::size_t i = 0;
+		for (std::size_t Index = 0; Index < Characters.size(); Index++)
+		{
+			if (!Characters.IsVisible(Index))
+				continue;
+
+			if (Characters.LineOrders[Index] >= Data->TextMetrics.LineMetaData.size())
+				continue;
+
+			if (i + 4 > VertexColors.size())
+				return false;
+
+			const cbColor Color = Characters.ColorIndices[Index] != cbTextMetrics::cbCharacterArray::NoColor ? Characters.Colors[Characters.ColorIndices[Index]] : Style->GetColor();
+			for (std::size_t j = i; j < i + 4; j++)
+			{
+				if (VertexColors[j].R != Color.R || VertexColors[j].G != Color.G || VertexColors[j].B != Color.B || VertexColors[j].A != Color.A)
+					return false;
+			}
+			i += 4;
+		}
 		return true;
 	}
 
 	void cbFontGeometry::UpdateVertexColors()
 	{
+		/* A shared layout is only copied if the colors of this text differ. */
+		if (Data.use_count() > 1 && IsVertexColorsUpToDate())
+			return;
+
+		cbGeometryData& Geometry = MakeUnique();
+		const auto& Characters = Geometry.TextMetrics.Characters;
+
 		std::size_t i = 0;
-		for (const auto& Char : TextMetrics.Characters)
+		for (std::size_t Index = 0; Index < Characters.size(); Index++)
 		{
-			if (!Char.IsValid() || Char.IsSpace())
+			if (!Characters.IsVisible(Index))
 				continue;
 
-			if (Char.LineOrder >= TextMetrics.LineMetaData.size())
+			if (Characters.LineOrders[Index] >= Geometry.TextMetrics.LineMetaData.size())
 				continue;
 
-			if (Char.Color.has_value())
+			const cbColor Color = Characters.ColorIndices[Index] != cbTextMetrics::cbCharacterArray::NoColor ? Characters.Colors[Characters.ColorIndices[Index]] : Style->GetColor();
+			if (Geometry.VertexColors.size() > i)
 			{
-				const cbColor& Color = Char.Color.value();
-				{
-					if (VertexColors.size() > i)
-					{
-						VertexColors[i] = Color;
-						VertexColors[i + 1] = Color;
-						VertexColors[i + 2] = Color;
-						VertexColors[i + 3] = Color;
-						i += 4;
-					}
-					else
-					{
-						VertexColors.push_back(Color);
-						VertexColors.push_back(Color);
-						VertexColors.push_back(Color);
-						VertexColors.push_back(Color);
-						i += 4;
-					}
-				}
+				Geometry.VertexColors[i] = Color;
+				Geometry.VertexColors[i + 1] = Color;
+				Geometry.VertexColors[i + 2] = Color;
+				Geometry.VertexColors[i + 3] = Color;
+				i += 4;
 			}
 			else
 			{
-				if (VertexColors.size() > i)
-				{
-					VertexColors[i] = Style.GetColor();
-					VertexColors[i + 1] = Style.GetColor();
-					VertexColors[i + 2] = Style.GetColor();
-					VertexColors[i + 3] = Style.GetColor();
-					i += 4;
-				}
-				else
-				{
-					VertexColors.push_back(Style.GetColor());
-					VertexColors.push_back(Style.GetColor());
-					VertexColors.push_back(Style.GetColor());
-					VertexColors.push_back(Style.GetColor());
-					i += 4;
-				}
+				Geometry.VertexColors.push_back(Color);
+				Geometry.VertexColors.push_back(Color);
+				Geometry.VertexColors.push_back(Color);
+				Geometry.VertexColors.push_back(Color);
+				i += 4;
 			}
 		}
 	}
 
 	void cbFontGeometry::UpdateTextureCoordinates()
 	{
-		TextureCoordinates.clear();
-		for (const auto& Character : TextMetrics.Characters)
+		cbGeometryData& Geometry = MakeUnique();
+		const auto& Characters = Geometry.TextMetrics.Characters;
+
+		Geometry.TextureCoordinates.clear();
+		Geometry.TextureCoordinates.reserve(Characters.GetFilteredSize() * 4);
+		for (std::size_t i = 0; i < Characters.size(); i++)
 		{
-			if (Character.IsValid() && !Character.IsSpace())
-			{
-				if (Character.LineOrder >= TextMetrics.LineMetaData.size())
-					continue;
+			if (!Characters.IsVisible(i))
+				continue;
 
-				const cbBounds& Char = Character.TextureCoordinates;
-				TextureCoordinates.push_back(cbVector(Char.Min.X, Char.Min.Y));
-				TextureCoordinates.push_back(cbVector(Char.Max.X, Char.Min.Y));
-				TextureCoordinates.push_back(cbVector(Char.Max.X, Char.Max.Y));
-				TextureCoordinates.push_back(cbVector(Char.Min.X, Char.Max.Y));
-			}
+			if (Characters.LineOrders[i] >= Geometry.TextMetrics.LineMetaData.size())
+				continue;
+
+			const cbBounds& Char = Characters.TextureCoordinates[i];
+			Geometry.TextureCoordinates.push_back(cbVector(Char.Min.X, Char.Min.Y));
+			Geometry.TextureCoordinates.push_back(cbVector(Char.Max.X, Char.Min.Y));
+			Geometry.TextureCoordinates.push_back(cbVector(Char.Max.X, Char.Max.Y));
+			Geometry.TextureCoordinates.push_back(cbVector(Char.Min.X, Char.Max.Y));
 		}
 	}
 
 	void cbFontGeometry::UpdateVertices()
 	{
-		Vertices.clear();
-		for (const auto& Character : TextMetrics.Characters)
+		cbGeometryData& Geometry = MakeUnique();
+		const auto& Characters = Geometry.TextMetrics.Characters;
+
+		Geometry.Vertices.clear();
+		Geometry.Vertices.reserve(Characters.GetFilteredSize() * 4);
+		for (std::size_t i = 0; i < Characters.size(); i++)
 		{
-			if (!Character.IsValid() || Character.IsSpace())
+			if (!Characters.IsVisible(i))
 				continue;
 
-			if (Character.LineOrder >= TextMetrics.LineMetaData.size())
+			if (Characters.LineOrders[i] >= Geometry.TextMetrics.LineMetaData.size())
 				continue;
 
-			const auto& Baseline = TextMetrics.LineMetaData.at(Character.LineOrder).Baseline;
-			const auto& Bounds = Character.Bounds;
-			Vertices.push_back(cbVector4(Bounds.Min.X + Character.AlignedKerning, Bounds.Min.Y + Baseline, 0.0f));
-			Vertices.push_back(cbVector4(Bounds.Max.X + Character.AlignedKerning, Bounds.Min.Y + Baseline, 0.0f));
-			Vertices.push_back(cbVector4(Bounds.Max.X + Character.AlignedKerning, Bounds.Max.Y + Baseline, 0.0f));
-			Vertices.push_back(cbVector4(Bounds.Min.X + Character.AlignedKerning, Bounds.Max.Y + Baseline, 0.0f));
+			const auto& Baseline = Geometry.TextMetrics.LineMetaData[Characters.LineOrders[i]].Baseline;
+			const auto& Bounds = Characters.Bounds[i];
+			const float Kerning = Characters.AlignedKernings[i];
+			Geometry.Vertices.push_back(cbVector4(Bounds.Min.X + Kerning, Bounds.Min.Y + Baseline, 0.0f));
+			Geometry.Vertices.push_back(cbVector4(Bounds.Max.X + Kerning, Bounds.Min.Y + Baseline, 0.0f));
+			Geometry.Vertices.push_back(cbVector4(Bounds.Max.X + Kerning, Bounds.Max.Y + Baseline, 0.0f));
+			Geometry.Vertices.push_back(cbVector4(Bounds.Min.X + Kerning, Bounds.Max.Y + Baseline, 0.0f));
+		}
+
+		UpdateLineGlyphOffsets();
+	}
+
+	void cbFontGeometry::UpdateLineGlyphOffsets()
+	{
+		cbGeometryData& Geometry = MakeUnique();
+		const auto& Characters = Geometry.TextMetrics.Characters;
+		const std::size_t LineCount = Geometry.TextMetrics.LineMetaData.size();
+
+		Geometry.LineGlyphOffsets.assign(LineCount + 1, 0);
+		for (std::size_t i = 0; i < Characters.size(); i++)
+		{
+			if (!Characters.IsVisible(i) || Characters.LineOrders[i] >= LineCount)
+				continue;
+			Geometry.LineGlyphOffsets[Characters.LineOrders[i] + 1]++;
 		}
+
+		for (std::size_t i = 1; i < Geometry.LineGlyphOffsets.size(); i++)
+			Geometry.LineGlyphOffsets[i] += Geometry.LineGlyphOffsets[i - 1];
+	}
+
+	cbTextGlyphRange cbFontGeometry::GetGlyphRange(const float Top, const float Bottom) const
+	{
+		const auto& Lines = TextMetrics().LineMetaData;
+		if (Lines.size() == 0 || LineGlyphOffsets().size() != Lines.size() + 1)
+			return cbTextGlyphRange();
+
+		const auto First = std::partition_point(Lines.begin(), Lines.end(), [&](const cbTextMetrics::cbLineMetaData& Line)
+		{
+			return Line.Baseline - Line.Descender < Top;
+		});
+		const auto End = std::partition_point(First, Lines.end(), [&](const cbTextMetrics::cbLineMetaData& Line)
+		{
+			return Line.Baseline - Line.Ascender <= Bottom;
+		});
+
+		const std::size_t FirstLine = std::distance(Lines.begin(), First);
+		const std::size_t EndLine = std::distance(Lines.begin(), End);
+		return cbTextGlyphRange(FirstLine, EndLine, LineGlyphOffsets()[FirstLine], LineGlyphOffsets()[EndLine]);
 	}
 
 	std::vector<std::uint32_t> cbFontGeometry::GenerateIndices() const
@@ -1350,7 +2540,7 @@ namespace cbgui
 	void cbFontGeometry::UpdateBounds()
 	{
 		cbBounds bbox;
-		for (const auto& Line : TextMetrics.LineMetaData)
+		for (const auto& Line : TextMetrics().LineMetaData)
 		{
 			const cbBounds Bounds = Line.GetBounds();
 			{
@@ -1361,23 +2551,33 @@ namespace cbgui
 					bbox.Max.X = Bounds.Max.X;
 			}
 
-			// Ascender - Descender is maximum Height
-			bbox.Max.Y += Line.GetHeight();
 		}
 
-		CachedBounds = bbox;
+		/* The last line ends at its baseline minus its descender, the line height percentage moves the baselines. */
+		if (TextMetrics().LineMetaData.size() > 0)
+		{
+			const auto& LastLine = TextMetrics().LineMetaData.back();
+			bbox.Max.Y = LastLine.Baseline - LastLine.Descender;
+		}
+
+		CachedBounds() = bbox;
 
-		if (CachedBounds.GetHeight() == 0.0f)
-			CachedBounds.SetHeight((float)FontFamily->GetAscender(TextMetrics.FontSize, TextMetrics.FontType) - FontFamily->GetDescender(TextMetrics.FontSize, TextMetrics.FontType));
+		if (CachedBounds().GetHeight() == 0.0f)
+		{
+			int Ascender = 0;
+			int Descender = 0;
+			GetAscenderDescender(TextMetrics().FontSize, TextMetrics().FontType, Ascender, Descender);
+			CachedBounds().SetHeight((float)(Ascender - Descender));
+		}
 
-		if (CachedBounds.GetWidth() == 0.0f)
-			CachedBounds.SetWidth(2.0f);
+		if (CachedBounds().GetWidth() == 0.0f)
+			CachedBounds().SetWidth(2.0f);
 	}
 
 	std::vector<cbBounds> cbFontGeometry::GetLineBounds() const
 	{
 		std::vector<cbBounds> Bounds;
-		for (const auto& Line : TextMetrics.LineMetaData)
+		for (const auto& Line : TextMetrics().LineMetaData)
 		{
 			Bounds.push_back(Line.GetBounds());
 		}
@@ -1393,8 +2593,8 @@ namespace cbgui
 		if (oldValue && !TextDesc.bEnableAutoGrowVerticesSize)
 		{
 			std::size_t TextSize = GetTextSize();
-			Vertices.erase(Vertices.begin() + (TextSize * 4), Vertices.end());
-			TextureCoordinates.erase(TextureCoordinates.begin() + (TextSize * 4), TextureCoordinates.end());
+			Vertices().erase(Vertices().begin() + (TextSize * 4), Vertices().end());
+			TextureCoordinates().erase(TextureCoordinates().begin() + (TextSize * 4), TextureCoordinates().end());
 		}
 		else
 		{
@@ -1404,18 +2604,19 @@ namespace cbgui
 
 	void cbFontGeometry::GrowTextGeometryData()
 	{
+		/* The sizes are read through the const data, a shared layout is only copied if they change. */
 		if (TextDesc.bEnableAutoGrowVerticesSize)
 		{
-			if (Vertices.size() < (TextDesc.AutoGrowVerticesSize * 4))
+			if (Data->Vertices.size() < (TextDesc.AutoGrowVerticesSize * 4))
 			{
-				for (std::size_t i = Vertices.size(); i < (TextDesc.AutoGrowVerticesSize * 4); i++)
-					Vertices.push_back(cbVector4());
-				for (std::size_t i = TextureCoordinates.size(); i < (TextDesc.AutoGrowVerticesSize * 4); i++)
-					TextureCoordinates.push_back(cbVector());
+				for (std::size_t i = Data->Vertices.size(); i < (TextDesc.AutoGrowVerticesSize * 4); i++)
+					Vertices().push_back(cbVector4());
+				for (std::size_t i = Data->TextureCoordinates.size(); i < (TextDesc.AutoGrowVerticesSize * 4); i++)
+					TextureCoordinates().push_back(cbVector());
 			}
-			else if (Vertices.size() > (TextDesc.AutoGrowVerticesSize * 4))
+			else if (Data->Vertices.size() > (TextDesc.AutoGrowVerticesSize * 4))
 			{
-				TextDesc.AutoGrowVerticesSize = Vertices.size() + (TextDesc.AutoGrowVerticesSize * 4);
+				TextDesc.AutoGrowVerticesSize = Data->Vertices.size() + (TextDesc.AutoGrowVerticesSize * 4);
 				GrowTextGeometryData();
 			}
 		}
@@ -1423,20 +2624,20 @@ namespace cbgui
 		if (TextDesc.bEnableAutoGrowVerticesSize)
 		{
 			std::size_t TextSize = GetTextSize();
-			if (Vertices.size() > ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)))
-				Vertices.erase(Vertices.begin() + ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)), Vertices.end());
+			if (Data->Vertices.size() > ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)))
+				Vertices().erase(Vertices().begin() + ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)), Vertices().end());
 
-			if (TextureCoordinates.size() > ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)))
-				TextureCoordinates.erase(TextureCoordinates.begin() + ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)), TextureCoordinates.end());
+			if (Data->TextureCoordinates.size() > ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)))
+				TextureCoordinates().erase(TextureCoordinates().begin() + ((TextSize * 4) + (TextDesc.AutoGrowVerticesSize * 4)), TextureCoordinates().end());
 		}
 		else
 		{
 			std::size_t TextSize = GetTextSize();
-			if (Vertices.size() > (TextSize * 4))
-				Vertices.erase(Vertices.begin() + (TextSize * 4), Vertices.end());
+			if (Data->Vertices.size() > (TextSize * 4))
+				Vertices().erase(Vertices().begin() + (TextSize * 4), Vertices().end());
 
-			if (TextureCoordinates.size() > (TextSize * 4))
-				TextureCoordinates.erase(TextureCoordinates.begin() + (TextSize * 4), TextureCoordinates.end());
+			if (Data->TextureCoordinates.size() > (TextSize * 4))
+				TextureCoordinates().erase(TextureCoordinates().begin() + (TextSize * 4), TextureCoordinates().end());
 		}
 	}
 
@@ -1482,8 +2683,7 @@ namespace cbgui
 		if (LineHeightPercentage != Percentage)
 		{
 			LineHeightPercentage = Percentage;
-			UpdateAlignments();
-			UpdateGeometry();
+			ReWrap();
 		}		
 	}
 
@@ -1492,8 +2692,7 @@ namespace cbgui
 		if (bAutoWrapText != Value)
 		{
 			bAutoWrapText = Value;
-			UpdateAlignments();
-			UpdateGeometry();
+			ReWrap();
 		}
 	}
 
@@ -1504,8 +2703,7 @@ namespace cbgui
 			CustomWrapSize = std::nullopt;
 			if (IsAutoWrapTextEnabled())
 			{
-				UpdateAlignments();
-				UpdateGeometry();
+				ReWrap();
 			}
 		}
 		else if (CustomWrapSize.has_value())
@@ -1515,8 +2713,7 @@ namespace cbgui
 				CustomWrapSize = Width.value();
 				if (IsAutoWrapTextEnabled())
 				{
-					UpdateAlignments();
-					UpdateGeometry();
+					ReWrap();
 				}
 			}
 		}
@@ -1525,17 +2722,16 @@ namespace cbgui
 			CustomWrapSize = Width.value();
 			if (IsAutoWrapTextEnabled())
 			{
-				UpdateAlignments();
-				UpdateGeometry();
+				ReWrap();
 			}
 		}
 	}
 
 	void cbFontGeometry::SetAscenderDescenderPowerOfTwo(const bool Value)
 	{
-		if (TextMetrics.bIsAscenderDescenderPowerOfTwo != Value)
+		if (TextMetrics().bIsAscenderDescenderPowerOfTwo != Value)
 		{
-			TextMetrics.bIsAscenderDescenderPowerOfTwo = Value;
+			TextMetrics().bIsAscenderDescenderPowerOfTwo = Value;
 			UpdateAlignments();
 			UpdateGeometry();
 		}
@@ -1543,48 +2739,51 @@ namespace cbgui
 
 	void cbFontGeometry::SetFontType(const eFontType& Type)
 	{
-		if (TextMetrics.FontType != Type)
+		if (TextMetrics().FontType != Type)
 		{
-			TextMetrics.FontType = Type;
+			TextMetrics().FontType = Type;
 			RebuildText();
 		}
 	}
 
 	void cbFontGeometry::SetFontSize(const std::size_t& Size)
 	{
-		if (TextMetrics.FontSize != Size)
+		if (TextMetrics().FontSize != Size)
 		{
-			TextMetrics.FontSize = Size;
+			TextMetrics().FontSize = Size;
 			RebuildText();
 		}
 	}
 
 	void cbFontGeometry::SetTextStylingEnabled(const bool Value)
 	{
-		if (TextMetrics.bIsTextStylingEnabled != Value)
+		if (TextMetrics().bIsTextStylingEnabled != Value)
 		{
-			TextMetrics.bIsTextStylingEnabled = Value;
+			TextMetrics().bIsTextStylingEnabled = Value;
 			RebuildText();
 		}
 	}
 
 	void cbFontGeometry::AddTextStyle(const cbTextStyle& Style)
 	{
-		TextMetrics.TextStyles.push_back(Style);
-		if (TextMetrics.bIsTextStylingEnabled)
+		TextMetrics().TextStyles.push_back(Style);
+		if (TextMetrics().bIsTextStylingEnabled)
 			RebuildText();
 	}
 
 	void cbFontGeometry::RemoveTextStyle(const std::size_t& Index)
 	{
-		TextMetrics.TextStyles.erase(TextMetrics.TextStyles.begin() + Index);
-		if (TextMetrics.bIsTextStylingEnabled)
+		TextMetrics().TextStyles.erase(TextMetrics().TextStyles.begin() + Index);
+		if (TextMetrics().bIsTextStylingEnabled)
 			RebuildText();
 	}
 
 	void cbFontGeometry::SetFontFamily(cbIFontFamily* inFontFamily)
 	{
+		if (FontFamily)
+			FontFamily->RemoveGeometry(this);
 		FontFamily = static_cast<cbFreeTypeFontFamily*>(inFontFamily);
+		FontFamily->AddGeometry(this);
 
 		RebuildText();
 	}
@@ -1612,18 +2811,19 @@ namespace cbgui
 
 	bool cbFontGeometry::GetLineData(std::size_t Index, cbBounds& outLineBounds, std::vector<cbCharacterData>& outCharacterData) const
 	{
-		if (Index >= TextMetrics.LineMetaData.size())
+		if (Index >= TextMetrics().LineMetaData.size())
 			return false;
 
-		const cbTextMetrics::cbLineMetaData& Line = TextMetrics.LineMetaData.at(Index);
+		const cbTextMetrics::cbLineMetaData& Line = TextMetrics().LineMetaData.at(Index);
 		outLineBounds = Line.GetBounds();
 
-		for (const auto& Character : TextMetrics.Characters)
+		const auto& Characters = TextMetrics().Characters;
+		for (std::size_t i = 0; i < Characters.size(); i++)
 		{
-			if (Character.LineOrder != Index)
+			if (Characters.LineOrders[i] != Index)
 				continue;
 
-			outCharacterData.push_back(cbCharacterData(Character, Line.Baseline));
+			outCharacterData.push_back(cbCharacterData(Characters.Get(i), Line.Baseline));
 		}
 
 		return true;
@@ -1631,52 +2831,42 @@ namespace cbgui
 
 	std::optional<cbBounds> cbFontGeometry::GetLineBounds(std::size_t Index) const
 	{
-		if (Index >= TextMetrics.LineMetaData.size())
+		if (Index >= TextMetrics().LineMetaData.size())
 			return std::nullopt;
 
-		const cbTextMetrics::cbLineMetaData& Line = TextMetrics.LineMetaData.at(Index);
+		const cbTextMetrics::cbLineMetaData& Line = TextMetrics().LineMetaData.at(Index);
 
 		return Line.GetBounds();
 	}
 
 	std::optional<cbCharacterData> cbFontGeometry::GetCharacterData(std::size_t Index) const
 	{
-		if (Index > TextMetrics.Characters.size() || TextMetrics.Characters.size() == 0)
+		if (Index > TextMetrics().Characters.size() || TextMetrics().Characters.size() == 0)
 			return std::nullopt;
 
-		const cbTextMetrics::cbCharacter& Character = Index == TextMetrics.Characters.size() ? TextMetrics.Characters.back() : TextMetrics.Characters.at(Index);
-		if (Character.LineOrder >= TextMetrics.LineMetaData.size())
+		const cbTextMetrics::cbCharacter Character = Index == TextMetrics().Characters.size() ? TextMetrics().Characters.Back() : TextMetrics().Characters.Get(Index);
+		if (Character.LineOrder >= TextMetrics().LineMetaData.size())
 			return std::nullopt;
-		const cbTextMetrics::cbLineMetaData& Line = TextMetrics.LineMetaData.at(Character.LineOrder);
+		const cbTextMetrics::cbLineMetaData& Line = TextMetrics().LineMetaData.at(Character.LineOrder);
 
 		return cbCharacterData(Character, Line.Baseline);
 	}
 
 	void cbFontGeometry::AddChar(const char32_t pChar, const std::optional<std::size_t> inIndex, bool Filtered)
 	{
-		cbTextMetrics::cbCharacter Character(pChar, TextMetrics.FontSize, TextMetrics.FontType, 0, !((pChar != '\n') && pChar >= 32));
+		cbTextMetrics::cbCharacter Character(pChar, TextMetrics().FontSize, TextMetrics().FontType, 0, !((pChar != '\n') && pChar >= 32));
 
-		if (!TextMetrics.bIsTextStylingEnabled)
-			BuildCharacter(&Character);
-
-		if (inIndex.has_value())
-			TextMetrics.Characters.insert(TextMetrics.Characters.begin() + inIndex.value(), Character);
-		else
-			TextMetrics.Characters.push_back(Character);
+		const std::size_t Index = inIndex.has_value() ? inIndex.value() : TextMetrics().Characters.size();
+		TextMetrics().Characters.Insert(Index, Character);
+		TextMetrics().ShiftStyleRuns(Index, true);
 
-		if (TextMetrics.bIsTextStylingEnabled)
+		if (TextMetrics().bIsTextStylingEnabled)
 		{
 			RebuildText();
 		}
 		else
 		{
-			std::size_t i = 0;
-			for (auto& Char : TextMetrics.Characters)
-			{
-				Char.CharacterOrder = i;
-				i++;
-			}
-
+			BuildCharacter(Index);
 			UpdateAlignments();
 			UpdateGeometry();
 		}
@@ -1684,24 +2874,18 @@ namespace cbgui
 
 	bool cbFontGeometry::RemoveChar(const std::size_t& Index)
 	{
-		if (Index >= TextMetrics.Characters.size())
+		if (Index >= TextMetrics().Characters.size())
 			return false;
 
-		TextMetrics.Characters.erase(TextMetrics.Characters.begin() + Index);
+		TextMetrics().Characters.Erase(Index);
+		TextMetrics().ShiftStyleRuns(Index, false);
 
-		if (TextMetrics.bIsTextStylingEnabled)
+		if (TextMetrics().bIsTextStylingEnabled)
 		{
 			RebuildText();
 		}
 		else
 		{
-			std::size_t i = 0;
-			for (auto& Char : TextMetrics.Characters)
-			{
-				Char.CharacterOrder = i;
-				i++;
-			}
-
 			UpdateAlignments();
 			UpdateGeometry();
 		}
@@ -1720,22 +2904,16 @@ namespace cbgui
 
 		for (const auto& Index : Indices)
 		{
-			TextMetrics.Characters.erase(TextMetrics.Characters.begin() + Index);
+			TextMetrics().Characters.Erase(Index);
+			TextMetrics().ShiftStyleRuns(Index, false);
 		}
 
-		if (TextMetrics.bIsTextStylingEnabled)
+		if (TextMetrics().bIsTextStylingEnabled)
 		{
 			RebuildText();
 		}
 		else
 		{
-			std::size_t i = 0;
-			for (auto& Char : TextMetrics.Characters)
-			{
-				Char.CharacterOrder = i;
-				i++;
-			}
-
 			UpdateAlignments();
 			UpdateGeometry();
 		}
@@ -1745,16 +2923,16 @@ namespace cbgui
 
 	const std::u32string cbFontGeometry::GetText(bool Filtered) const
 	{
-		return Filtered ? TextMetrics.GetFilteredText() : TextMetrics.GetText();
+		return Filtered ? TextMetrics().GetFilteredText() : TextMetrics().GetText();
 	}
 
 	const std::size_t cbFontGeometry::GetTextSize(bool Filtered) const
 	{
 		if (Filtered)
 		{
-			return TextMetrics.GetFilteredSize();
+			return TextMetrics().GetFilteredSize();
 		}
 
-		return TextMetrics.Characters.size();
+		return TextMetrics().Characters.size();
 	}
 }
@@ -33,6 +33,7 @@ namespace cbgui
 	cbImage::cbImage()
 		: cbWidget()
 		, Transform(cbTransform(cbDimension(32.0f, 32.0f)))
+		, VertexColorStyle(this)
 	{
 		SetFocusable(false);
 	}
@@ -40,7 +41,7 @@ namespace cbgui
 	cbgui::cbImage::cbImage(const cbImage& Other)
 		: cbWidget(Other)
 		, Transform(Other.Transform)
-		, VertexColorStyle(Other.VertexColorStyle)
+		, VertexColorStyle(this, Other.VertexColorStyle)
 	{}
 
 	cbImage::~cbImage()
@@ -208,18 +209,12 @@ namespace cbgui
 			for (std::size_t i = 0; i < 4; i++)
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
-			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor(),
+			return cbGeometryFactory::GetAlignedVertexData(Data, TC, *GetVertexColor(true),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor();
-		auto Alpha = GetVertexColorAlpha();
-		if (Alpha.has_value())
-			Color.A = *Alpha;
-
 		return cbGeometryFactory::GetAlignedVertexData(cbGeometryFactory::Create4DPlaneVerticesFromRect(GetDimension()),
-			cbGeometryFactory::GeneratePlaneTextureCoordinate(), Color,
+			cbGeometryFactory::GeneratePlaneTextureCoordinate(), *GetVertexColor(),
 			GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 	}
 
@@ -237,10 +232,28 @@ namespace cbgui
 		return cbGeometryDrawData("Plane", 0, 4, 6, 6);
 	};
 
+	std::optional<cbColor> cbImage::GetVertexColor(const bool LineGeometry) const
+	{
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor() : VertexColorStyle->GetDisabledColor();
+		if (LineGeometry)
+			return Color;
+
+		auto Alpha = GetVertexColorAlpha();
+		if (Alpha.has_value())
+			Color.A = *Alpha;
+		return Color;
+	}
+
 	void cbImage::SetVertexColorStyle(const cbVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
-		NotifyCanvas_WidgetUpdated();
+		VertexColorStyle.Set(style);
+		NotifyCanvas_ColorUpdated();
+	}
+
+	void cbImage::SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle)
+	{
+		VertexColorStyle.Bind(Handle);
+		NotifyCanvas_ColorUpdated();
 	}
 
 	void cbImage::UpdateVerticalAlignment(const bool ForceAlign)
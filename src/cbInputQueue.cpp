@@ -0,0 +1,61 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbInputQueue.h"
+
+namespace cbgui
+{
+	void cbInputQueue::Push(const cbInputEvent& Event)
+	{
+		if (Event.Type == eInputEventType::MouseMove && !Events.empty())
+		{
+			cbInputEvent& Last = Events.back();
+			if (Last.Type == eInputEventType::MouseMove)
+			{
+				Last = Event;
+				return;
+			}
+		}
+
+		Events.push_back(Event);
+	}
+
+	void cbInputQueue::Dispatch(const std::function<void(const cbInputEvent&)>& fHandler)
+	{
+		if (Events.empty())
+			return;
+
+		std::swap(Events, DispatchedEvents);
+
+		if (fHandler)
+		{
+			for (const auto& Event : DispatchedEvents)
+				fHandler(Event);
+		}
+
+		DispatchedEvents.clear();
+	}
+}
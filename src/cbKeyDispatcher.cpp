@@ -0,0 +1,150 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbKeyDispatcher.h"
+
+namespace cbgui
+{
+	cbKeyDispatcher::cbKeyDispatcher()
+		: FocusedWidget(nullptr)
+	{}
+
+	void cbKeyDispatcher::FocusChanged(cbWidget* Widget)
+	{
+		if (!Widget)
+			return;
+
+		if (Widget->IsFocused())
+		{
+			/* An owner of the focused widget does not take the focus from its child. */
+			if (FocusedWidget && FocusedWidget != Widget && FocusedWidget->IsFocused() && IsOwnerOf(Widget, FocusedWidget))
+				return;
+
+			FocusedWidget = Widget;
+		}
+		else if (FocusedWidget && (FocusedWidget == Widget || IsOwnerOf(Widget, FocusedWidget)))
+		{
+			FocusedWidget = GetFocusedOwner(Widget);
+		}
+	}
+
+	void cbKeyDispatcher::WidgetRemoved(cbWidgetObj* Widget)
+	{
+		if (Widget && Widget == FocusedWidget)
+			FocusedWidget = nullptr;
+	}
+
+	void cbKeyDispatcher::SetShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers, const std::function<bool()>& fCallback)
+	{
+		if (!fCallback)
+		{
+			RemoveShortcut(KeyCode, Modifiers);
+			return;
+		}
+		Shortcuts[GetShortcutKey(KeyCode, Modifiers)] = fCallback;
+	}
+
+	void cbKeyDispatcher::RemoveShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers)
+	{
+		Shortcuts.erase(GetShortcutKey(KeyCode, Modifiers));
+	}
+
+	bool cbKeyDispatcher::HasShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers) const
+	{
+		return Shortcuts.find(GetShortcutKey(KeyCode, Modifiers)) != Shortcuts.end();
+	}
+
+	bool cbKeyDispatcher::ExecuteShortcut(const std::uint64_t KeyCode, const std::uint8_t Modifiers)
+	{
+		const auto It = Shortcuts.find(GetShortcutKey(KeyCode, Modifiers));
+		if (It == Shortcuts.end())
+			return false;
+		return It->second();
+	}
+
+	bool cbKeyDispatcher::KeyDown(const std::uint64_t KeyCode)
+	{
+		if (!FocusedWidget)
+			return false;
+
+		if (FocusedWidget->IsEnabled() && FocusedWidget->IsInteractableWithKey(KeyCode) && FocusedWidget->OnKeyDown(KeyCode))
+			return true;
+
+		for (cbWidget* Owner = GetOwnerWidget(FocusedWidget); Owner; Owner = GetOwnerWidget(Owner))
+		{
+			if (Owner->IsEnabled() && Owner->OnKeyDown(KeyCode))
+				return true;
+		}
+		return false;
+	}
+
+	bool cbKeyDispatcher::KeyUp(const std::uint64_t KeyCode)
+	{
+		if (!FocusedWidget)
+			return false;
+
+		if (FocusedWidget->IsEnabled() && FocusedWidget->IsInteractableWithKey(KeyCode) && FocusedWidget->OnKeyUp(KeyCode))
+			return true;
+
+		for (cbWidget* Owner = GetOwnerWidget(FocusedWidget); Owner; Owner = GetOwnerWidget(Owner))
+		{
+			if (Owner->IsEnabled() && Owner->OnKeyUp(KeyCode))
+				return true;
+		}
+		return false;
+	}
+
+	cbWidget* cbKeyDispatcher::GetOwnerWidget(const cbWidgetObj* Widget)
+	{
+		/* Skips the slots, they only forward to their content. */
+		for (cbWidgetObj* Owner = Widget->GetOwner(); Owner; Owner = Owner->GetOwner())
+		{
+			if (cbWidget* OwnerWidget = cbgui::cbCast<cbWidget>(Owner))
+				return OwnerWidget;
+		}
+		return nullptr;
+	}
+
+	cbWidget* cbKeyDispatcher::GetFocusedOwner(const cbWidget* Widget)
+	{
+		for (cbWidget* Owner = GetOwnerWidget(Widget); Owner; Owner = GetOwnerWidget(Owner))
+		{
+			if (Owner->IsFocused())
+				return Owner;
+		}
+		return nullptr;
+	}
+
+	bool cbKeyDispatcher::IsOwnerOf(const cbWidget* Owner, const cbWidget* Widget)
+	{
+		for (cbWidget* WidgetOwner = GetOwnerWidget(Widget); WidgetOwner; WidgetOwner = GetOwnerWidget(WidgetOwner))
+		{
+			if (WidgetOwner == Owner)
+				return true;
+		}
+		return false;
+	}
+}
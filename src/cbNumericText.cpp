@@ -0,0 +1,140 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbNumericText.h"
+#include <charconv>
+#include <cmath>
+
+namespace cbgui
+{
+	namespace
+	{
+		/* Figure space, as wide as a digit. */
+		constexpr char32_t BlankSlot = 0x2007;
+		constexpr char32_t OverflowSlot = '#';
+		/* The blank slot is included so that its glyph is created with the others. */
+		const std::u32string SlotCharacters = U"0123456789+-.,:%#\u2007";
+
+		cbFORCEINLINE char32_t ToSlotCharacter(const char Character)
+		{
+			if (Character >= '0' && Character <= '9')
+				return Character;
+			return SlotCharacters.find(static_cast<char32_t>(Character)) != std::u32string::npos ? static_cast<char32_t>(Character) : BlankSlot;
+		}
+	}
+
+	cbNumericText::cbNumericText(const std::size_t SlotCount, const cbTextDesc& TextDesc, cbIFontFamily* FontFamily)
+		: Super(std::u32string(), TextDesc, FontFamily)
+		, Slots(SlotCount, BlankSlot)
+		, bIsOverflowed(false)
+	{
+		/* Glyphs of the slot characters are created once here, updates never create glyphs. */
+		SetTabularCharacters(SlotCharacters);
+		SetText(Slots);
+	}
+
+	cbNumericText::cbNumericText(const cbNumericText& Other)
+		: Super(Other)
+		, Slots(Other.Slots)
+		, bIsOverflowed(Other.bIsOverflowed)
+	{}
+
+	cbNumericText::~cbNumericText()
+	{
+	}
+
+	cbWidget::SharedPtr cbNumericText::CloneWidget()
+	{
+		return cbNumericText::Create(*this);
+	}
+
+	void cbNumericText::SetInteger(const std::int64_t Value)
+	{
+		char Buffer[24];
+		const auto Result = std::to_chars(std::begin(Buffer), std::end(Buffer), Value);
+		SetSlots(Buffer, Result.ec == std::errc() ? static_cast<std::size_t>(Result.ptr - Buffer) : Slots.size() + 1);
+	}
+
+	void cbNumericText::SetFloat(const double Value, const int Precision)
+	{
+		if (!std::isfinite(Value))
+		{
+			SetSlots(nullptr, Slots.size() + 1);
+			return;
+		}
+
+		char Buffer[64];
+		const auto Result = std::to_chars(std::begin(Buffer), std::end(Buffer), Value, std::chars_format::fixed, Precision);
+		SetSlots(Buffer, Result.ec == std::errc() ? static_cast<std::size_t>(Result.ptr - Buffer) : Slots.size() + 1);
+	}
+
+	void cbNumericText::SetValueText(const std::string_view& Text)
+	{
+		SetSlots(Text.data(), Text.size());
+	}
+
+	void cbNumericText::SetSlotCount(const std::size_t Count)
+	{
+		if (Count == Slots.size())
+			return;
+
+		Slots.assign(Count, BlankSlot);
+		bIsOverflowed = false;
+		SetText(Slots);
+	}
+
+	void cbNumericText::SetSlots(const char* Text, const std::size_t Length)
+	{
+		const std::size_t SlotCount = Slots.size();
+		bIsOverflowed = Length > SlotCount;
+		const std::size_t Padding = bIsOverflowed ? 0 : SlotCount - Length;
+
+		cbFontGeometry* Geometry = GetFontGeometry();
+
+		/* Every slot character has a quad, the slot index is the glyph index. */
+		std::size_t FirstChanged = SlotCount;
+		std::size_t EndChanged = 0;
+		bool bIsRebuildNeeded = false;
+		for (std::size_t i = 0; i < SlotCount; i++)
+		{
+			const char32_t Character = bIsOverflowed ? OverflowSlot : i < Padding ? BlankSlot : ToSlotCharacter(Text[i - Padding]);
+			if (Slots[i] == Character)
+				continue;
+
+			Slots[i] = Character;
+			if (!Geometry->ReplaceChar(i, Character))
+				bIsRebuildNeeded = true;
+
+			FirstChanged = std::min(FirstChanged, i);
+			EndChanged = i + 1;
+		}
+
+		if (bIsRebuildNeeded)
+			SetText(Slots);
+		else if (EndChanged > FirstChanged)
+			NotifyCanvas_GlyphsUpdated(FirstChanged, EndChanged - FirstChanged);
+	}
+}
@@ -860,6 +860,19 @@ namespace cbgui
 		return Children;
 	}
 
+	std::size_t cbOverlay::GetChildrenCount() const
+	{
+		return GetComponentsCount() + mSlots.size();
+	}
+
+	cbWidgetObj* cbOverlay::GetChildAt(const std::size_t Index) const
+	{
+		const std::size_t ComponentsCount = GetComponentsCount();
+		if (Index < ComponentsCount)
+			return GetComponentAt(Index);
+		return Index - ComponentsCount < mSlots.size() ? mSlots[Index - ComponentsCount].get() : nullptr;
+	}
+
 	std::vector<cbGeometryVertexData> cbOverlay::GetVertexData(const bool LineGeometry) const
 	{
 		if (LineGeometry)
@@ -41,6 +41,7 @@ namespace cbgui
 		, bIsScrollable(false)
 		, LocationOffset(0.0f)
 		, bIsItFocused(false)
+		, VertexColorStyle(this)
 	{}
 
 	cbgui::cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::cbScrollBarHandleComponent(const cbScrollBarHandleComponent& Other, cbScrollBarComponent* pOwner)
@@ -53,7 +54,7 @@ namespace cbgui
 		, bIsScrollable(Other.bIsScrollable)
 		, LocationOffset(Other.LocationOffset)
 		, bIsItFocused(Other.bIsItFocused)
-		, VertexColorStyle(Other.VertexColorStyle)
+		, VertexColorStyle(this, Other.VertexColorStyle)
 	{
 		SetName(Other.GetName());
 	}
@@ -66,7 +67,7 @@ namespace cbgui
 	{
 		ButtonState = ButtonStatus;
 		if (GetOwner<cbScrollBox>()->bShouldNotifyCanvas)
-			NotifyCanvas_WidgetUpdated();
+			NotifyCanvas_ColorUpdated();
 	}
 
 	void cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::OnPressed()
@@ -298,6 +299,18 @@ namespace cbgui
 		SetButtonStatus(IsEnabled() ? eButtonState::Default : eButtonState::Disabled);
 	}
 
+	std::optional<cbColor> cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::GetVertexColor(const bool LineGeometry) const
+	{
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor(ButtonState) : VertexColorStyle->GetDisabledColor();
+		if (LineGeometry)
+			return Color;
+
+		auto Alpha = GetVertexColorAlpha();
+		if (Alpha.has_value())
+			Color.A = *Alpha;
+		return Color;
+	}
+
 	std::vector<cbGeometryVertexData> cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::GetVertexData(const bool LineGeometry) const
 	{
 		float Rotation = GetRotation();
@@ -316,18 +329,12 @@ namespace cbgui
 			for (std::size_t i = 0; i < 4; i++)
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
-			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor(ButtonState) : VertexColorStyle.GetDisabledColor(),
+			return cbGeometryFactory::GetAlignedVertexData(Data, TC, *GetVertexColor(true),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor(ButtonState) : VertexColorStyle.GetDisabledColor();
-		auto Alpha = GetVertexColorAlpha();
-		if (Alpha.has_value())
-			Color.A = *Alpha;
-
 		return cbGeometryFactory::GetAlignedVertexData(cbGeometryFactory::Create4DPlaneVerticesFromRect(GetDimension()),
-			cbGeometryFactory::GeneratePlaneTextureCoordinate(), Color,
+			cbGeometryFactory::GeneratePlaneTextureCoordinate(), *GetVertexColor(),
 			GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 	}
 
@@ -347,9 +354,16 @@ namespace cbgui
 
 	void cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::SetVertexColorStyle(const cbButtonVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
+		VertexColorStyle.Set(style);
 		if (GetOwner<cbScrollBox>()->bShouldNotifyCanvas)
-			NotifyCanvas_WidgetUpdated();
+			NotifyCanvas_ColorUpdated();
+	}
+
+	void cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::SetVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle)
+	{
+		VertexColorStyle.Bind(Handle);
+		if (GetOwner<cbScrollBox>()->bShouldNotifyCanvas)
+			NotifyCanvas_ColorUpdated();
 	}
 
 	bool cbScrollBox::cbScrollBarComponent::cbScrollBarHandleComponent::SetLocationOffset(const float value)
@@ -598,11 +612,11 @@ namespace cbgui
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
 			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor(),
+				IsEnabled() ? VertexColorStyle->GetColor() : VertexColorStyle->GetDisabledColor(),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor();
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor() : VertexColorStyle->GetDisabledColor();
 		auto Alpha = GetVertexColorAlpha();
 		if (Alpha.has_value())
 			Color.A = *Alpha;
@@ -629,7 +643,14 @@ namespace cbgui
 
 	void cbScrollBox::cbScrollBarComponent::SetBarVertexColorStyle(const cbVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
+		VertexColorStyle.Set(style);
+		if (GetOwner<cbScrollBox>()->bShouldNotifyCanvas)
+			NotifyCanvas_WidgetUpdated();
+	}
+
+	void cbScrollBox::cbScrollBarComponent::SetBarVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& pHandle)
+	{
+		VertexColorStyle.Bind(pHandle);
 		if (GetOwner<cbScrollBox>()->bShouldNotifyCanvas)
 			NotifyCanvas_WidgetUpdated();
 	}
@@ -831,6 +852,7 @@ namespace cbgui
 	void cbScrollBox::cbScrollBoxSlot::UpdateHorizontalDimension()
 	{
 		const cbScrollBox* ScrollBox = GetOwner<cbScrollBox>();
+		InvalidateWorldCache();
 
 		if (ScrollBox->GetOrientation() == eOrientation::Vertical)
 		{
@@ -847,6 +869,7 @@ namespace cbgui
 	void cbScrollBox::cbScrollBoxSlot::UpdateVerticalDimension()
 	{
 		const cbScrollBox* ScrollBox = GetOwner<cbScrollBox>();
+		InvalidateWorldCache();
 
 		if (ScrollBox->GetOrientation() == eOrientation::Vertical)
 		{
@@ -864,6 +887,7 @@ namespace cbgui
 	void cbScrollBox::cbScrollBoxSlot::UpdateHorizontalLocation()
 	{
 		const cbScrollBox* ScrollBox = GetOwner<cbScrollBox>();
+		InvalidateWorldCache();
 
 		if (ScrollBox->GetOrientation() == eOrientation::Vertical)
 		{
@@ -880,6 +904,7 @@ namespace cbgui
 	void cbScrollBox::cbScrollBoxSlot::UpdateVerticalLocation()
 	{
 		const cbScrollBox* ScrollBox = GetOwner<cbScrollBox>();
+		InvalidateWorldCache();
 
 		if (ScrollBox->GetOrientation() == eOrientation::Vertical)
 		{
@@ -2324,6 +2349,19 @@ namespace cbgui
 		return Children;
 	}
 
+	std::size_t cbScrollBox::GetChildrenCount() const
+	{
+		return GetComponentsCount() + mSlots.size();
+	}
+
+	cbWidgetObj* cbScrollBox::GetChildAt(const std::size_t Index) const
+	{
+		const std::size_t ComponentsCount = GetComponentsCount();
+		if (Index < ComponentsCount)
+			return GetComponentAt(Index);
+		return Index - ComponentsCount < mSlots.size() ? mSlots[Index - ComponentsCount].get() : nullptr;
+	}
+
 	std::vector<cbGeometryVertexData> cbScrollBox::GetVertexData(const bool LineGeometry) const
 	{
 		if (LineGeometry)
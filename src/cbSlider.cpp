@@ -40,6 +40,7 @@ namespace cbgui
 		, bFillMode(false)
 		, Padding(0)
 		, bFillThickness(false)
+		, VertexColorStyle(this)
 	{}
 
 	cbSlider::cbSliderHandleComponent::cbSliderHandleComponent(const cbSliderHandleComponent& eComponent, cbSlider* NewOwner)
@@ -52,7 +53,7 @@ namespace cbgui
 		, bFillMode(eComponent.bFillMode)
 		, Padding(eComponent.Padding)
 		, bFillThickness(eComponent.bFillThickness)
-		, VertexColorStyle(eComponent.VertexColorStyle)
+		, VertexColorStyle(this, eComponent.VertexColorStyle)
 	{
 		SetName(eComponent.GetName());
 	}
@@ -338,6 +339,18 @@ namespace cbgui
 			NotifyCanvas_WidgetUpdated();
 	}
 
+	std::optional<cbColor> cbSlider::cbSliderHandleComponent::GetVertexColor(const bool LineGeometry) const
+	{
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor(ButtonState) : VertexColorStyle->GetDisabledColor();
+		if (LineGeometry)
+			return Color;
+
+		auto Alpha = GetVertexColorAlpha();
+		if (Alpha.has_value())
+			Color.A = *Alpha;
+		return Color;
+	}
+
 	std::vector<cbGeometryVertexData> cbSlider::cbSliderHandleComponent::GetVertexData(const bool LineGeometry) const
 	{
 		float Rotation = GetRotation();
@@ -356,18 +369,12 @@ namespace cbgui
 			for (std::size_t i = 0; i < 4; i++)
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
-			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor(ButtonState) : VertexColorStyle.GetDisabledColor(),
+			return cbGeometryFactory::GetAlignedVertexData(Data, TC, *GetVertexColor(true),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor(ButtonState) : VertexColorStyle.GetDisabledColor();
-		auto Alpha = GetVertexColorAlpha();
-		if (Alpha.has_value())
-			Color.A = *Alpha;
-
 		return cbGeometryFactory::GetAlignedVertexData(cbGeometryFactory::Create4DPlaneVerticesFromRect(GetDimension()),
-			cbGeometryFactory::GeneratePlaneTextureCoordinate(), Color,
+			cbGeometryFactory::GeneratePlaneTextureCoordinate(), *GetVertexColor(),
 			GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 	}
 
@@ -387,16 +394,23 @@ namespace cbgui
 
 	void cbSlider::cbSliderHandleComponent::SetVertexColorStyle(const cbButtonVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
+		VertexColorStyle.Set(style);
 		if (GetOwner<cbSlider>()->bShouldNotifyCanvas)
-			NotifyCanvas_WidgetUpdated();
+			NotifyCanvas_ColorUpdated();
+	}
+
+	void cbSlider::cbSliderHandleComponent::SetVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& Handle)
+	{
+		VertexColorStyle.Bind(Handle);
+		if (GetOwner<cbSlider>()->bShouldNotifyCanvas)
+			NotifyCanvas_ColorUpdated();
 	}
 
 	void cbSlider::cbSliderHandleComponent::SetButtonStatus(const eButtonState& ButtonStatus)
 	{
 		ButtonState = ButtonStatus;
 		if (GetOwner<cbSlider>()->bShouldNotifyCanvas)
-			NotifyCanvas_WidgetUpdated();
+			NotifyCanvas_ColorUpdated();
 	}
 
 	cbSlider::cbSlider(eOrientation orientation)
@@ -414,6 +428,7 @@ namespace cbgui
 		, Thickness(2.5f)
 		, bHorizontalFill(false)
 		, bVerticalFill(false)
+		, VertexColorStyle(this)
 		, fOnValueChanged(nullptr)
 	{
 		ChangeOrientation(Orientation);
@@ -434,7 +449,7 @@ namespace cbgui
 		, Thickness(Other.Thickness)
 		, bHorizontalFill(Other.bHorizontalFill)
 		, bVerticalFill(bVerticalFill)
-		, VertexColorStyle(Other.VertexColorStyle)
+		, VertexColorStyle(this, Other.VertexColorStyle)
 		, fOnValueChanged(nullptr)
 	{
 		ChangeOrientation(Other.GetOrientation());
@@ -462,7 +477,6 @@ namespace cbgui
 		if (!IsEnabled())
 			return;
 
-		Handle->Tick(InDeltaTime); 
 		OnTick(InDeltaTime);
 	}
 
@@ -852,11 +866,11 @@ namespace cbgui
 				TC.push_back(Rect.GetCorner(Edges[i]));
 
 			return cbGeometryFactory::GetAlignedVertexData(Data, TC,
-				IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor(),
+				IsEnabled() ? VertexColorStyle->GetColor() : VertexColorStyle->GetDisabledColor(),
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		cbColor Color = IsEnabled() ? VertexColorStyle.GetColor() : VertexColorStyle.GetDisabledColor();
+		cbColor Color = IsEnabled() ? VertexColorStyle->GetColor() : VertexColorStyle->GetDisabledColor();
 		auto Alpha = GetVertexColorAlpha();
 		if (Alpha.has_value())
 			Color.A = *Alpha;
@@ -883,7 +897,7 @@ namespace cbgui
 
 	void cbSlider::SetBarVertexColorStyle(const cbVertexColorStyle& style)
 	{
-		VertexColorStyle = style;
+		VertexColorStyle.Set(style);
 		NotifyCanvas_WidgetUpdated();
 	}
 
@@ -892,6 +906,17 @@ namespace cbgui
 		Handle->SetVertexColorStyle(style);
 	}
 
+	void cbSlider::SetBarVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& pHandle)
+	{
+		VertexColorStyle.Bind(pHandle);
+		NotifyCanvas_WidgetUpdated();
+	}
+
+	void cbSlider::SetHandleVertexColorStyle(const cbStyleHandle<cbButtonVertexColorStyle>& pHandle)
+	{
+		Handle->SetVertexColorStyle(pHandle);
+	}
+
 	void cbgui::cbSlider::SetHandleFillThickness(const bool value)
 	{
 		Handle->SetFillThickness(value);
@@ -113,6 +113,27 @@ namespace cbgui
 		return 0.0f;
 	}
 
+	bool cbSlot::HasRenderTransform() const
+	{
+		if (IsInserted())
+			return Owner->HasRenderTransform();
+		return false;
+	}
+
+	cbMatrix2x3 cbSlot::GetRenderMatrix() const
+	{
+		if (IsInserted())
+			return Owner->GetRenderMatrix();
+		return cbMatrix2x3::Identity();
+	}
+
+	float cbSlot::GetRenderOpacity() const
+	{
+		if (IsInserted())
+			return Owner->GetRenderOpacity();
+		return 1.0f;
+	}
+
 	eZOrderMode cbSlot::GetZOrderMode() const
 	{
 		return eZOrderMode::InOrder;
@@ -255,51 +276,73 @@ namespace cbgui
 			GetContent()->ResetInput();
 	}
 
-	//void cbSlot::UpdateCulledBounds()
-	//{
-	//	//UpdateVerticalCulledBounds();
-	//	//UpdateHorizontalCulledBounds();
-	//	CulledBounds = GetRotation() != 0.0f ? cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetOrigin()).Crop(Owner->GetCulledBounds()) : GetBounds().Crop(Owner->GetCulledBounds());
-	//}
-
-	/*void cbSlot::UpdateVerticalCulledBounds()
+	void cbSlot::InvalidateWorldCache()
 	{
+		/* The subtree is already dirty, a child that rebuilt its world state would have cleared the mark. */
+		if (WorldCache.bIsSubtreeInvalid)
+			return;
+
+		WorldCache.Invalidate();
+		Super::InvalidateWorldCache();
 	}
 
-	void cbSlot::UpdateHorizontalCulledBounds()
+	void cbSlot::ChildWorldCacheValidated() const
 	{
-	}*/
+		/* A valid world cache has no dirty subtree mark above it. */
+		if (WorldCache.IsValid())
+			return;
 
-	cbBounds cbSlot::GetCulledBounds() const
+		WorldCache.bIsSubtreeInvalid = false;
+		Super::ChildWorldCacheValidated();
+	}
+
+	const cbWorldCache& cbSlot::GetWorldCache() const
 	{
-		if (!IsInserted())
-			return GetBounds();
+		if (WorldCache.IsValid())
+			return WorldCache;
 
-		if (GetRotation() != 0.0f)
-			return cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetRotatorOrigin()).Crop(Owner->GetCulledBounds());
+		const cbBounds Rect = GetBounds();
+		if (!IsInserted())
+		{
+			WorldCache.bIsCulled = true;
+			WorldCache.CulledBounds = Rect;
+		}
 		else
-			return cbBounds(GetBounds()).Crop(Owner->GetCulledBounds());
+		{
+			const cbBounds& OwnerRect = Owner->GetBounds();
+			WorldCache.bIsCulled = Owner->IsItCulled() || OwnerRect.Min.X >= Rect.Max.X || OwnerRect.Min.Y >= Rect.Max.Y;
+			if (GetRotation() != 0.0f)
+				WorldCache.CulledBounds = cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetRotatorOrigin()).Crop(Owner->GetCulledBounds());
+			else
+				WorldCache.CulledBounds = cbBounds(Rect).Crop(Owner->GetCulledBounds());
+		}
 
-		//return CulledBounds;
+		WorldCache.Validate();
+		if (Owner)
+			Owner->ChildWorldCacheValidated();
+		return WorldCache;
 	}
 
-	bool cbSlot::IsItCulled() const
+	cbBounds cbSlot::GetCulledBounds() const
 	{
-		if (!IsInserted())
-			return true;
+		return GetWorldCache().CulledBounds;
+	}
 
-		if (Owner->IsItCulled())
-			return true;
+	cbBounds cbSlot::GetRenderBounds() const
+	{
+		return HasRenderTransform() ? GetRenderMatrix().TransformBounds(GetCulledBounds()) : GetCulledBounds();
+	}
 
-		const cbBounds& OwnerRect = Owner->GetBounds();
-		const cbBounds& Rect = GetBounds();
-		return OwnerRect.Min.X >= Rect.Max.X || OwnerRect.Min.Y >= Rect.Max.Y;
+	bool cbSlot::IsItCulled() const
+	{
+		return GetWorldCache().bIsCulled;
 	}
 
 	void cbSlot::RemoveFromParent()
 	{
 		auto pOwner = Owner;
 		Owner = nullptr;
+		InvalidateWorldCache();
 		if (pOwner)
 			pOwner->OnRemoveSlot(this);
 	}
@@ -343,10 +386,7 @@ namespace cbgui
 
 	void cbSlottedBox::BeginPlay()
 	{
-		const auto& Components = GetAllComponents();
-		for (const auto& Component : Components)
-			if (Component)
-				Component->BeginPlay();
+		ForEachComponent([](cbComponent* Component) { Component->BeginPlay(); });
 
 		const std::size_t SlotSize = GetSlotSize();
 		for (std::size_t i = 0; i < SlotSize; i++)
@@ -364,19 +404,6 @@ namespace cbgui
 		if (!IsEnabled())
 			return;
 
-		const auto& Components = GetAllComponents();
-		for (const auto& Component : Components)
-			if (Component)
-				Component->Tick(DeltaTime);
-
-		const std::size_t SlotSize = GetSlotSize();
-		for (std::size_t i = 0; i < SlotSize; i++)
-		{
-			const auto Slot = GetSlot(i);
-			if (Slot)
-				Slot->Tick(DeltaTime);
-		}
-
 		OnTick(DeltaTime);
 	}
 
@@ -385,9 +412,10 @@ namespace cbgui
 		if (!IsFocusable())
 			return false;
 
-		auto mSlots = GetSlots();
-		for (const auto& Slot : mSlots)
+		const std::size_t SlotSize = GetSlotSize();
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -399,38 +427,14 @@ namespace cbgui
 
 	bool cbSlottedBox::OnKeyUp(std::uint64_t KeyCode)
 	{
-		if (!IsFocused() || !IsEnabled())
-			return false;
-
-		auto mSlots = GetSlots();
-		for (const auto& Slot : mSlots)
-		{
-			if (!Slot)
-				continue;
-
-			if (Slot->IsFocused() && Slot->IsInteractableWithKey(KeyCode))
-				Slot->OnKeyUp(KeyCode);
-		}
-
-		return true;
+		/* The canvas routes the keys to the focused child, the box only receives the unhandled keys. */
+		return false;
 	}
 
 	bool cbSlottedBox::OnKeyDown(std::uint64_t KeyCode)
 	{
-		if (!IsFocused() || !IsEnabled())
-			return false;
-
-		auto mSlots = GetSlots();
-		for (const auto& Slot : mSlots)
-		{
-			if (!Slot)
-				continue;
-
-			if (Slot->IsFocused() && Slot->IsInteractableWithKey(KeyCode))
-				Slot->OnKeyDown(KeyCode);
-		}
-
-		return true;
+		/* The canvas routes the keys to the focused child, the box only receives the unhandled keys. */
+		return false;
 	}
 
 	bool cbSlottedBox::OnMouseWheel(float WheelDelta, const cbMouseInput& Mouse)
@@ -438,9 +442,10 @@ namespace cbgui
 		if (!IsFocused() || !IsEnabled())
 			return false;
 
-		auto mSlots = GetSlots();
-		for (const auto& Slot : mSlots)
+		const std::size_t SlotSize = GetSlotSize();
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -456,13 +461,14 @@ namespace cbgui
 		if (!IsFocused() || !IsEnabled())
 			return false;
 
-		auto mSlots = GetSlots();
+		const std::size_t SlotSize = GetSlotSize();
 
 		std::vector<cbSlot*> ImmediateFocuses;
 
 		cbSlot* Focus = nullptr;
-		for (const auto& Slot : mSlots)
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -497,8 +503,9 @@ namespace cbgui
 			}
 		}
 
-		for (const auto& Slot : mSlots)
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -546,9 +553,10 @@ namespace cbgui
 		if (!IsFocused() || !IsEnabled())
 			return false;
 
-		auto mSlots = GetSlots();
-		for (const auto& Slot : mSlots)
+		const std::size_t SlotSize = GetSlotSize();
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -569,14 +577,11 @@ namespace cbgui
 		if (!IsFocused())
 			return false;
 
-		auto mSlots = GetSlots();
-		auto slotsize = GetSlotSize();
-		if (slotsize == 0)
-			slotsize = GetSlotSize();
+		const std::size_t SlotSize = GetSlotSize();
 
-		for (std::size_t i = 0; i < slotsize; i++)
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
-			const auto& Slot = mSlots[i];
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -597,9 +602,10 @@ namespace cbgui
 		if (!IsFocused() || !IsEnabled())
 			return false;
 
-		auto mSlots = GetSlots();
-		for (const auto& Slot : mSlots)
+		const std::size_t SlotSize = GetSlotSize();
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (!Slot)
 				continue;
 
@@ -630,13 +636,14 @@ namespace cbgui
 			SetFocus(true);
 
 		{
-			auto mSlots = GetSlots();
+			const std::size_t SlotSize = GetSlotSize();
 
 			std::vector<cbSlot*> ImmediateFocuses;
 
 			cbSlot* Focus = nullptr;
-			for (const auto& Slot : mSlots)
+			for (std::size_t i = 0; i < SlotSize; i++)
 			{
+				cbSlot* Slot = GetSlot(i);
 				if (!Slot)
 					continue;
 				if (Slot->IsHidden())
@@ -654,8 +661,9 @@ namespace cbgui
 				}
 			}
 
-			for (const auto& Slot : mSlots)
+			for (std::size_t i = 0; i < SlotSize; i++)
 			{
+				cbSlot* Slot = GetSlot(i);
 				if (!Slot)
 					continue;
 
@@ -692,12 +700,13 @@ namespace cbgui
 		if (!IsFocused())
 			return false;
 
-		auto mSlots = GetSlots();
+		const std::size_t SlotSize = GetSlotSize();
 
 		bool bIsSlotStillFocused = false;
 
-		for (const auto& Slot : mSlots)
+		for (std::size_t i = 0; i < SlotSize; i++)
 		{
+			cbSlot* Slot = GetSlot(i);
 			if (Slot)
 			{
 				Slot->OnMouseLeave(Mouse);
@@ -717,10 +726,7 @@ namespace cbgui
 	{
 		SetFocus(false);
 
-		const auto& Components = GetAllComponents();
-		for (const auto& Component : Components)
-			if (Component)
-				Component->ResetInput();
+		ForEachComponent([](cbComponent* Component) { Component->ResetInput(); });
 
 		const std::size_t SlotSize = GetSlotSize();
 		for (std::size_t i = 0; i < SlotSize; i++)
@@ -745,6 +751,9 @@ namespace cbgui
 
 		if (VerticalWrap || HorizontalWrap)
 		{
+			/* The alignment does not notify an unaligned root. */
+			InvalidateWorldCache();
+
 			if (VerticalWrap)
 				UpdateVerticalAlignment(true);
 
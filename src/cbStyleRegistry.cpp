@@ -0,0 +1,84 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbStyleRegistry.h"
+#include "cbWidget.h"
+
+namespace cbgui
+{
+	void cbStyleUser::Link(cbStyleUser*& Head)
+	{
+		Prev = nullptr;
+		Next = Head;
+		if (Head)
+			Head->Prev = this;
+		Head = this;
+	}
+
+	void cbStyleUser::Unlink(cbStyleUser*& Head)
+	{
+		if (Prev)
+			Prev->Next = Next;
+		else if (Head == this)
+			Head = Next;
+		if (Next)
+			Next->Prev = Prev;
+		Prev = nullptr;
+		Next = nullptr;
+	}
+
+	void cbStyleUser::NotifyUsers(cbStyleUser* Head)
+	{
+		for (cbStyleUser* User = Head; User; User = User->Next)
+		{
+			if (User->Owner)
+				User->Owner->VertexColorStyleUpdated();
+		}
+	}
+
+	cbStyleRegistry::~cbStyleRegistry()
+	{
+		/* The entries that are still referenced by the widgets become regular shared styles. */
+		for (auto& Style : Styles)
+			Style.second->Unregister();
+		Styles.clear();
+	}
+
+	std::size_t cbStyleRegistry::Apply(const cbStyleRegistry& Theme)
+	{
+		std::size_t Count = 0;
+		for (const auto& Style : Theme.Styles)
+		{
+			const auto It = Styles.find(Style.first);
+			if (It == Styles.end() || It->second == Style.second)
+				continue;
+
+			It->second->Assign(*Style.second);
+			Count++;
+		}
+		return Count;
+	}
+}
@@ -39,6 +39,8 @@ namespace cbgui
 		, LetterDrawCount(std::nullopt)
 		, FontGeometryBuilder(cbFontGeometry::CreateUnique(this, inText, TextDesc, FontFamily))
 		, bIsItWrapped(false)
+		, bIsGlyphClippingEnabled(true)
+		, EmittedGlyphRange(std::nullopt)
 	{
 		SetFocusable(false);
 	}
@@ -49,6 +51,8 @@ namespace cbgui
 		, LetterDrawCount(Other.LetterDrawCount)
 		, FontGeometryBuilder(Other.FontGeometryBuilder->CloneUnique(this))
 		, bIsItWrapped(Other.bIsItWrapped)
+		, bIsGlyphClippingEnabled(Other.bIsGlyphClippingEnabled)
+		, EmittedGlyphRange(std::nullopt)
 	{
 		SetFocusable(Other.IsFocusable());
 	}
@@ -228,6 +232,45 @@ namespace cbgui
 	{
 		const std::size_t OldVerticesSize = FontGeometryBuilder->GetVerticesSize();
 		FontGeometryBuilder->SetText(inText, Desc);
+		TextGeometryUpdated(OldVerticesSize);
+	}
+
+	void cbText::TextGeometryUpdated(const std::size_t OldVerticesSize)
+	{
+		const std::size_t NewVerticesSize = FontGeometryBuilder->GetVerticesSize();
+
+		if (IsItWrapped())
+			Wrap();
+		else
+			UpdateAlignments();
+
+		if (OldVerticesSize != NewVerticesSize)
+			GeometryVerticesSizeChanged(NewVerticesSize);
+		else
+			NotifyCanvas_WidgetUpdated();
+	}
+
+	void cbText::SetTextUtf8(const std::string_view& inText, const std::optional<cbTextDesc> Desc)
+	{
+		const std::size_t OldVerticesSize = FontGeometryBuilder->GetVerticesSize();
+		FontGeometryBuilder->SetTextUtf8(inText, Desc);
+		const std::size_t NewVerticesSize = FontGeometryBuilder->GetVerticesSize();
+
+		if (IsItWrapped())
+			Wrap();
+		else
+			UpdateAlignments();
+
+		if (OldVerticesSize != NewVerticesSize)
+			GeometryVerticesSizeChanged(NewVerticesSize);
+		else
+			NotifyCanvas_WidgetUpdated();
+	}
+
+	void cbText::SetStyledText(const std::u32string& inText, const std::vector<cbTextStyleRun>& Runs, const std::optional<cbTextDesc> Desc)
+	{
+		const std::size_t OldVerticesSize = FontGeometryBuilder->GetVerticesSize();
+		FontGeometryBuilder->SetStyledText(inText, Runs, Desc);
 		const std::size_t NewVerticesSize = FontGeometryBuilder->GetVerticesSize();
 
 		if (IsItWrapped())
@@ -258,6 +301,23 @@ namespace cbgui
 			NotifyCanvas_WidgetUpdated();
 	}
 
+	void cbText::AppendTextUtf8(const std::string_view& inText)
+	{
+		const std::size_t OldVerticesSize = FontGeometryBuilder->GetVerticesSize();
+		FontGeometryBuilder->AppendTextUtf8(inText);
+		const std::size_t NewVerticesSize = FontGeometryBuilder->GetVerticesSize();
+
+		if (IsItWrapped())
+			Wrap();
+		else
+			UpdateAlignments();
+
+		if (OldVerticesSize != NewVerticesSize)
+			GeometryVerticesSizeChanged(NewVerticesSize);
+		else
+			NotifyCanvas_WidgetUpdated();
+	}
+
 	void cbText::SetAutoGrowVerticesSize(const bool value, const std::size_t Size)
 	{
 		const std::size_t OldVerticesSize = FontGeometryBuilder->GetVerticesSize();
@@ -405,6 +465,18 @@ namespace cbgui
 			UpdateAlignments();
 	}
 
+	void cbText::SetTabularCharacters(const std::u32string& Characters)
+	{
+		FontGeometryBuilder->SetTabularCharacters(Characters);
+
+		NotifyCanvas_WidgetUpdated();
+
+		if (IsItWrapped())
+			Wrap();
+		else
+			UpdateAlignments();
+	}
+
 	void cbText::SetLineHeightPercentage(const float Percentage)
 	{
 		FontGeometryBuilder->SetLineHeightPercentage(Percentage);
@@ -474,6 +546,7 @@ namespace cbgui
 
 			if (Transform.CompressHeight(GeometryBounds.GetHeight()))
 			{
+				InvalidateWorldCache();
 				UpdateVerticalAlignment(true);
 
 				if (HasOwner())
@@ -778,6 +851,10 @@ namespace cbgui
 			{
 				NotifyCanvas_WidgetUpdated();
 			}
+			else
+			{
+				UpdateClipping();
+			}
 		}
 		else if (IsAlignedToCanvas())
 		{
@@ -930,6 +1007,9 @@ namespace cbgui
 
 		if (VerticalWrap || HorizontalWrap)
 		{
+			/* The alignment does not notify an unaligned root. */
+			InvalidateWorldCache();
+
 			if (VerticalWrap)
 				UpdateVerticalAlignment(true);
 
@@ -1031,11 +1111,56 @@ namespace cbgui
 				GetLocation(), Rotation, Rotation != 0.0f ? GetRotatorOrigin() : cbVector::Zero());
 		}
 
-		const auto& Vertices = FontGeometryBuilder->GetVertices();
-		if (Vertices.size() == 0)
+		const std::size_t VerticesSize = FontGeometryBuilder->GetVertices().size();
+		if (VerticesSize == 0)
 			return std::vector<cbGeometryVertexData>();
 
-		const std::size_t VerticesSize = Vertices.size();
+		const std::optional<cbTextGlyphRange> GlyphRange = GetVisibleGlyphRange();
+		EmittedGlyphRange = GlyphRange;
+		const std::size_t FirstVertex = GlyphRange.has_value() ? GlyphRange.value().FirstGlyph * 4 : 0;
+		const std::size_t EndVertex = GlyphRange.has_value() ? GlyphRange.value().EndGlyph * 4 : VerticesSize;
+
+		return GetGlyphVertexData(FirstVertex, EndVertex);
+	}
+
+	std::vector<cbGeometryVertexData> cbText::GetVertexRangeData(const std::size_t FirstVertex, const std::size_t VertexCount) const
+	{
+		/* The range indexes the vertices of the emitted lines. */
+		const std::size_t VerticesSize = FontGeometryBuilder->GetVertices().size();
+		const std::size_t Offset = EmittedGlyphRange.has_value() ? EmittedGlyphRange.value().FirstGlyph * 4 : 0;
+		const std::size_t EmittedEnd = EmittedGlyphRange.has_value() ? std::min(EmittedGlyphRange.value().EndGlyph * 4, VerticesSize) : VerticesSize;
+
+		const std::size_t First = Offset + FirstVertex;
+		if (First >= EmittedEnd)
+			return std::vector<cbGeometryVertexData>();
+
+		return GetGlyphVertexData(First, VertexCount < EmittedEnd - First ? First + VertexCount : EmittedEnd);
+	}
+
+	bool cbText::NotifyCanvas_GlyphsUpdated(const std::size_t FirstGlyph, const std::size_t GlyphCount)
+	{
+		std::size_t First = FirstGlyph;
+		std::size_t End = FirstGlyph + GlyphCount;
+
+		/* The glyphs of the culled lines are not in the vertex data of the canvas. */
+		if (EmittedGlyphRange.has_value())
+		{
+			First = std::max(First, EmittedGlyphRange.value().FirstGlyph);
+			End = std::min(End, EmittedGlyphRange.value().EndGlyph);
+			if (First >= End)
+				return false;
+
+			First -= EmittedGlyphRange.value().FirstGlyph;
+			End -= EmittedGlyphRange.value().FirstGlyph;
+		}
+
+		return NotifyCanvas_VerticesUpdated(First * 4, (End - First) * 4);
+	}
+
+	std::vector<cbGeometryVertexData> cbText::GetGlyphVertexData(const std::size_t FirstVertex, const std::size_t EndVertex) const
+	{
+		const float Rotation = GetRotation();
+		const auto& Vertices = FontGeometryBuilder->GetVertices();
 
 		const cbBounds& GeometryBounds = FontGeometryBuilder->GetGeometryBounds();
 		const cbVector& GeometryCenter = GeometryBounds.GetCenter();
@@ -1060,7 +1185,8 @@ namespace cbgui
 		const bool bIsEnabled = IsEnabled();
 
 		std::vector<cbGeometryVertexData> Container;
-		for (std::size_t i = 0; i < VerticesSize; i++)
+		Container.reserve(EndVertex - FirstVertex);
+		for (std::size_t i = FirstVertex; i < EndVertex; i++)
 		{
 			cbGeometryVertexData GeometryData;
 			GeometryData.position = Vertices[i];
@@ -1123,13 +1249,49 @@ namespace cbgui
 	{
 		if (LineGeometry)
 			return cbGeometryDrawData("Line", 0, 4, 8, 8);
-		return cbGeometryDrawData("Text", 0, FontGeometryBuilder->GetVerticesSize(), FontGeometryBuilder->GetIndexCount(),
-									LetterDrawCount.has_value() ? 
-										*LetterDrawCount >= FontGeometryBuilder->GetTextSize(true) ? 
-											(FontGeometryBuilder->GetTextSize(true) * 6) : (*LetterDrawCount * 6) 
-									: (FontGeometryBuilder->GetTextSize(true) * 6));
+
+		const std::size_t TextSize = FontGeometryBuilder->GetTextSize(true);
+		const std::size_t LetterCount = LetterDrawCount.has_value() && *LetterDrawCount < TextSize ? *LetterDrawCount : TextSize;
+
+		std::size_t DrawCount = LetterCount;
+		/* Clipped vertex data starts from the first visible glyph. */
+		if (const std::optional<cbTextGlyphRange> GlyphRange = GetVisibleGlyphRange())
+			DrawCount = LetterCount > GlyphRange.value().FirstGlyph ? std::min(LetterCount, GlyphRange.value().EndGlyph) - GlyphRange.value().FirstGlyph : 0;
+
+		return cbGeometryDrawData("Text", 0, FontGeometryBuilder->GetVerticesSize(), FontGeometryBuilder->GetIndexCount(), DrawCount * 6);
 	};
 
+	void cbText::SetGlyphClippingEnabled(const bool Value)
+	{
+		if (bIsGlyphClippingEnabled == Value)
+			return;
+
+		bIsGlyphClippingEnabled = Value;
+		NotifyCanvas_WidgetUpdated();
+	}
+
+	void cbText::UpdateClipping()
+	{
+		if (!EmittedGlyphRange.has_value())
+			return;
+
+		const std::optional<cbTextGlyphRange> GlyphRange = GetVisibleGlyphRange();
+		if (!GlyphRange.has_value() || GlyphRange.value() != EmittedGlyphRange.value())
+			NotifyCanvas_WidgetUpdated();
+	}
+
+	std::optional<cbTextGlyphRange> cbText::GetVisibleGlyphRange() const
+	{
+		if (!bIsGlyphClippingEnabled || IsRotated() || HasRenderTransform())
+			return std::nullopt;
+
+		const cbBounds ClipBounds = GetCulledBounds();
+		const cbBounds& GeometryBounds = FontGeometryBuilder->GetGeometryBounds();
+		/* Screen to geometry space, the inverse of the vertical offset applied in GetVertexData. */
+		const float Offset = GeometryBounds.GetCenter().Y - (Transform.GetTop() + (GeometryBounds.GetHeight() / 2.0f));
+		return FontGeometryBuilder->GetGlyphRange(ClipBounds.Min.Y + Offset, ClipBounds.Max.Y + Offset);
+	}
+
 	void cbText::SetVertexColorStyle(const cbVertexColorStyle& style)
 	{
 		if (HasGeometry())
@@ -1139,6 +1301,24 @@ namespace cbgui
 		}
 	}
 
+	void cbText::SetVertexColorStyle(const cbStyleHandle<cbVertexColorStyle>& Handle)
+	{
+		if (HasGeometry())
+		{
+			FontGeometryBuilder->SetVertexColorStyle(Handle);
+			NotifyCanvas_WidgetUpdated();
+		}
+	}
+
+	void cbText::VertexColorStyleUpdated()
+	{
+		if (HasGeometry())
+		{
+			FontGeometryBuilder->VertexColorStyleUpdated();
+			NotifyCanvas_ColorUpdated();
+		}
+	}
+
 	void cbgui::cbText::GeometryVerticesSizeChanged(std::size_t Size)
 	{
 		if (!bShouldNotifyCanvas)
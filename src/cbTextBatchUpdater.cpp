@@ -0,0 +1,243 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbTextBatchUpdater.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace cbgui
+{
+	/* Read-only shaping rounds before the remaining texts are shaped serially. */
+	static constexpr std::size_t MaxShapingRounds = 2;
+	/* A worker is woken for every this many texts, smaller batches are shaped on the calling thread. */
+	static constexpr std::size_t MinTextsPerWorker = 16;
+
+	/* Threads that sleep between the shaping rounds, the calling thread runs the job with them. */
+	class cbTextBatchUpdater::cbWorkerPool
+	{
+	public:
+		cbWorkerPool(const std::size_t Count)
+			: Job(nullptr)
+			, Generation(0)
+			, ActiveCount(0)
+			, RunningCount(0)
+			, bStop(false)
+		{
+			Threads.reserve(Count);
+			for (std::size_t i = 0; i < Count; i++)
+				Threads.push_back(std::thread([this, i]() { Loop(i); }));
+		}
+
+		~cbWorkerPool()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				bStop = true;
+			}
+			Wake.notify_all();
+
+			for (auto& Thread : Threads)
+				Thread.join();
+		}
+
+		inline std::size_t size() const { return Threads.size(); }
+
+		/* Runs the job on the calling thread and on the first Count workers, returns when all of them are done. */
+		void Run(const std::function<void()>& InJob, const std::size_t Count)
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				Job = &InJob;
+				ActiveCount = Count;
+				RunningCount = Count;
+				Generation++;
+			}
+			Wake.notify_all();
+
+			InJob();
+
+			std::unique_lock<std::mutex> Lock(Mutex);
+			Done.wait(Lock, [this]() { return RunningCount == 0; });
+			Job = nullptr;
+		}
+
+	private:
+		void Loop(const std::size_t Index)
+		{
+			std::size_t LastGeneration = 0;
+			std::unique_lock<std::mutex> Lock(Mutex);
+			while (true)
+			{
+				Wake.wait(Lock, [&]() { return bStop || Generation != LastGeneration; });
+				if (bStop)
+					return;
+
+				LastGeneration = Generation;
+				if (Index >= ActiveCount)
+					continue;
+
+				const std::function<void()>* CurrentJob = Job;
+				Lock.unlock();
+				(*CurrentJob)();
+				Lock.lock();
+
+				if (--RunningCount == 0)
+					Done.notify_one();
+			}
+		}
+
+		std::vector<std::thread> Threads;
+		std::mutex Mutex;
+		std::condition_variable Wake;
+		std::condition_variable Done;
+		const std::function<void()>* Job;
+		std::size_t Generation;
+		std::size_t ActiveCount;
+		std::size_t RunningCount;
+		bool bStop;
+	};
+
+	cbTextBatchUpdater::cbTextBatchUpdater(const std::size_t InThreadCount)
+		: ThreadCount(InThreadCount > 0 ? InThreadCount : std::max(1U, std::thread::hardware_concurrency()))
+		, Workers(nullptr)
+	{}
+
+	cbTextBatchUpdater::~cbTextBatchUpdater()
+	{
+		Workers = nullptr;
+	}
+
+	void cbTextBatchUpdater::Add(cbText* Text, const std::u32string& String, const std::optional<cbTextDesc> Desc)
+	{
+		Add(Text, std::u32string(String), Desc);
+	}
+
+	void cbTextBatchUpdater::Add(cbText* Text, std::u32string&& String, const std::optional<cbTextDesc> Desc)
+	{
+		if (!Text)
+			return;
+
+		const auto It = Indices.find(Text);
+		if (It != Indices.end())
+		{
+			Entries[It->second].String = std::move(String);
+			Entries[It->second].Desc = Desc;
+			return;
+		}
+
+		Indices.insert({ Text, Entries.size() });
+		Entries.push_back(cbTextBatchEntry(Text, std::move(String), Desc));
+	}
+
+	void cbTextBatchUpdater::Clear()
+	{
+		Entries.clear();
+		Indices.clear();
+	}
+
+	void cbTextBatchUpdater::ShapeEntry(cbTextBatchEntry* Entry, const bool bReadOnly)
+	{
+		cbFontGeometry* Geometry = Entry->Text->GetFontGeometry();
+
+		if (bReadOnly)
+		{
+			Entry->Requests.Clear();
+			cbFreeTypeFontFamily::BindRequests(&Entry->Requests);
+		}
+
+		/* The string is kept for the next round. */
+		Geometry->SetText(Entry->String, Entry->Desc);
+
+		if (bReadOnly)
+			cbFreeTypeFontFamily::BindRequests(nullptr);
+	}
+
+	void cbTextBatchUpdater::Shape(const std::vector<cbTextBatchEntry*>& Pending)
+	{
+		std::atomic<std::size_t> Next(0);
+		const std::function<void()> Worker = [&]()
+		{
+			for (std::size_t i = Next++; i < Pending.size(); i = Next++)
+				ShapeEntry(Pending[i], true);
+		};
+
+		/* The calling thread is one of the threads. */
+		const std::size_t WorkerCount = std::min(ThreadCount, (Pending.size() + MinTextsPerWorker - 1) / MinTextsPerWorker);
+		if (WorkerCount <= 1)
+		{
+			Worker();
+			return;
+		}
+
+		if (!Workers)
+			Workers = std::make_unique<cbWorkerPool>(ThreadCount - 1);
+
+		Workers->Run(Worker, WorkerCount - 1);
+	}
+
+	void cbTextBatchUpdater::Commit()
+	{
+		if (Entries.empty())
+			return;
+
+		std::vector<cbTextBatchEntry*> Pending;
+		Pending.reserve(Entries.size());
+		for (auto& Entry : Entries)
+		{
+			Entry.OldVerticesSize = Entry.Text->GetFontGeometry()->GetVerticesSize();
+			Pending.push_back(&Entry);
+		}
+
+		for (std::size_t Round = 0; Round < MaxShapingRounds && Pending.size() > 0; Round++)
+		{
+			Shape(Pending);
+
+			/* The missing font data of all texts is created at once. */
+			std::vector<cbTextBatchEntry*> Incomplete;
+			for (auto& Entry : Pending)
+			{
+				if (Entry->Requests.IsEmpty())
+					continue;
+
+				Entry->Text->GetFontGeometry()->FontFamily->ResolveRequests(Entry->Requests);
+				Incomplete.push_back(Entry);
+			}
+			Pending = std::move(Incomplete);
+		}
+
+		/* Texts that still miss data after resolving, e.g. new kerning pairs of the created glyphs. */
+		for (auto& Entry : Pending)
+			ShapeEntry(Entry, false);
+
+		for (auto& Entry : Entries)
+			Entry.Text->TextGeometryUpdated(Entry.OldVerticesSize);
+
+		Clear();
+	}
+}
@@ -0,0 +1,245 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbTextLayoutCache.h"
+
+namespace cbgui
+{
+	namespace
+	{
+		cbFORCEINLINE void HashCombine(std::size_t& Seed, const std::size_t Value)
+		{
+			Seed ^= Value + 0x9e3779b9 + (Seed << 6) + (Seed >> 2);
+		}
+
+		cbFORCEINLINE bool IsSameColor(const std::optional<cbColor>& A, const std::optional<cbColor>& B)
+		{
+			if (A.has_value() != B.has_value())
+				return false;
+			if (!A.has_value())
+				return true;
+			return A->R == B->R && A->G == B->G && A->B == B->B && A->A == B->A;
+		}
+	}
+
+	void cbTextLayoutKey::GenerateHash()
+	{
+		Hash = std::hash<std::u32string>()(Text);
+		HashCombine(Hash, std::hash<const void*>()(FontFamily));
+		HashCombine(Hash, static_cast<std::size_t>(FontType));
+		HashCombine(Hash, FontSize);
+		HashCombine(Hash, std::hash<float>()(WrapWidth));
+		HashCombine(Hash, static_cast<std::size_t>(TextJustify));
+		HashCombine(Hash, DefaultSpaceWidth.has_value() ? DefaultSpaceWidth.value() + 1 : 0);
+		HashCombine(Hash, std::hash<float>()(LineHeightPercentage));
+		HashCombine(Hash, (bIsAscenderDescenderPowerOfTwo ? 1 : 0) | (bIsTextStylingEnabled ? 2 : 0));
+		if (TabularCharacters.size() > 0)
+			HashCombine(Hash, std::hash<std::u32string>()(TabularCharacters));
+
+		if (bIsTextStylingEnabled)
+		{
+			for (const auto& Style : TextStyles)
+			{
+				HashCombine(Hash, std::hash<std::u32string>()(Style.Name));
+				HashCombine(Hash, static_cast<std::size_t>(Style.FontType));
+				HashCombine(Hash, Style.FontSize);
+			}
+		}
+	}
+
+	bool cbTextLayoutKey::operator==(const cbTextLayoutKey& Other) const
+	{
+		if (Hash != Other.Hash
+			|| FontFamily != Other.FontFamily
+			|| FontType != Other.FontType
+			|| FontSize != Other.FontSize
+			|| WrapWidth != Other.WrapWidth
+			|| TextJustify != Other.TextJustify
+			|| DefaultSpaceWidth != Other.DefaultSpaceWidth
+			|| LineHeightPercentage != Other.LineHeightPercentage
+			|| bIsAscenderDescenderPowerOfTwo != Other.bIsAscenderDescenderPowerOfTwo
+			|| bIsTextStylingEnabled != Other.bIsTextStylingEnabled
+			|| TabularCharacters != Other.TabularCharacters
+			|| Text != Other.Text)
+			return false;
+
+		/* The styles are part of the shared text metrics even if styling is disabled. */
+		if (TextStyles.size() != Other.TextStyles.size())
+			return false;
+
+		for (std::size_t i = 0; i < TextStyles.size(); i++)
+		{
+			const auto& A = TextStyles[i];
+			const auto& B = Other.TextStyles[i];
+			if (A.Name != B.Name || A.FontType != B.FontType || A.FontSize != B.FontSize || !IsSameColor(A.Color, B.Color))
+				return false;
+		}
+
+		return true;
+	}
+
+	cbTextLayoutCache::cbTextLayoutCache()
+		: bIsEnabled(true)
+		, MemoryBudget(8 * 1024 * 1024)
+		, MemoryUsage(0)
+		, HitCount(0)
+		, MissCount(0)
+		, EvictionCount(0)
+	{}
+
+	cbTextLayoutCache::~cbTextLayoutCache()
+	{
+		Clear();
+	}
+
+	cbTextLayoutCache& cbTextLayoutCache::Get()
+	{
+		static cbTextLayoutCache Instance;
+		return Instance;
+	}
+
+	std::shared_ptr<cbTextLayout> cbTextLayoutCache::Find(const cbTextLayoutKey& Key)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		if (!bIsEnabled)
+			return nullptr;
+
+		const auto It = LayoutMap.find(Key.Hash);
+		if (It == LayoutMap.end() || It->second->Key != Key)
+		{
+			MissCount++;
+			return nullptr;
+		}
+
+		Layouts.splice(Layouts.begin(), Layouts, It->second);
+		HitCount++;
+		return It->second->Layout;
+	}
+
+	void cbTextLayoutCache::Add(const cbTextLayoutKey& Key, const std::shared_ptr<cbTextLayout>& Layout)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		if (!bIsEnabled || !Layout)
+			return;
+
+		/* Admitted on the second add, a layout is only worth keeping if another text shows it again. */
+		if (Candidates.erase(Key.Hash) == 0)
+		{
+			if (Candidates.size() >= MaxCandidateCount)
+				Candidates.clear();
+			Candidates.insert(Key.Hash);
+			return;
+		}
+
+		const std::size_t MemorySize = Layout->GetMemorySize() + (Key.Text.capacity() * sizeof(char32_t));
+		if (MemorySize > MemoryBudget)
+			return;
+
+		/* Same hash, replace the old layout. */
+		const auto It = LayoutMap.find(Key.Hash);
+		if (It != LayoutMap.end())
+		{
+			MemoryUsage -= It->second->MemorySize;
+			Layouts.erase(It->second);
+			LayoutMap.erase(It);
+		}
+
+		Layouts.push_front(cbEntry{ Key, Layout, MemorySize });
+		LayoutMap.insert({ Key.Hash, Layouts.begin() });
+		MemoryUsage += MemorySize;
+
+		Evict();
+	}
+
+	void cbTextLayoutCache::Evict()
+	{
+		while (MemoryUsage > MemoryBudget && Layouts.size() > 0)
+		{
+			const auto& Entry = Layouts.back();
+			MemoryUsage -= Entry.MemorySize;
+			LayoutMap.erase(Entry.Key.Hash);
+			Layouts.pop_back();
+			EvictionCount++;
+		}
+	}
+
+	void cbTextLayoutCache::Invalidate(const cbIFontFamily* FontFamily)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		for (auto It = Layouts.begin(); It != Layouts.end();)
+		{
+			if (It->Key.FontFamily == FontFamily)
+			{
+				MemoryUsage -= It->MemorySize;
+				LayoutMap.erase(It->Key.Hash);
+				It = Layouts.erase(It);
+			}
+			else
+			{
+				It++;
+			}
+		}
+	}
+
+	void cbTextLayoutCache::Clear()
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		Layouts.clear();
+		LayoutMap.clear();
+		Candidates.clear();
+		MemoryUsage = 0;
+	}
+
+	void cbTextLayoutCache::SetEnabled(const bool Value)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			bIsEnabled = Value;
+		}
+
+		if (!Value)
+			Clear();
+	}
+
+	void cbTextLayoutCache::SetMemoryBudget(const std::size_t Bytes)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		MemoryBudget = Bytes;
+		Evict();
+	}
+
+	void cbTextLayoutCache::ResetCounters()
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		HitCount = 0;
+		MissCount = 0;
+		EvictionCount = 0;
+	}
+}
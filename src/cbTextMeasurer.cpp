@@ -0,0 +1,169 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbTextMeasurer.h"
+
+namespace cbgui
+{
+	cbTextMeasurement cbTextMeasurer::Measure(cbIFontFamily* FontFamily, const std::u32string_view& Text, const cbTextMeasureDesc& Desc, std::vector<float>* outLineWidths)
+	{
+		if (outLineWidths)
+			outLineWidths->clear();
+
+		cbTextMeasurement Result;
+		if (!FontFamily)
+			return Result;
+
+		const std::size_t Size = Desc.CharSize;
+		const eFontType Type = Desc.FontType;
+		const cbMargin& Padding = FontFamily->GetDesc().CharPadding;
+
+		int FontAscender = FontFamily->GetAscender(Size, Type);
+		int FontDescender = FontFamily->GetDescender(Size, Type);
+		if (Desc.bIsAscenderDescenderPowerOfTwo && FontAscender % 2)
+			FontAscender += 1;
+		if (Desc.bIsAscenderDescenderPowerOfTwo && FontDescender % 2)
+			FontDescender -= 1;
+
+		float Width = 0.0f;
+		float Height = 0.0f;
+
+		/* Line state, see cbFontGeometry::UpdateVerticalAlignment. */
+		float Baseline = 0.0f;
+		float PrevLineDescender = 0.0f;
+		bool bIsLineEmpty = true;
+		bool bLineHasMetrics = false;
+		float LineStart = 0.0f;
+		float LineEnd = 0.0f;
+
+		const auto PushLine = [&](const bool bHasMetrics, const float LineWidth)
+		{
+			const int Ascender = bHasMetrics ? FontAscender : 0;
+			const int Descender = bHasMetrics ? FontDescender : 0;
+			Baseline += Result.LineCount != 0 ? (Ascender * Desc.LineHeightPercentage) - PrevLineDescender : Ascender - PrevLineDescender;
+			PrevLineDescender = Descender * Desc.LineHeightPercentage;
+			/* Same as the bounds of cbFontGeometry, the text ends at the descender of the last line. */
+			Height = Baseline - Descender;
+			Width = std::max(Width, LineWidth);
+			if (outLineWidths)
+				outLineWidths->push_back(LineWidth);
+			Result.LineCount++;
+
+			bIsLineEmpty = true;
+			bLineHasMetrics = false;
+		};
+
+		/* Word state, see cbFontGeometry::UpdateHorizontalAlignment. */
+		std::optional<char32_t> PastChar;
+		float X = 0.0f;
+		float TotalWidth = 0.0f;
+		std::optional<float> WordStart;
+		bool bWordHasMetrics = false;
+
+		const auto PushWord = [&](const bool bEndsWithNewLine)
+		{
+			const float WordEnd = TotalWidth;
+			const float Start = WordStart.has_value() ? WordStart.value() : X;
+
+			if (Desc.WrapWidth.has_value() && !bIsLineEmpty && (WordEnd - LineStart) > Desc.WrapWidth.value())
+				PushLine(bLineHasMetrics, LineEnd - LineStart);
+
+			if (bIsLineEmpty)
+			{
+				LineStart = Start;
+				LineEnd = Start;
+				bIsLineEmpty = false;
+			}
+
+			LineEnd = LineEnd < WordEnd ? WordEnd : LineEnd;
+			bLineHasMetrics |= bWordHasMetrics;
+
+			if (bEndsWithNewLine)
+				PushLine(true, LineEnd - LineStart);
+
+			WordStart = std::nullopt;
+			bWordHasMetrics = false;
+		};
+
+		const std::size_t Count = Text.size();
+		for (std::size_t i = 0; i < Count; i++)
+		{
+			const char32_t Character = Text[i];
+			const bool bIsNewLine = Character == '\n';
+
+			if (!bIsNewLine && Character < 32)
+			{
+				if (i == (Count - 1))
+					PushWord(false);
+				continue;
+			}
+
+			if (PastChar.has_value())
+				X += FontFamily->GetKerning(PastChar.value(), Character, Size, Type);
+
+			const float Kerning = X;
+			PastChar = Character;
+
+			if (!bIsNewLine)
+			{
+				int xadvance = 0;
+				float Right = 0.0f;
+				if (const auto Metrics = FontFamily->GetGlyphMetrics(Type, Size, Character))
+				{
+					xadvance = Desc.DefaultSpaceWidth.has_value() && (Character == 32) ? (int)Desc.DefaultSpaceWidth.value() : Metrics->xadvance;
+					Right = (float)(Metrics->BearingX + (int)Metrics->Width);
+					if (Metrics->Width == 0)
+						Right += xadvance;
+					Right += Padding.Right;
+				}
+
+				X += xadvance;
+				TotalWidth = Right + Kerning;
+
+				if (!WordStart.has_value())
+					WordStart = Kerning;
+				bWordHasMetrics = true;
+			}
+
+			if (bIsNewLine || Character == 32 || i == (Count - 1))
+				PushWord(bIsNewLine);
+		}
+
+		if (!bIsLineEmpty)
+			PushLine(bLineHasMetrics, LineEnd - LineStart);
+
+		if (Count > 0 && Text[Count - 1] == '\n')
+			PushLine(true, 0.0f);
+
+		if (Height == 0.0f)
+			Height = (float)(FontAscender - FontDescender);
+		if (Width == 0.0f)
+			Width = 2.0f;
+
+		Result.Dimension = cbDimension(Width, Height);
+		return Result;
+	}
+}
@@ -0,0 +1,170 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbTickList.h"
+
+namespace cbgui
+{
+	cbTickList::cbTickList()
+		: bIsTicking(false)
+		, bHasRemovedEntries(false)
+	{}
+
+	void cbTickList::Register(cbWidgetObj* Object, const float Interval)
+	{
+		if (!Object)
+			return;
+
+		const auto It = Indices.find(Object);
+		if (It != Indices.end())
+		{
+			Entries[It->second].Interval = std::max(Interval, 0.0f);
+			return;
+		}
+
+		Indices.insert({ Object, Entries.size() });
+		Entries.push_back(cbTickEntry(Object, std::max(Interval, 0.0f)));
+	}
+
+	void cbTickList::Unregister(cbWidgetObj* Object)
+	{
+		const auto It = Indices.find(Object);
+		if (It == Indices.end())
+			return;
+
+		const std::size_t Index = It->second;
+		Indices.erase(It);
+
+		if (bIsTicking)
+		{
+			/* The entry is removed after the tick, the indices of the ticking entries must not change. */
+			Entries[Index].Object = nullptr;
+			bHasRemovedEntries = true;
+			return;
+		}
+
+		RemoveAt(Index);
+	}
+
+	void cbTickList::Update(cbWidgetObj* Object)
+	{
+		if (!Object)
+			return;
+
+		if (const auto Interval = Object->GetTickInterval())
+			Register(Object, Interval.value());
+		else
+			Unregister(Object);
+	}
+
+	void cbTickList::UpdateHierarchy(cbWidgetObj* Object)
+	{
+		if (!Object)
+			return;
+
+		Update(Object);
+
+		if (Object->HasAnyChildren())
+			Object->ForEachChild([&](cbWidgetObj* Child) { UpdateHierarchy(Child); });
+	}
+
+	void cbTickList::UnregisterHierarchy(cbWidgetObj* Object)
+	{
+		if (!Object)
+			return;
+
+		Unregister(Object);
+
+		if (Object->HasAnyChildren())
+			Object->ForEachChild([&](cbWidgetObj* Child) { UnregisterHierarchy(Child); });
+	}
+
+	void cbTickList::Tick(const float DeltaTime)
+	{
+		bIsTicking = true;
+
+		const std::size_t Size = Entries.size();
+		for (std::size_t i = 0; i < Size; i++)
+		{
+			if (!Entries[i].Object)
+				continue;
+
+			if (Entries[i].Interval <= 0.0f)
+			{
+				Entries[i].Object->Tick(DeltaTime);
+				continue;
+			}
+
+			Entries[i].Elapsed += DeltaTime;
+			if (Entries[i].Elapsed >= Entries[i].Interval)
+			{
+				const float Elapsed = Entries[i].Elapsed;
+				Entries[i].Elapsed = 0.0f;
+				Entries[i].Object->Tick(Elapsed);
+			}
+		}
+
+		bIsTicking = false;
+
+		if (bHasRemovedEntries)
+		{
+			bHasRemovedEntries = false;
+			for (std::size_t i = Entries.size(); i > 0; i--)
+			{
+				if (!Entries[i - 1].Object)
+					RemoveAt(i - 1);
+			}
+		}
+	}
+
+	void cbTickList::Clear()
+	{
+		if (bIsTicking)
+		{
+			for (auto& Entry : Entries)
+				Entry.Object = nullptr;
+			Indices.clear();
+			bHasRemovedEntries = true;
+			return;
+		}
+
+		Entries.clear();
+		Indices.clear();
+		bHasRemovedEntries = false;
+	}
+
+	void cbTickList::RemoveAt(const std::size_t Index)
+	{
+		/* Swap with the last entry, the tick order is not preserved. */
+		if (Index != Entries.size() - 1)
+		{
+			Entries[Index] = Entries.back();
+			if (Entries[Index].Object)
+				Indices[Entries[Index].Object] = Index;
+		}
+		Entries.pop_back();
+	}
+}
@@ -115,82 +115,86 @@ namespace cbgui
 
 	bool cbTransform::AlignWidth(float Alignment)
 	{
-		if (WidthAlignment.has_value())
+		if (bIsWidthAligned)
 		{
-			if (WidthAlignment.value() != Alignment)
+			if (WidthAlignment != Alignment)
 			{
 				WidthAlignment = Alignment;
-				return true;
+					return true;
 			}
 			return false;
 		}
 		WidthAlignment = Alignment;
+		bIsWidthAligned = true;
 		return true;
 	}
 
 	bool cbTransform::AlignHeight(float Alignment)
 	{
-		if (HeightAlignment.has_value())
+		if (bIsHeightAligned)
 		{
-			if (HeightAlignment.value() != Alignment)
+			if (HeightAlignment != Alignment)
 			{
 				HeightAlignment = Alignment;
-				return true;
+					return true;
 			}
 			return false;
 		}
 		HeightAlignment = Alignment;
+		bIsHeightAligned = true;
 		return true;
 	}
 
 	void cbTransform::ResetWidthAlignment()
 	{
-		WidthAlignment = std::nullopt;
+		bIsWidthAligned = false;
 	}
 
 	void cbTransform::ResetHeightAlignment()
 	{
-		HeightAlignment = std::nullopt;
+		bIsHeightAligned = false;
 	}
 
 	bool cbTransform::CompressWidth(const float Compression)
 	{
-		if (WidthCompression.has_value())
+		if (bIsWidthCompressed)
 		{
-			if (WidthCompression.value() != Compression)
+			if (WidthCompression != Compression)
 			{
 				WidthCompression = Compression;
-				return true;
+					return true;
 			}
 			return false;
 		}
 		WidthCompression = Compression;
+		bIsWidthCompressed = true;
 		return true;
 	}
 
 	bool cbTransform::CompressHeight(const float Compression)
 	{
-		if (HeightCompression.has_value())
+		if (bIsHeightCompressed)
 		{
-			if (HeightCompression.value() != Compression)
+			if (HeightCompression != Compression)
 			{
 				HeightCompression = Compression;
-				return true;
+					return true;
 			}
 			return false;
 		}
 		HeightCompression = Compression;
+		bIsHeightCompressed = true;
 		return true;
 	}
 
 	void cbTransform::ResetWidthCompressed()
 	{
-		WidthCompression = std::nullopt;
+		bIsWidthCompressed = false;
 	}
 
 	void cbTransform::ResetHeightCompressed()
 	{
-		HeightCompression = std::nullopt;
+		bIsHeightCompressed = false;
 	}
 
 	void cbTransform::ResetRotation()
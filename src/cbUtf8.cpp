@@ -0,0 +1,233 @@
+/* ---------------------------------------------------------------------------------------
+* MIT License
+*
+* Copyright (c) 2022 Davut Cokun.
+* All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+* ---------------------------------------------------------------------------------------
+*/
+#include "pch.h"
+#include "cbUtf8.h"
+#include "cbClassBody.h"
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define CBGUI_UTF8_SSE2 1
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define CBGUI_UTF8_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace cbgui
+{
+	namespace
+	{
+		constexpr char32_t ReplacementCharacter = 0xFFFD;
+
+		/* Widens 16 ASCII bytes to code points. Returns false if any byte is not ASCII. */
+		cbFORCEINLINE bool DecodeAscii16(const unsigned char* Source, char32_t* Dest)
+		{
+#if defined(CBGUI_UTF8_SSE2)
+			const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source));
+			if (_mm_movemask_epi8(Bytes) != 0)
+				return false;
+
+			const __m128i Zero = _mm_setzero_si128();
+			const __m128i Low = _mm_unpacklo_epi8(Bytes, Zero);
+			const __m128i High = _mm_unpackhi_epi8(Bytes, Zero);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), _mm_unpacklo_epi16(Low, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 4), _mm_unpackhi_epi16(Low, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 8), _mm_unpacklo_epi16(High, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 12), _mm_unpackhi_epi16(High, Zero));
+			return true;
+#elif defined(CBGUI_UTF8_NEON)
+			const uint8x16_t Bytes = vld1q_u8(Source);
+			if (vmaxvq_u8(Bytes) >= 0x80)
+				return false;
+
+			const uint16x8_t Low = vmovl_u8(vget_low_u8(Bytes));
+			const uint16x8_t High = vmovl_u8(vget_high_u8(Bytes));
+			std::uint32_t* Out = reinterpret_cast<std::uint32_t*>(Dest);
+			vst1q_u32(Out, vmovl_u16(vget_low_u16(Low)));
+			vst1q_u32(Out + 4, vmovl_u16(vget_high_u16(Low)));
+			vst1q_u32(Out + 8, vmovl_u16(vget_low_u16(High)));
+			vst1q_u32(Out + 12, vmovl_u16(vget_high_u16(High)));
+			return true;
+#else
+			std::uint64_t Words[2];
+			std::memcpy(Words, Source, sizeof(Words));
+			if (((Words[0] | Words[1]) & 0x8080808080808080ull) != 0)
+				return false;
+
+			for (std::size_t i = 0; i < 16; i++)
+				Dest[i] = Source[i];
+			return true;
+#endif
+		}
+	}
+
+	bool DecodeUtf8(const std::string_view& Text, std::u32string& Out)
+	{
+		const std::size_t Size = Text.size();
+		if (Size == 0)
+			return true;
+
+		/* A code point is never shorter than its UTF-8 form, the output is trimmed afterwards. */
+		const std::size_t Start = Out.size();
+		Out.resize(Start + Size);
+
+		const unsigned char* Source = reinterpret_cast<const unsigned char*>(Text.data());
+		char32_t* const Begin = &Out[Start];
+		char32_t* Dest = Begin;
+		bool bIsValid = true;
+
+		std::size_t i = 0;
+		while (i < Size)
+		{
+			const unsigned char Lead = Source[i];
+			if (Lead < 0x80)
+			{
+				while (i + 16 <= Size && DecodeAscii16(Source + i, Dest))
+				{
+					i += 16;
+					Dest += 16;
+				}
+
+				while (i < Size && Source[i] < 0x80)
+					*Dest++ = Source[i++];
+				continue;
+			}
+
+			std::size_t Length = 0;
+			char32_t Codepoint = 0;
+			char32_t Min = 0;
+			if ((Lead & 0xE0) == 0xC0)
+			{
+				Length = 2;
+				Codepoint = Lead & 0x1F;
+				Min = 0x80;
+			}
+			else if ((Lead & 0xF0) == 0xE0)
+			{
+				Length = 3;
+				Codepoint = Lead & 0x0F;
+				Min = 0x800;
+			}
+			else if ((Lead & 0xF8) == 0xF0)
+			{
+				Length = 4;
+				Codepoint = Lead & 0x07;
+				Min = 0x10000;
+			}
+			else
+			{
+				*Dest++ = ReplacementCharacter;
+				bIsValid = false;
+				i++;
+				continue;
+			}
+
+			std::size_t j = 1;
+			for (; j < Length && i + j < Size; j++)
+			{
+				const unsigned char Byte = Source[i + j];
+				if ((Byte & 0xC0) != 0x80)
+					break;
+				Codepoint = (Codepoint << 6) | (Byte & 0x3F);
+			}
+
+			/* Truncated sequence, overlong form, surrogate or out of range. */
+			if (j != Length || Codepoint < Min || Codepoint > 0x10FFFF || (Codepoint >= 0xD800 && Codepoint <= 0xDFFF))
+			{
+				*Dest++ = ReplacementCharacter;
+				bIsValid = false;
+				i += j;
+				continue;
+			}
+
+			*Dest++ = Codepoint;
+			i += Length;
+		}
+
+		Out.resize(Start + static_cast<std::size_t>(Dest - Begin));
+		return bIsValid;
+	}
+
+	std::u32string DecodeUtf8(const std::string_view& Text)
+	{
+		std::u32string Out;
+		DecodeUtf8(Text, Out);
+		return Out;
+	}
+
+	void EncodeUtf8(const std::u32string_view& Text, std::string& Out)
+	{
+		const std::size_t Size = Text.size();
+		if (Size == 0)
+			return;
+
+		/* A code point is at most 4 bytes long, the output is trimmed afterwards. */
+		const std::size_t Start = Out.size();
+		Out.resize(Start + Size * 4);
+
+		char* const Begin = &Out[Start];
+		char* Dest = Begin;
+		for (std::size_t i = 0; i < Size; i++)
+		{
+			char32_t Codepoint = Text[i];
+			if (Codepoint < 0x80)
+			{
+				*Dest++ = static_cast<char>(Codepoint);
+				continue;
+			}
+
+			if (Codepoint > 0x10FFFF || (Codepoint >= 0xD800 && Codepoint <= 0xDFFF))
+				Codepoint = ReplacementCharacter;
+
+			if (Codepoint < 0x800)
+			{
+				*Dest++ = static_cast<char>(0xC0 | (Codepoint >> 6));
+			}
+			else if (Codepoint < 0x10000)
+			{
+				*Dest++ = static_cast<char>(0xE0 | (Codepoint >> 12));
+				*Dest++ = static_cast<char>(0x80 | ((Codepoint >> 6) & 0x3F));
+			}
+			else
+			{
+				*Dest++ = static_cast<char>(0xF0 | (Codepoint >> 18));
+				*Dest++ = static_cast<char>(0x80 | ((Codepoint >> 12) & 0x3F));
+				*Dest++ = static_cast<char>(0x80 | ((Codepoint >> 6) & 0x3F));
+			}
+			*Dest++ = static_cast<char>(0x80 | (Codepoint & 0x3F));
+		}
+
+		Out.resize(Start + static_cast<std::size_t>(Dest - Begin));
+	}
+
+	std::string EncodeUtf8(const std::u32string_view& Text)
+	{
+		std::string Out;
+		EncodeUtf8(Text, Out);
+		return Out;
+	}
+}
@@ -786,6 +786,19 @@ namespace cbgui
 		return Children;
 	}
 
+	std::size_t cbVerticalBox::GetChildrenCount() const
+	{
+		return GetComponentsCount() + mSlots.size();
+	}
+
+	cbWidgetObj* cbVerticalBox::GetChildAt(const std::size_t Index) const
+	{
+		const std::size_t ComponentsCount = GetComponentsCount();
+		if (Index < ComponentsCount)
+			return GetComponentAt(Index);
+		return Index - ComponentsCount < mSlots.size() ? mSlots[Index - ComponentsCount].get() : nullptr;
+	}
+
 	std::vector<cbGeometryVertexData> cbVerticalBox::GetVertexData(const bool LineGeometry) const 
 	{
 		if (LineGeometry)
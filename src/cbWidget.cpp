@@ -33,6 +33,16 @@
 
 namespace cbgui
 {
+	std::vector<cbGeometryVertexData> cbWidgetObj::GetVertexRangeData(const std::size_t FirstVertex, const std::size_t VertexCount) const
+	{
+		std::vector<cbGeometryVertexData> Data = GetVertexData();
+		if (FirstVertex >= Data.size())
+			return std::vector<cbGeometryVertexData>();
+
+		const std::size_t EndVertex = VertexCount < Data.size() - FirstVertex ? FirstVertex + VertexCount : Data.size();
+		return std::vector<cbGeometryVertexData>(Data.begin() + FirstVertex, Data.begin() + EndVertex);
+	}
+
 	cbWidgetObj* cbWidgetObj::GetRootOwner(std::optional<std::size_t> OwnerIndex, const bool SkipSlot) const
 	{
 		if (!HasOwner())
@@ -93,7 +103,7 @@ namespace cbgui
 		, FocusMode(eFocusMode::ZOrder)
 		, ZOrderMode(eZOrderMode::InOrder)
 		, ZOrder(0)
-		, Name(std::nullopt)
+		, Extension(nullptr)
 		, VertexColorAlpha(std::nullopt)
 		, bShouldNotifyCanvas(true)
 	{}
@@ -114,17 +124,57 @@ namespace cbgui
 		, FocusMode(Widget.FocusMode)
 		, ZOrderMode(Widget.ZOrderMode)
 		, ZOrder(Widget.ZOrder)
-		, Name(Widget.Name)
+		, Extension(Widget.Extension ? std::make_unique<cbWidgetExtension>(*Widget.Extension) : nullptr)
 		, VertexColorAlpha(std::nullopt)
 		, bShouldNotifyCanvas(Widget.bShouldNotifyCanvas)
 	{}
 
+	cbWidget::cbWidgetExtension& cbWidget::GetExtension()
+	{
+		if (!Extension)
+			Extension = std::make_unique<cbWidgetExtension>();
+		return *Extension;
+	}
+
 	cbWidget::~cbWidget()
 	{
 		Canvas = nullptr;
 		Owner = nullptr;
 	}
 
+	static thread_local bool bIsInstantiating = false;
+
+	/* Sets the instantiating state of the calling thread and restores the previous one, also when the clone throws. */
+	struct cbInstantiatingScope
+	{
+		const bool bWasInstantiating;
+
+		cbInstantiatingScope()
+			: bWasInstantiating(bIsInstantiating)
+		{
+			bIsInstantiating = true;
+		}
+		~cbInstantiatingScope()
+		{
+			bIsInstantiating = bWasInstantiating;
+		}
+
+		cbInstantiatingScope(const cbInstantiatingScope&) = delete;
+		cbInstantiatingScope& operator=(const cbInstantiatingScope&) = delete;
+	};
+
+	cbWidget::SharedPtr cbWidget::InstantiateWidget()
+	{
+		/* Nested calls keep sharing until the outermost one returns. */
+		const cbInstantiatingScope Scope;
+		return CloneWidget();
+	}
+
+	bool cbWidget::IsInstantiating()
+	{
+		return bIsInstantiating;
+	}
+
 	void cbWidget::AddToCanvas(cbICanvas* InCanvas)
 	{
 		if (!InCanvas || Canvas == InCanvas)
@@ -144,6 +194,7 @@ namespace cbgui
 		}
 
 		Canvas = InCanvas;
+		InvalidateWorldCache();
 		if (IsItSharedObject())
 			Canvas->Add(shared_from_this());
 		else
@@ -164,6 +215,7 @@ namespace cbgui
 
 		const auto pCanvas = Canvas;
 		Canvas = nullptr;
+		InvalidateWorldCache();
 
 		ResetInput();
 		UpdateStatus();
@@ -191,6 +243,7 @@ namespace cbgui
 			return;
 
 		bIsAlignedToCanvas = Value;
+		InvalidateWorldCache();
 
 		UpdateVerticalAlignment(true);
 		UpdateHorizontalAlignment(true);
@@ -235,17 +288,10 @@ namespace cbgui
 	{
 		VertexColorAlpha = Alpha;
 
-		auto Components = GetAllComponents();
-		for (const auto& Component : Components)
-			Component->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren);
+		ForEachComponent([&](cbComponent* Component) { Component->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren); });
 
 		if (PropagateToChildren)
-		{
-			auto Children = GetAllChildren();
-
-			for (const auto& Child : Children)
-				Child->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren);
-		}
+			ForEachChild([&](cbWidgetObj* Child) { Child->SetVertexColorAlpha(VertexColorAlpha, PropagateToChildren); });
 
 		if (HasGeometry())
 			NotifyCanvas_WidgetUpdated();
@@ -256,57 +302,189 @@ namespace cbgui
 		return VertexColorAlpha;
 	}
 
+	void cbWidget::SetTickEnabled(const bool Value, const float Interval)
+	{
+		const std::optional<float> NewInterval = Value ? std::optional<float>(std::max(Interval, 0.0f)) : std::nullopt;
+		if (GetTickInterval() == NewInterval)
+			return;
+
+		GetExtension().TickInterval = NewInterval;
+
+		if (const auto pCanvas = GetCanvas())
+			pCanvas->TickUpdated(this);
+	}
+
+	void cbWidget::SetRenderTransform(const cbRenderTransform& Transform)
+	{
+		if (Transform.IsIdentity())
+		{
+			ResetRenderTransform();
+			return;
+		}
+
+		GetExtension().RenderTransform = Transform;
+		InvalidateWorldCache();
+
+		if (bShouldNotifyCanvas)
+		{
+			if (const auto pCanvas = GetCanvas())
+				pCanvas->RenderTransformUpdated(this);
+		}
+	}
+
+	void cbWidget::ResetRenderTransform()
+	{
+		if (!Extension || !Extension->RenderTransform.has_value())
+			return;
+
+		Extension->RenderTransform = std::nullopt;
+		InvalidateWorldCache();
+
+		if (bShouldNotifyCanvas)
+		{
+			if (const auto pCanvas = GetCanvas())
+				pCanvas->RenderTransformUpdated(this);
+		}
+	}
+
+	bool cbWidget::HasRenderTransform() const
+	{
+		return GetWorldCache().bHasRenderTransform;
+	}
+
+	cbMatrix2x3 cbWidget::GetRenderMatrix() const
+	{
+		return GetWorldCache().RenderMatrix;
+	}
+
+	cbMatrix2x3 cbWidget::GetInverseRenderMatrix() const
+	{
+		return GetWorldCache().InverseRenderMatrix;
+	}
+
+	float cbWidget::GetRenderOpacity() const
+	{
+		return GetWorldCache().RenderOpacity;
+	}
+
+	void cbWidget::SetRenderOpacity(const float Opacity)
+	{
+		cbRenderTransform Transform = GetRenderTransform();
+		if (Transform.Opacity == Opacity)
+			return;
+
+		Transform.Opacity = Opacity;
+		SetRenderTransform(Transform);
+	}
+
 	bool cbWidget::IsInside(const cbVector& Location) const
 	{
-		return IsRotated() ? cbgui::IsInside(GetBounds(), Location, GetRotation(), GetRotatorOrigin()) : cbgui::IsInside(GetBounds(), Location);
+		/* Hit testing is done in layout space. */
+		const cbVector Point = HasRenderTransform() ? GetInverseRenderMatrix().TransformPoint(Location) : Location;
+		return IsRotated() ? cbgui::IsInside(GetBounds(), Point, GetRotation(), GetRotatorOrigin()) : cbgui::IsInside(GetBounds(), Point);
 	}
 
 	bool cbWidget::Intersect(const cbBounds& Other) const
 	{
-		return IsRotated() ? cbgui::Intersect(GetBounds(), Other, GetRotation(), GetRotatorOrigin()) : cbgui::Intersect(GetBounds(), Other);
+		const cbBounds Bounds = HasRenderTransform() ? GetInverseRenderMatrix().TransformBounds(Other) : Other;
+		return IsRotated() ? cbgui::Intersect(GetBounds(), Bounds, GetRotation(), GetRotatorOrigin()) : cbgui::Intersect(GetBounds(), Bounds);
+	}
+
+	bool cbWidget::IsRotated() const
+	{
+		return GetWorldCache().bIsRotated;
 	}
 
 	bool cbWidget::IsItCulled() const
 	{
+		return GetWorldCache().bIsCulled;
+	}
+
+	cbBounds cbWidget::GetCulledBounds() const
+	{
+		return GetWorldCache().CulledBounds;
+	}
+
+	cbBounds cbWidget::GetRenderBounds() const
+	{
+		/* GetCulledBounds can be overridden, the render bounds follow it. */
+		return HasRenderTransform() ? GetRenderMatrix().TransformBounds(GetCulledBounds()) : GetCulledBounds();
+	}
+
+	void cbWidget::InvalidateWorldCache()
+	{
+		/* The subtree is already dirty, a child that rebuilt its world state would have cleared the mark. */
+		if (WorldCache.bIsSubtreeInvalid)
+			return;
+
+		WorldCache.Invalidate();
+		Super::InvalidateWorldCache();
+	}
+
+	void cbWidget::ChildWorldCacheValidated() const
+	{
+		/* A valid world cache has no dirty subtree mark above it. */
+		if (WorldCache.IsValid())
+			return;
+
+		WorldCache.bIsSubtreeInvalid = false;
+		Super::ChildWorldCacheValidated();
+	}
+
+	const cbWorldCache& cbWidget::GetWorldCache() const
+	{
+		if (WorldCache.IsValid())
+			return WorldCache;
+
+		/* The owners read their own caches, each level is computed once per layout change. */
+		WorldCache.bIsRotated = (Owner && Owner->IsRotated()) || GetRotation() != 0.0f;
+
+		const cbMatrix2x3 OwnerMatrix = Owner ? Owner->GetRenderMatrix() : cbMatrix2x3::Identity();
+		const bool bHasLocalTransform = Extension && Extension->RenderTransform.has_value();
+		WorldCache.bHasRenderTransform = bHasLocalTransform || (Owner && Owner->HasRenderTransform());
+		WorldCache.RenderMatrix = bHasLocalTransform ? Extension->RenderTransform->GetMatrix(GetBounds()) * OwnerMatrix : OwnerMatrix;
+		WorldCache.InverseRenderMatrix = WorldCache.bHasRenderTransform ? WorldCache.RenderMatrix.GetInverse() : cbMatrix2x3::Identity();
+		WorldCache.RenderOpacity = GetLocalRenderOpacity() * (Owner ? Owner->GetRenderOpacity() : 1.0f);
+
+		const cbBounds Rect = GetBounds();
+		const cbBounds Bounds = WorldCache.bIsRotated ? cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetRotatorOrigin()) : Rect;
 		if (Owner)
 		{
-			if (Owner->IsItCulled())
-			{
-				return true;
-			}
-			else
-			{
-				const cbBounds& OwnerRect = Owner->GetBounds();
-				const cbBounds& Rect = GetBounds();
-				return OwnerRect.Min.X >= Rect.Max.X || OwnerRect.Min.Y >= Rect.Max.Y;
-			}
+			const cbBounds& OwnerRect = Owner->GetBounds();
+			WorldCache.bIsCulled = Owner->IsItCulled() || OwnerRect.Min.X >= Rect.Max.X || OwnerRect.Min.Y >= Rect.Max.Y;
+			WorldCache.CulledBounds = cbBounds(Bounds).Crop(Owner->GetCulledBounds());
 		}
 		else if (Canvas && bIsAlignedToCanvas)
 		{
 			const cbBounds& OwnerRect = Canvas->GetScreenBounds();
-			const cbBounds& Rect = GetBounds();
-			return OwnerRect.Min.X >= Rect.Max.X || OwnerRect.Min.Y >= Rect.Max.Y;
+			WorldCache.bIsCulled = OwnerRect.Min.X >= Rect.Max.X || OwnerRect.Min.Y >= Rect.Max.Y;
+			WorldCache.CulledBounds = cbBounds(Bounds).Crop(Canvas->GetScreenBounds());
 		}
-		return false;
-	}
-
-	cbBounds cbWidget::GetCulledBounds() const
-	{
-		if (Owner)
+		else
 		{
-			if (IsRotated())
-				return cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetRotatorOrigin()).Crop(Owner->GetCulledBounds());
-			else
-				return cbBounds(GetBounds()).Crop(Owner->GetCulledBounds());
+			WorldCache.bIsCulled = false;
+			WorldCache.CulledBounds = Bounds;
 		}
-		else if (Canvas && bIsAlignedToCanvas)
+
+		/*
+		* The render transform moves the widget out of its slot, it is culled in render space
+		* against the first owner that is not a slot.
+		*/
+		if (bHasLocalTransform && (Owner || (Canvas && bIsAlignedToCanvas)))
 		{
-			if (IsRotated())
-				return cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetRotatorOrigin()).Crop(Canvas->GetScreenBounds());
-			else
-				return cbBounds(GetBounds()).Crop(Canvas->GetScreenBounds());
+			const cbWidgetObj* ClipOwner = Owner ? GetRootOwner(0) : nullptr;
+			if (Owner && !ClipOwner)
+				ClipOwner = Owner;
+			const cbBounds OwnerRect = ClipOwner ? ClipOwner->GetRenderBounds() : Canvas->GetScreenBounds();
+			const cbBounds RenderRect = WorldCache.RenderMatrix.TransformBounds(Bounds);
+			WorldCache.bIsCulled = (ClipOwner && ClipOwner->IsItCulled()) || OwnerRect.Min.X >= RenderRect.Max.X || OwnerRect.Min.Y >= RenderRect.Max.Y;
+			WorldCache.CulledBounds = WorldCache.InverseRenderMatrix.TransformBounds(cbBounds(RenderRect).Crop(OwnerRect));
 		}
-		return IsRotated() ? cbgui::RecalculateBounds(GetDimension(), GetLocation(), GetRotation(), GetRotatorOrigin()) : GetBounds();
+
+		WorldCache.Validate();
+		if (Owner)
+			Owner->ChildWorldCacheValidated();
+		return WorldCache;
 	}
 
 	cbVector cbWidget::GetOrigin() const
@@ -381,6 +559,7 @@ namespace cbgui
 
 	bool cbWidget::DimensionUpdated()
 	{
+		InvalidateWorldCache();
 		if (Owner)
 		{
 			Owner->Notify_DimensionChanged();
@@ -391,6 +570,9 @@ namespace cbgui
 
 	bool cbWidget::NotifyCanvas_WidgetUpdated()
 	{
+		/* The layout of the widget changed, the world state of its subtree is rebuilt on the next read. */
+		InvalidateWorldCache();
+
 		if (!bShouldNotifyCanvas)
 			return false;
 
@@ -404,6 +586,36 @@ namespace cbgui
 		return false;
 	}
 
+	bool cbWidget::NotifyCanvas_ColorUpdated()
+	{
+		if (!bShouldNotifyCanvas)
+			return false;
+
+		const auto pCanvas = GetCanvas();
+
+		if (pCanvas)
+		{
+			pCanvas->WidgetColorUpdated(this);
+			return true;
+		}
+		return false;
+	}
+
+	bool cbWidget::NotifyCanvas_VerticesUpdated(const std::size_t FirstVertex, const std::size_t VertexCount)
+	{
+		if (!bShouldNotifyCanvas || VertexCount == 0)
+			return false;
+
+		const auto pCanvas = GetCanvas();
+
+		if (pCanvas)
+		{
+			pCanvas->WidgetVerticesUpdated(this, FirstVertex, VertexCount);
+			return true;
+		}
+		return false;
+	}
+
 	bool cbWidget::HasOwner() const
 	{
 		return Owner != nullptr;
@@ -439,6 +651,7 @@ namespace cbgui
 		//SetVertexColorAlpha(std::nullopt);
 
 		Owner = Parent;
+		InvalidateWorldCache();
 
 		//if (HasCanvas())
 		//	GetCanvas()->NewSlotContentAdded(Owner, this);
@@ -472,6 +685,7 @@ namespace cbgui
 
 		auto pOwner = Owner;
 		Owner = nullptr;
+		InvalidateWorldCache();
 
 		ResetInput();
 
@@ -580,6 +794,12 @@ namespace cbgui
 			bFocused = value;
 			OnLostFocus();
 		}
+
+		if (bShouldNotifyCanvas)
+		{
+			if (const auto pCanvas = GetCanvas())
+				pCanvas->FocusChanged(this);
+		}
 	}
 
 	bool cbWidget::IsEnabled() const